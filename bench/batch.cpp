@@ -0,0 +1,145 @@
+#include <random>
+
+#include "bench.hpp"
+#include "batch.hpp"
+
+using namespace zz ;
+
+static const char* level_name(SimdLevel level) noexcept {
+	switch (level) {
+		case SimdLevel::SSE2 : return "SSE2" ;
+		case SimdLevel::AVX2 : return "AVX2" ;
+		case SimdLevel::NEON : return "NEON" ;
+		default : return "scalar" ;
+	}
+}
+
+// satu kasus: operator per elemen sebagai baseline lalu fungsi batch di tiap level SIMD
+template <typename per_element, typename batch>
+static void compare(const char* name, size_t count, per_element&& naive, batch&& kernel) {
+	std::printf("%s\n", name) ;
+	const double base = bench::Run("  operator per elemen", count, naive) ;
+	const SimdLevel detected = Simd::GetLevel() ;
+	for (const SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON}) {
+		if (!Simd::SetLevel(level)) {
+			continue ;
+		}
+		char label[64] ;
+		std::snprintf(label, sizeof(label), "  batch %s", level_name(level)) ;
+		bench::Speedup(level_name(level), base, bench::Run(label, count, kernel)) ;
+	}
+	Simd::SetLevel(detected) ;
+}
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	const size_t count = bench::g_quick ? 1000 : 10000 ;
+
+	std::mt19937 random(7) ;
+	std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f) ;
+	std::vector<Rect<float>> rects(count) ;
+	std::vector<Point<float>> points(count) ;
+	std::vector<Rect<int>> irects(count) ;
+	for (size_t i = 0 ; i < count ; ++i) {
+		rects[i] = Rect<float>{coordinate(random), coordinate(random), std::abs(coordinate(random)), std::abs(coordinate(random))} ;
+		points[i] = Point<float>{coordinate(random), coordinate(random)} ;
+		irects[i] = Rect<int>(rects[i]) ;
+	}
+	std::vector<Rect<float>> fout(count) ;
+	std::vector<Rect<int>> iout(count) ;
+
+	// offset bolak-balik supaya nilai tidak terus membesar di antara putaran
+	float sign = 1.0f ;
+	compare("Translate Rect<float>", count, [&] {
+		const Rect<float> offset {0.5f * sign, -0.5f * sign, 0.0f, 0.0f} ;
+		for (Rect<float>& r : rects) {
+			r += offset ;
+		}
+		sign = -sign ;
+		bench::Keep(rects[count / 2]) ;
+	}, [&] {
+		Translate(std::span(rects), Point<float>{0.5f * sign, -0.5f * sign}) ;
+		sign = -sign ;
+		bench::Keep(rects[count / 2]) ;
+	}) ;
+
+	compare("Translate Point<float>", count, [&] {
+		const Point<float> offset {0.5f * sign, -0.5f * sign} ;
+		for (Point<float>& p : points) {
+			p += offset ;
+		}
+		sign = -sign ;
+		bench::Keep(points[count / 2]) ;
+	}, [&] {
+		Translate(std::span(points), Point<float>{0.5f * sign, -0.5f * sign}) ;
+		sign = -sign ;
+		bench::Keep(points[count / 2]) ;
+	}) ;
+
+	compare("Translate Rect<int>", count, [&] {
+		const Point<int> offset {static_cast<int>(sign), -static_cast<int>(sign)} ;
+		for (Rect<int>& r : irects) {
+			r.GetPoint() += offset ;
+		}
+		sign = -sign ;
+		bench::Keep(irects[count / 2]) ;
+	}, [&] {
+		Translate(std::span(irects), Point<int>{static_cast<int>(sign), -static_cast<int>(sign)}) ;
+		sign = -sign ;
+		bench::Keep(irects[count / 2]) ;
+	}) ;
+
+	// faktor bergantian f dan 1/f untuk alasan yang sama
+	float factor = 1.25f ;
+	compare("Scale Rect<float>", count, [&] {
+		const Rect<float> scale {factor, factor, factor, factor} ;
+		for (Rect<float>& r : rects) {
+			r *= scale ;
+		}
+		factor = 1.0f / factor ;
+		bench::Keep(rects[count / 2]) ;
+	}, [&] {
+		Scale(std::span(rects), Point<float>{factor, factor}) ;
+		factor = 1.0f / factor ;
+		bench::Keep(rects[count / 2]) ;
+	}) ;
+
+	const Rect<float> lo {-500.0f, -500.0f, 0.0f, 0.0f} ;
+	const Rect<float> hi {500.0f, 500.0f, 400.0f, 400.0f} ;
+	// clamp idempoten, jadi aman diulang di buffer yang sama
+	compare("Clamp Rect<float>", count, [&] {
+		for (Rect<float>& r : rects) {
+			r = Rect<float>{
+				std::clamp(r.GetPoint().x, lo.GetPoint().x, hi.GetPoint().x),
+				std::clamp(r.GetPoint().y, lo.GetPoint().y, hi.GetPoint().y),
+				std::clamp(r.GetSize().w, lo.GetSize().w, hi.GetSize().w),
+				std::clamp(r.GetSize().h, lo.GetSize().h, hi.GetSize().h)
+			} ;
+		}
+		bench::Keep(rects[count / 2]) ;
+	}, [&] {
+		Clamp(std::span(rects), lo, hi) ;
+		bench::Keep(rects[count / 2]) ;
+	}) ;
+
+	compare("Convert Rect<float> -> Rect<int>", count, [&] {
+		for (size_t i = 0 ; i < count ; ++i) {
+			iout[i] = Rect<int>(rects[i]) ;
+		}
+		bench::Keep(iout[count / 2]) ;
+	}, [&] {
+		Convert(std::span<const Rect<float>>(rects), std::span(iout)) ;
+		bench::Keep(iout[count / 2]) ;
+	}) ;
+
+	compare("Convert Rect<int> -> Rect<float>", count, [&] {
+		for (size_t i = 0 ; i < count ; ++i) {
+			fout[i] = Rect<float>(irects[i]) ;
+		}
+		bench::Keep(fout[count / 2]) ;
+	}, [&] {
+		Convert(std::span<const Rect<int>>(irects), std::span(fout)) ;
+		bench::Keep(fout[count / 2]) ;
+	}) ;
+	return 0 ;
+}
\ No newline at end of file
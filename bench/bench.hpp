@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
+
+// harness benchmark minimal: tiap kasus diulang sampai waktu minimum tercapai lalu dilaporkan per unit kerja
+namespace bench {
+	inline bool g_quick = false ;
+
+	// --quick: satu putaran pendek, hanya memastikan benchmark masih jalan (dipakai ctest)
+	inline void Init(int argc, char** argv) noexcept {
+		for (int i = 1 ; i < argc ; ++i) {
+			if (std::strcmp(argv[i], "--quick") == 0) {
+				g_quick = true ;
+			}
+		}
+	}
+
+	// hasil dianggap terpakai, compiler tidak boleh membuang perhitungannya. barrier kosong yang "membaca" alamat value,
+	// jadi tidak ada variabel yang ditulis tanpa pernah dibaca
+	template <typename type>
+	inline void Keep(const type& value) noexcept {
+		#if defined(_MSC_VER) && !defined(__clang__)
+			static const void* volatile escape = nullptr ;
+			escape = &value ;
+			static_cast<void>(escape) ;
+			_ReadWriteBarrier() ;
+		#else
+			asm volatile("" : : "g"(&value) : "memory") ;
+		#endif
+	}
+
+	// body() mengerjakan items unit per panggilan. return ns per unit
+	template <typename fn>
+	double Run(const char* name, size_t items, fn&& body) {
+		using clock = std::chrono::steady_clock ;
+		const double min_seconds = g_quick ? 0.002 : 0.25 ;
+
+		body() ;
+		size_t calls = 1 ;
+		while (true) {
+			const auto begin = clock::now() ;
+			for (size_t i = 0 ; i < calls ; ++i) {
+				body() ;
+			}
+			const double seconds = std::chrono::duration<double>(clock::now() - begin).count() ;
+			if (seconds >= min_seconds || (g_quick && calls >= 4)) {
+				const double ns = seconds * 1e9 / static_cast<double>(calls * items) ;
+				std::printf("%-52s %12.3f ns/unit %12.2f M/s\n", name, ns, 1e3 / ns) ;
+				return ns ;
+			}
+			const double scale = seconds > 0.0 ? min_seconds / seconds * 1.2 : 10.0 ;
+			calls = std::max(calls * 2, static_cast<size_t>(static_cast<double>(calls) * scale)) ;
+		}
+	}
+
+	inline void Speedup(const char* label, double baseline_ns, double ns) noexcept {
+		std::printf("  -> %s: %.2fx\n", label, baseline_ns / ns) ;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "bench.hpp"
+#include "dispatcher.hpp"
+
+using namespace zz ;
+
+struct Counters {
+	uint64_t mouse = 0 ;
+	uint64_t key = 0 ;
+	uint64_t window = 0 ;
+	uint64_t user = 0 ;
+} ;
+
+// pembanding: rantai if di loop aplikasi seperti sebelum ada Dispatcher
+static void if_chain(const Event& e, Counters& c) noexcept {
+	if (e.IsMouseEvent()) {
+		c.mouse += static_cast<uint64_t>(e.GetMouseEvent().GetPosition().x) ;
+	} else if (e.IsKeyEvent()) {
+		++c.key ;
+	} else if (e.IsWindowEvent()) {
+		++c.window ;
+	} else if (e.IsUserEvent()) {
+		c.user += e.GetUserEvent().GetCode() ;
+	}
+}
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	Application::RegisterWindowClass() ;
+	Window a("a", Size{64, 64}) ;
+	Window b("b", Size{64, 64}) ;
+
+	// campuran event yang realistis: kebanyakan mouse move, sisanya key/user, dari dua window
+	std::vector<Event> events ;
+	for (uint32_t i = 0 ; i < 1024 ; ++i) {
+		const WindowHandle handle = (i / 64) % 2 ? b.GetHandle() : a.GetHandle() ;
+		if (i % 8 == 3) {
+			events.emplace_back(handle, KeyEvent(KeyState::Down, KeyCode{}), 0) ;
+		} else if (i % 8 == 5) {
+			events.emplace_back(handle, UserEvent(i, 0), 0) ;
+		} else {
+			events.emplace_back(handle, MouseEvent(MouseState::Move, MouseButton::None, Point<float>(float(i % 7), 0.0f)), 0) ;
+		}
+	}
+	std::vector<Event> alternating = events ;
+	for (size_t i = 0 ; i < alternating.size() ; ++i) {
+		alternating[i] = Event(i % 2 ? b.GetHandle() : a.GetHandle(), events[i].GetMouseEvent(), 0) ;
+	}
+
+	Counters c ;
+	const double base = bench::Run("if-chain", events.size(), [&] {
+		for (const Event& e : events) {
+			if_chain(e, c) ;
+		}
+		bench::Keep(c) ;
+	}) ;
+
+	StaticDispatcher fast(
+		[&c](const MouseEvent& m) { c.mouse += static_cast<uint64_t>(m.GetPosition().x) ; },
+		[&c](const KeyEvent&) { ++c.key ; },
+		[&c](const WindowEvent&) { ++c.window ; },
+		[&c](const UserEvent& u) { c.user += u.GetCode() ; }
+	) ;
+	bench::Speedup("StaticDispatcher", base, bench::Run("StaticDispatcher", events.size(), [&] {
+		for (const Event& e : events) {
+			fast.Dispatch(e) ;
+		}
+		bench::Keep(c) ;
+	})) ;
+
+	Dispatcher global ;
+	global.On([&c](const MouseEvent& m) { c.mouse += static_cast<uint64_t>(m.GetPosition().x) ; })
+		.On([&c](const KeyEvent&) { ++c.key ; })
+		.On([&c](const WindowEvent&) { ++c.window ; })
+		.On([&c](const UserEvent& u) { c.user += u.GetCode() ; }) ;
+	bench::Speedup("Dispatcher global", base, bench::Run("Dispatcher, handler global", events.size(), [&] {
+		for (const Event& e : events) {
+			global.Dispatch(e) ;
+		}
+		bench::Keep(c) ;
+	})) ;
+
+	Dispatcher per_window ;
+	for (const Window* window : {&a, &b}) {
+		per_window.On(*window, [&c](const MouseEvent& m) { c.mouse += static_cast<uint64_t>(m.GetPosition().x) ; })
+			.On(*window, [&c](const KeyEvent&) { ++c.key ; })
+			.On(*window, [&c](const UserEvent& u) { c.user += u.GetCode() ; }) ;
+	}
+	bench::Speedup("Dispatcher per window", base, bench::Run("Dispatcher, handler per window (burst 64)", events.size(), [&] {
+		for (const Event& e : events) {
+			per_window.Dispatch(e) ;
+		}
+		bench::Keep(c) ;
+	})) ;
+	bench::Speedup("Dispatcher per window, selang-seling", base, bench::Run("Dispatcher, handler per window (selang-seling)", alternating.size(), [&] {
+		for (const Event& e : alternating) {
+			per_window.Dispatch(e) ;
+		}
+		bench::Keep(c) ;
+	})) ;
+
+	// banyak child window, event selang-seling antar window: cache satu entri selalu miss, jadi yang terukur
+	// adalah lookup handle -> slot. biayanya harus sama dengan kasus dua window di atas
+	const size_t count = 256 ;
+	std::vector<std::unique_ptr<Window>> windows ;
+	Dispatcher many ;
+	for (size_t i = 0 ; i < count ; ++i) {
+		windows.push_back(std::make_unique<Window>("child", Size{16, 16})) ;
+		many.On(*windows.back(), [&c](const MouseEvent& m) { c.mouse += static_cast<uint64_t>(m.GetPosition().x) ; }) ;
+	}
+	std::vector<Event> scattered ;
+	for (uint32_t i = 0 ; i < 1024 ; ++i) {
+		scattered.emplace_back(windows[i * 97 % count]->GetHandle(), MouseEvent(MouseState::Move, MouseButton::None, Point<float>(float(i % 7), 0.0f)), 0) ;
+	}
+	bench::Speedup("Dispatcher 256 window, selang-seling", base, bench::Run("Dispatcher, 256 window (selang-seling)", scattered.size(), [&] {
+		for (const Event& e : scattered) {
+			many.Dispatch(e) ;
+		}
+		bench::Keep(c) ;
+	})) ;
+
+	bench::Run("Application::GetWindowSlot (256 window)", scattered.size(), [&] {
+		uint64_t sum = 0 ;
+		for (const Event& e : scattered) {
+			sum += Application::GetWindowSlot(e.GetHandle()).index ;
+		}
+		bench::Keep(sum) ;
+	}) ;
+	return 0 ;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <random>
+
+#include "bench.hpp"
+#include "unit.hpp"
+
+using namespace zz ;
+
+// pembagian per elemen seperti di layout: rect dibagi skalar dan point dibagi point, data tanpa nol
+template <typename policy>
+static double rects_by_scalar(const char* name, const std::vector<Rect<float>>& rects, const std::vector<float>& divisors, std::vector<Rect<float>>& out) {
+	return bench::Run(name, rects.size(), [&] {
+		for (size_t i = 0 ; i < rects.size() ; ++i) {
+			out[i] = Divide<policy>(rects[i], divisors[i]) ;
+		}
+		bench::Keep(out[rects.size() / 2]) ;
+	}) ;
+}
+
+template <typename policy>
+static double points_by_points(const char* name, const std::vector<Point<int>>& points, const std::vector<Point<int>>& divisors, std::vector<Point<int>>& out) {
+	return bench::Run(name, points.size(), [&] {
+		for (size_t i = 0 ; i < points.size() ; ++i) {
+			out[i] = Divide<policy>(points[i], divisors[i]) ;
+		}
+		bench::Keep(out[points.size() / 2]) ;
+	}) ;
+}
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	const size_t count = bench::g_quick ? 512 : 8192 ;
+
+	std::mt19937 random(3) ;
+	std::uniform_real_distribution<float> real(1.0f, 1000.0f) ;
+	std::uniform_int_distribution<int> integer(1, 100000) ;
+	std::vector<Rect<float>> rects(count), rect_out(count) ;
+	std::vector<float> scalars(count) ;
+	std::vector<Point<int>> points(count), point_divisors(count), point_out(count) ;
+	for (size_t i = 0 ; i < count ; ++i) {
+		rects[i] = Rect<float>{real(random), real(random), real(random), real(random)} ;
+		scalars[i] = real(random) ;
+		points[i] = Point<int>{integer(random) - 50000, integer(random) - 50000} ;
+		point_divisors[i] = Point<int>{integer(random) % 64 + 1, -(integer(random) % 64 + 1)} ;
+	}
+
+	std::printf("Rect<float> / float\n") ;
+	double base = rects_by_scalar<DivChecked>("  DivChecked (operator /, melempar)", rects, scalars, rect_out) ;
+	bench::Speedup("DivSaturate", base, rects_by_scalar<DivSaturate>("  DivSaturate", rects, scalars, rect_out)) ;
+	bench::Speedup("DivZero", base, rects_by_scalar<DivZero>("  DivZero", rects, scalars, rect_out)) ;
+	bench::Speedup("DivUnchecked", base, rects_by_scalar<DivUnchecked>("  DivUnchecked", rects, scalars, rect_out)) ;
+
+	std::printf("Point<int> / Point<int>\n") ;
+	base = points_by_points<DivChecked>("  DivChecked (operator /, melempar)", points, point_divisors, point_out) ;
+	bench::Speedup("DivSaturate", base, points_by_points<DivSaturate>("  DivSaturate", points, point_divisors, point_out)) ;
+	bench::Speedup("DivZero", base, points_by_points<DivZero>("  DivZero", points, point_divisors, point_out)) ;
+	bench::Speedup("DivUnchecked", base, points_by_points<DivUnchecked>("  DivUnchecked", points, point_divisors, point_out)) ;
+
+	// pola lama main.cpp: membagi dengan nol lalu menangkap exception tiap frame
+	std::printf("pembagi nol\n") ;
+	base = bench::Run("  operator / + try/catch", 1, [] {
+		try {
+			bench::Keep(Point<float>{1.0f, 2.0f} / 0.0f) ;
+		} catch (const Ex::error_logic& e) {
+			bench::Keep(e) ;
+		}
+	}) ;
+	bench::Speedup("DivZero", base, bench::Run("  Divide<DivZero>", 1, [] {
+		bench::Keep(Divide<DivZero>(Point<float>{1.0f, 2.0f}, 0.0f)) ;
+	})) ;
+	return 0 ;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <queue>
+
+#include "bench.hpp"
+#include "eventsystem.hpp"
+
+using namespace zz ;
+
+// queue lama EventSys: satu alokasi per event
+class HeapQueue {
+private :
+	std::queue<std::unique_ptr<Event>> events_ {} ;
+
+public :
+	void Push(const Event& event) { events_.push(std::make_unique<Event>(event)) ; }
+
+	bool Pop(Event& event) {
+		if (events_.empty()) {
+			return false ;
+		}
+		event = *events_.front() ;
+		events_.pop() ;
+		return true ;
+	}
+} ;
+
+template <typename queue>
+static void push_drain(queue& events, size_t count, const Event& sample) {
+	for (size_t i = 0 ; i < count ; ++i) {
+		events.Push(sample) ;
+	}
+	Event event ;
+	while (events.Pop(event)) {
+		bench::Keep(event) ;
+	}
+}
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	const Event sample(nullptr, MouseEvent(MouseState::Move, MouseButton::None, Point<float>(10.0f, 20.0f)), 0) ;
+
+	// 1 event per message (pola WM_MOUSEMOVE), burst 64 (satu frame), burst 4096 (ring ikut tumbuh ke heap)
+	for (const size_t batch : {size_t(1), size_t(64), size_t(4096)}) {
+		std::printf("batch %zu\n", batch) ;
+
+		HeapQueue heap ;
+		const double base = bench::Run("  std::queue<unique_ptr<Event>> push+pop", batch, [&] { push_drain(heap, batch, sample) ; }) ;
+
+		RingBuffer<Event> ring ;
+		bench::Speedup("RingBuffer", base, bench::Run("  RingBuffer<Event> push+pop", batch, [&] { push_drain(ring, batch, sample) ; })) ;
+
+		// jalur lengkap: PushEvent + PollEvent (cek inbox, histogram latency)
+		bench::Speedup("EventSys", base, bench::Run("  EventSys::PushEvent+PollEvent", batch, [&] {
+			for (size_t i = 0 ; i < batch ; ++i) {
+				EventSys::PushEvent(sample) ;
+			}
+			Event event ;
+			while (EventSys::PollEvent(event)) {
+				bench::Keep(event) ;
+			}
+		})) ;
+	}
+	return 0 ;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <random>
+
+#include "bench.hpp"
+#include "geometry.hpp"
+
+using namespace zz ;
+
+// pembanding: versi dengan && dan if biasa, bentuk yang umum ditulis sebelum geometry.hpp
+namespace naive {
+	template <Arithmetic type>
+	bool contains(const Rect<type>& r, const Point<type>& p) noexcept {
+		return r.GetSize().w > 0 && r.GetSize().h > 0
+			&& p.x >= r.GetPoint().x && p.x < Right(r)
+			&& p.y >= r.GetPoint().y && p.y < Bottom(r) ;
+	}
+
+	template <Arithmetic type>
+	bool intersects(const Rect<type>& a, const Rect<type>& b) noexcept {
+		if (IsEmpty(a) || IsEmpty(b)) {
+			return false ;
+		}
+		return a.GetPoint().x < Right(b) && b.GetPoint().x < Right(a) && a.GetPoint().y < Bottom(b) && b.GetPoint().y < Bottom(a) ;
+	}
+
+	template <Arithmetic type>
+	Rect<type> intersect(const Rect<type>& a, const Rect<type>& b) noexcept {
+		if (!intersects(a, b)) {
+			return Rect<type>{} ;
+		}
+		const EdgeType<type> x0 = std::max<EdgeType<type>>(a.GetPoint().x, b.GetPoint().x) ;
+		const EdgeType<type> y0 = std::max<EdgeType<type>>(a.GetPoint().y, b.GetPoint().y) ;
+		return Rect<type>(
+			static_cast<type>(x0),
+			static_cast<type>(y0),
+			static_cast<MakeSizeType<type>>(std::min(Right(a), Right(b)) - x0),
+			static_cast<MakeSizeType<type>>(std::min(Bottom(a), Bottom(b)) - y0)
+		) ;
+	}
+
+	// topmost = hit terakhir, sama dengan HitTest
+	template <Arithmetic type>
+	size_t hit_test(std::span<const Rect<type>> rects, const Point<type>& p) noexcept {
+		size_t hit = rects.size() ;
+		for (size_t i = 0 ; i < rects.size() ; ++i) {
+			if (contains(rects[i], p)) {
+				hit = i ;
+			}
+		}
+		return hit ;
+	}
+}
+
+template <Arithmetic type>
+static void run(const char* label, size_t count) {
+	std::printf("Rect<%s>\n", label) ;
+	// data acak: sekitar separuh perbandingan gagal di tempat yang tidak bisa ditebak branch predictor
+	std::mt19937 random(5) ;
+	std::uniform_int_distribution<int> position(-500, 500) ;
+	std::uniform_int_distribution<int> extent(0, 400) ;
+	std::vector<Rect<type>> rects(count) ;
+	std::vector<Point<type>> points(count) ;
+	for (size_t i = 0 ; i < count ; ++i) {
+		rects[i] = Rect<type>(position(random), position(random), extent(random), extent(random)) ;
+		points[i] = Point<type>(position(random), position(random)) ;
+	}
+	const Rect<type> clip(-200, -200, 400, 400) ;
+
+	double base = bench::Run("  naive Contains(rect, point)", count, [&] {
+		size_t hits = 0 ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			hits += naive::contains(rects[i], points[i]) ;
+		}
+		bench::Keep(hits) ;
+	}) ;
+	bench::Speedup("Contains", base, bench::Run("  Contains(rect, point)", count, [&] {
+		size_t hits = 0 ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			hits += Contains(rects[i], points[i]) ;
+		}
+		bench::Keep(hits) ;
+	})) ;
+
+	base = bench::Run("  naive Intersects", count, [&] {
+		size_t hits = 0 ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			hits += naive::intersects(rects[i], rects[count - 1 - i]) ;
+		}
+		bench::Keep(hits) ;
+	}) ;
+	bench::Speedup("Intersects", base, bench::Run("  Intersects", count, [&] {
+		size_t hits = 0 ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			hits += Intersects(rects[i], rects[count - 1 - i]) ;
+		}
+		bench::Keep(hits) ;
+	})) ;
+
+	std::vector<Rect<type>> out(count) ;
+	base = bench::Run("  naive Intersect (clip)", count, [&] {
+		for (size_t i = 0 ; i < count ; ++i) {
+			out[i] = naive::intersect(rects[i], clip) ;
+		}
+		bench::Keep(out[count / 2]) ;
+	}) ;
+	bench::Speedup("Intersect", base, bench::Run("  ClipTo(span)", count, [&] {
+		std::copy(rects.begin(), rects.end(), out.begin()) ;
+		ClipTo(std::span(out), clip) ;
+		bench::Keep(out[count / 2]) ;
+	})) ;
+
+	// satu titik vs semua rect, per rect yang dites
+	const size_t probes = 64 ;
+	base = bench::Run("  naive hit test (if per rect)", probes * count, [&] {
+		size_t sum = 0 ;
+		for (size_t i = 0 ; i < probes ; ++i) {
+			sum += naive::hit_test(std::span<const Rect<type>>(rects), points[i]) ;
+		}
+		bench::Keep(sum) ;
+	}) ;
+	bench::Speedup("HitTest", base, bench::Run("  HitTest(span)", probes * count, [&] {
+		size_t sum = 0 ;
+		for (size_t i = 0 ; i < probes ; ++i) {
+			sum += HitTest(std::span<const Rect<type>>(rects), points[i]) ;
+		}
+		bench::Keep(sum) ;
+	})) ;
+	const RectArray<type> soa {std::span<const Rect<type>>(rects)} ;
+	bench::Speedup("HitTest SoA", base, bench::Run("  HitTest(RectArray)", probes * count, [&] {
+		size_t sum = 0 ;
+		for (size_t i = 0 ; i < probes ; ++i) {
+			sum += HitTest(soa, points[i]) ;
+		}
+		bench::Keep(sum) ;
+	})) ;
+}
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	const size_t count = bench::g_quick ? 256 : 4096 ;
+	run<int>("int", count) ;
+	run<float>("float", count) ;
+	return 0 ;
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <queue>
+#include <thread>
+
+#include "bench.hpp"
+#include "eventsystem.hpp"
+
+using namespace zz ;
+
+// pembanding: queue biasa dijaga mutex, konsumen dibangunkan lewat backend seperti PostEvent
+class MutexQueue {
+private :
+	std::mutex mutex_ {} ;
+	std::queue<Event> events_ {} ;
+
+public :
+	bool Push(const Event& event) {
+		{
+			std::lock_guard lock(mutex_) ;
+			events_.push(event) ;
+		}
+		EventSys::Wakeup() ;
+		return true ;
+	}
+
+	bool Pop(Event& event) {
+		std::lock_guard lock(mutex_) ;
+		if (events_.empty()) {
+			return false ;
+		}
+		event = events_.front() ;
+		events_.pop() ;
+		return true ;
+	}
+} ;
+
+// producers thread masing-masing mengirim count event, thread ini mengonsumsi sampai semuanya diterima
+template <typename push_fn, typename pop_fn>
+static void run(uint32_t producers, uint32_t count, push_fn&& push, pop_fn&& pop) {
+	std::atomic<bool> go {false} ;
+	std::vector<std::thread> threads ;
+	for (uint32_t p = 0 ; p < producers ; ++p) {
+		threads.emplace_back([p, count, &go, &push] {
+			while (!go.load(std::memory_order_acquire)) {}
+			for (uint32_t i = 0 ; i < count ; ++i) {
+				while (!push(Event(nullptr, UserEvent(p, i), 0))) {
+					std::this_thread::yield() ;
+				}
+			}
+		}) ;
+	}
+
+	go.store(true, std::memory_order_release) ;
+	const uint64_t total = uint64_t(producers) * count ;
+	uint64_t received = 0 ;
+	Event event ;
+	while (received < total) {
+		if (pop(event)) {
+			++received ;
+		} else {
+			// jangan menghabiskan time slice producer kalau core lebih sedikit dari thread
+			std::this_thread::yield() ;
+		}
+	}
+	for (std::thread& thread : threads) {
+		thread.join() ;
+	}
+}
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	const uint32_t count = bench::g_quick ? 2000 : 200000 ;
+	const uint32_t cores = std::max(std::thread::hardware_concurrency(), 2u) ;
+
+	std::vector<uint32_t> counts = {1, 2, 4} ;
+	if (cores - 1 > 4) {
+		counts.push_back(cores - 1) ;
+	}
+	for (const uint32_t producers : counts) {
+		std::printf("%u producer\n", producers) ;
+		const size_t total = size_t(producers) * count ;
+
+		MutexQueue locked ;
+		const double base = bench::Run("  mutex + std::queue + Wakeup", total, [&] {
+			run(producers, count, [&locked](const Event& e) { return locked.Push(e) ; }, [&locked](Event& e) { return locked.Pop(e) ; }) ;
+		}) ;
+
+		static MpscQueue<Event> queue ;
+		bench::Speedup("MpscQueue", base, bench::Run("  MpscQueue TryPush/TryPop (tanpa wakeup)", total, [&] {
+			run(producers, count, [](const Event& e) { return queue.TryPush(e) ; }, [](Event& e) { return queue.TryPop(e) ; }) ;
+		})) ;
+
+		bench::Speedup("PostEvent", base, bench::Run("  EventSys::PostEvent/PollEvent", total, [&] {
+			run(producers, count, [](const Event& e) { return EventSys::PostEvent(e) ; }, [](Event& e) { return EventSys::PollEvent(e) ; }) ;
+		})) ;
+	}
+	return 0 ;
+}
\ No newline at end of file
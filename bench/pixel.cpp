@@ -0,0 +1,122 @@
+#include <random>
+
+#include "bench.hpp"
+#include "pixel.hpp"
+
+using namespace zz ;
+
+static const char* level_name(SimdLevel level) noexcept {
+	switch (level) {
+		case SimdLevel::SSE2 : return "SSE2" ;
+		case SimdLevel::AVX2 : return "AVX2" ;
+		case SimdLevel::NEON : return "NEON" ;
+		default : return "scalar" ;
+	}
+}
+
+// satu operasi di tiap level SIMD, baseline-nya level scalar dari kernel yang sama
+template <typename fn>
+static void compare(const char* name, size_t count, fn&& body) {
+	std::printf("%s\n", name) ;
+	const SimdLevel detected = Simd::GetLevel() ;
+	double base = 0.0 ;
+	for (const SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON}) {
+		if (!Simd::SetLevel(level)) {
+			continue ;
+		}
+		char label[64] ;
+		std::snprintf(label, sizeof(label), "  %s", level_name(level)) ;
+		const double ns = bench::Run(label, count, body) ;
+		if (level == SimdLevel::Scalar) {
+			base = ns ;
+		} else {
+			bench::Speedup(level_name(level), base, ns) ;
+		}
+	}
+	Simd::SetLevel(detected) ;
+}
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	// satu baris 1920 piksel, ukuran kerja fill/blend per scanline
+	const size_t count = bench::g_quick ? 256 : 1920 ;
+
+	std::mt19937 random(9) ;
+	std::uniform_int_distribution<int> byte(0, 255) ;
+	std::vector<Color> src(count), dst(count), work(count) ;
+	for (size_t i = 0 ; i < count ; ++i) {
+		const uint8_t a = static_cast<uint8_t>(byte(random)) ;
+		src[i] = Premultiply(Color(static_cast<uint8_t>(byte(random)), static_cast<uint8_t>(byte(random)), static_cast<uint8_t>(byte(random)), a)) ;
+		dst[i] = Color(static_cast<uint8_t>(byte(random)), static_cast<uint8_t>(byte(random)), static_cast<uint8_t>(byte(random)), 255) ;
+	}
+
+	// tiap putaran mulai dari dst yang sama, salinannya ikut terukur di semua level
+	const BlendMode modes[] = {BlendMode::SourceOver, BlendMode::Multiply, BlendMode::Screen} ;
+	const char* names[] = {"Blend span SourceOver (+ copy)", "Blend span Multiply (+ copy)", "Blend span Screen (+ copy)"} ;
+	for (size_t m = 0 ; m < 3 ; ++m) {
+		compare(names[m], count, [&, mode = modes[m]] {
+			std::copy(dst.begin(), dst.end(), work.begin()) ;
+			Blend(std::span(work), std::span<const Color>(src), mode) ;
+			bench::Keep(work[count / 2]) ;
+		}) ;
+	}
+
+	compare("Blend solid SourceOver (+ copy)", count, [&] {
+		std::copy(dst.begin(), dst.end(), work.begin()) ;
+		Blend(std::span(work), Color(40, 80, 120, 160)) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+
+	// SourceOverGamma per level (span AVX2 memakai gather), pembandingnya SourceOver di level yang terdeteksi
+	std::printf("Blend SourceOver, level %s (+ copy)\n", level_name(Simd::GetLevel())) ;
+	const double over = bench::Run("  span SourceOver", count, [&] {
+		std::copy(dst.begin(), dst.end(), work.begin()) ;
+		Blend(std::span(work), std::span<const Color>(src)) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+	const auto gamma = [&](const char* name, auto&& body) {
+		compare(name, count, body) ;
+		bench::Speedup("level terdeteksi terhadap SourceOver", over, bench::Run("  level terdeteksi", count, body)) ;
+	} ;
+	gamma("Blend span SourceOverGamma (+ copy)", [&] {
+		std::copy(dst.begin(), dst.end(), work.begin()) ;
+		Blend(std::span(work), std::span<const Color>(src), BlendMode::SourceOverGamma) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+	gamma("Blend solid SourceOverGamma (+ copy)", [&] {
+		std::copy(dst.begin(), dst.end(), work.begin()) ;
+		Blend(std::span(work), Color(40, 80, 120, 160), BlendMode::SourceOverGamma) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+	// dst semi transparan (layer offscreen): jalur umum dengan pembagian lewat tabel kebalikan
+	gamma("Blend span SourceOverGamma, dst alpha < 255 (+ copy)", [&] {
+		std::copy(src.begin(), src.end(), work.begin()) ;
+		Blend(std::span(work), std::span<const Color>(src), BlendMode::SourceOverGamma) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+
+	compare("Premultiply (+ copy)", count, [&] {
+		std::copy(dst.begin(), dst.end(), work.begin()) ;
+		Premultiply(std::span(work)) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+
+	compare("Unpremultiply (+ copy)", count, [&] {
+		std::copy(src.begin(), src.end(), work.begin()) ;
+		Unpremultiply(std::span(work)) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+
+	compare("Lerp (+ copy)", count, [&] {
+		std::copy(dst.begin(), dst.end(), work.begin()) ;
+		Lerp(std::span(work), std::span<const Color>(src), 100) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+
+	std::printf("copy saja (biaya yang ikut terukur di atas)\n") ;
+	bench::Run("  std::copy", count, [&] {
+		std::copy(dst.begin(), dst.end(), work.begin()) ;
+		bench::Keep(work[count / 2]) ;
+	}) ;
+	return 0 ;
+}
\ No newline at end of file
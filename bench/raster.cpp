@@ -0,0 +1,71 @@
+#include "bench.hpp"
+#include "raster.hpp"
+
+using namespace zz ;
+
+// scene mirip UI: latar, panel rounded semi transparan, kartu, garis dan ikon polygon tersebar di seluruh layar
+static void record(Rasterizer& raster, int width, int height) {
+	raster.FillRect(Rect<int>(0, 0, static_cast<uint32_t>(width), static_cast<uint32_t>(height)), Color(28, 30, 36, 255)) ;
+	for (int y = 0 ; y < height ; y += 180) {
+		for (int x = 0 ; x < width ; x += 240) {
+			const float fx = static_cast<float>(x) ;
+			const float fy = static_cast<float>(y) ;
+			raster.FillRoundedRect(Rect<float>(fx + 10.5f, fy + 10.5f, 220.0f, 160.0f), 14.0f, Premultiply(Color(70, 120, 200, 180))) ;
+			raster.FillRect(Rect<int>(x + 24, y + 30, 190, 24), Color(240, 240, 240, 255)) ;
+			raster.FillRect(Rect<int>(x + 24, y + 64, 150, 12), Premultiply(Color(255, 255, 255, 90))) ;
+			raster.DrawLine(Point<float>(fx + 20.0f, fy + 150.0f), Point<float>(fx + 210.0f, fy + 96.0f), 2.5f, Color(250, 200, 90, 255)) ;
+			const std::array<Point<float>, 3> icon {Point<float>(fx + 190.0f, fy + 120.0f), Point<float>(fx + 215.0f, fy + 160.0f), Point<float>(fx + 165.0f, fy + 160.0f)} ;
+			raster.FillPolygon(icon, Premultiply(Color(120, 220, 140, 200))) ;
+		}
+	}
+}
+
+static bool same(const SurfaceView& a, const SurfaceView& b) noexcept {
+	for (int y = 0 ; y < a.Height() ; ++y) {
+		if (std::memcmp(a.Row(y), b.Row(y), static_cast<size_t>(a.Width()) * sizeof(Color)) != 0) {
+			return false ;
+		}
+	}
+	return true ;
+}
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	// satu frame 4K penuh, satuan waktu per piksel target
+	const int width = bench::g_quick ? 640 : 3840 ;
+	const int height = bench::g_quick ? 360 : 2160 ;
+	const size_t pixels = static_cast<size_t>(width) * static_cast<size_t>(height) ;
+
+	Rasterizer raster ;
+	record(raster, width, height) ;
+	std::printf("%dx%d, %zu perintah, %u core\n", width, height, raster.GetCommandCount(), std::thread::hardware_concurrency()) ;
+
+	Surface serial(width, height) ;
+	const double base = bench::Run("  serial (tanpa pool)", pixels, [&] {
+		raster.Render(serial) ;
+		bench::Keep(serial.At(width / 2, height / 2)) ;
+	}) ;
+
+	std::vector<size_t> counts = {1, 2, 4} ;
+	const size_t cores = std::thread::hardware_concurrency() ;
+	if (cores > 4) {
+		counts.push_back(cores) ;
+	}
+	for (const size_t count : counts) {
+		ThreadPool pool(count - 1) ;
+		Surface parallel(width, height) ;
+		char label[64] ;
+		std::snprintf(label, sizeof(label), "  %zu thread", count) ;
+		const double ns = bench::Run(label, pixels, [&] {
+			raster.Render(parallel, &pool) ;
+			bench::Keep(parallel.At(width / 2, height / 2)) ;
+		}) ;
+		bench::Speedup(label + 2, base, ns) ;
+		// scene diawali rect opaque penuh, jadi hasil tiap frame tidak bergantung isi sebelumnya
+		if (!same(serial, parallel)) {
+			std::printf("  !! hasil %zu thread berbeda dengan serial\n", count) ;
+			return 1 ;
+		}
+	}
+	return 0 ;
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <random>
+
+#include "bench.hpp"
+#include "spatial.hpp"
+
+using namespace zz ;
+
+// pembanding: scan linear atas semua rect, seperti menelusuri semua widget per mouse move
+class LinearScan {
+private :
+	std::vector<Rect<float>> rects_ {} ;
+	std::vector<uint32_t> z_ {} ;
+
+public :
+	void Insert(uint32_t id, const Rect<float>& r, uint32_t z) {
+		if (id >= rects_.size()) {
+			rects_.resize(static_cast<size_t>(id) + 1) ;
+			z_.resize(static_cast<size_t>(id) + 1) ;
+		}
+		rects_[id] = r ;
+		z_[id] = z ;
+	}
+
+	std::optional<uint32_t> TopAt(const Point<float>& p) const noexcept {
+		std::optional<uint32_t> best {} ;
+		for (uint32_t id = 0 ; id < rects_.size() ; ++id) {
+			if (Contains(rects_[id], p) && (!best || z_[id] >= z_[*best])) {
+				best = id ;
+			}
+		}
+		return best ;
+	}
+} ;
+
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	// 100k widget di area 8000 x 8000, ukuran 20..200, z acak kecil seperti kedalaman pohon
+	const uint32_t count = bench::g_quick ? 2000 : 100000 ;
+	const float world = bench::g_quick ? 1000.0f : 8000.0f ;
+	std::mt19937 random(24) ;
+	std::uniform_real_distribution<float> position(0.0f, world) ;
+	std::uniform_real_distribution<float> extent(20.0f, 200.0f) ;
+	std::vector<Rect<float>> rects(count) ;
+	std::vector<uint32_t> z(count) ;
+	for (uint32_t i = 0 ; i < count ; ++i) {
+		rects[i] = Rect<float>(position(random), position(random), extent(random), extent(random)) ;
+		z[i] = i % 8 ;
+	}
+
+	constexpr size_t probes = 4096 ;
+	std::vector<Point<float>> points(probes) ;
+	std::vector<Rect<float>> areas(probes) ;
+	std::vector<uint32_t> targets(probes) ;
+	for (size_t i = 0 ; i < probes ; ++i) {
+		points[i] = Point<float>(position(random), position(random)) ;
+		areas[i] = Rect<float>(position(random), position(random), 300.0f, 200.0f) ;
+		targets[i] = static_cast<uint32_t>(random() % count) ;
+	}
+
+	std::printf("%u elemen\n", count) ;
+	LinearScan linear ;
+	for (uint32_t i = 0 ; i < count ; ++i) {
+		linear.Insert(i, rects[i], z[i]) ;
+	}
+	size_t probe = 0 ;
+	const double scan = bench::Run("  scan linear TopAt", 1, [&] {
+		bench::Keep(linear.TopAt(points[probe++ % probes])) ;
+	}) ;
+
+	SpatialGrid grid(128.0f) ;
+	PackedRTree tree ;
+	SpatialIndex* const indexes[] = {&grid, &tree} ;
+	const char* const names[] = {"SpatialGrid (cell 128)", "PackedRTree"} ;
+	for (size_t k = 0 ; k < 2 ; ++k) {
+		SpatialIndex& index = *indexes[k] ;
+		std::printf("%s\n", names[k]) ;
+		for (uint32_t i = 0 ; i < count ; ++i) {
+			index.Insert(i, rects[i], z[i]) ;
+		}
+		index.TopAt(points[0]) ;		// PackedRTree membangun tree di query pertama
+
+		std::vector<uint32_t> out ;
+		bench::Speedup("TopAt", scan, bench::Run("  TopAt", 1, [&] {
+			bench::Keep(index.TopAt(points[probe++ % probes])) ;
+		})) ;
+		bench::Run("  QueryPoint", 1, [&] {
+			index.QueryPoint(points[probe++ % probes], out) ;
+			bench::Keep(out.size()) ;
+		}) ;
+		bench::Run("  QueryRect 300x200", 1, [&] {
+			index.QueryRect(areas[probe++ % probes], out) ;
+			bench::Keep(out.size()) ;
+		}) ;
+
+		// update: geser 2 px (grid biasanya cell yang sama, tree refit), lalu kembali supaya data tetap sama
+		size_t step = 0 ;
+		bench::Run("  Insert geser kecil (update)", 1, [&] {
+			const uint32_t id = targets[step % probes] ;
+			const float dx = step / probes % 2 == 0 ? 2.0f : 0.0f ;
+			index.Insert(id, Rect<float>(Point<float>(rects[id].GetPoint().x + dx, rects[id].GetPoint().y), rects[id].GetSize()), z[id]) ;
+			++step ;
+		}) ;
+		index.TopAt(points[0]) ;
+
+		// pindah jauh, termasuk rebuild otomatis PackedRTree yang dibayar query berikutnya
+		bench::Run("  Insert pindah jauh + TopAt per 64 update", 1, [&] {
+			const uint32_t id = targets[step % probes] ;
+			index.Insert(id, step / probes % 2 == 0 ? rects[targets[(step + 1) % probes]] : rects[id], z[id]) ;
+			if (++step % 64 == 0) {
+				bench::Keep(index.TopAt(points[step % probes])) ;
+			}
+		}) ;
+		for (uint32_t i = 0 ; i < count ; ++i) {
+			index.Insert(i, rects[i], z[i]) ;
+		}
+	}
+
+	std::printf("PackedRTree\n") ;
+	bench::Run("  Rebuild (per elemen)", count, [&] {
+		tree.Rebuild() ;
+	}) ;
+	return 0 ;
+}
\ No newline at end of file
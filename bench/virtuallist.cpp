@@ -0,0 +1,63 @@
+#include "bench.hpp"
+#include "virtuallist.hpp"
+
+using namespace zz ;
+
+class FixedText : public TextRenderer {
+public :
+	void DrawText(Rasterizer&, const Rect<int>&, std::string_view, Color, uint32_t) override {}
+	Size<int> MeasureText(std::string_view text, uint32_t) override { return Size<int>(static_cast<int>(text.size()) * 8, 16) ; }
+} ;
+
+// satu frame scroll = Update + Layout (+ Update ulang seperti loop aplikasi). jumlah baris naik 1e3 -> 1e9,
+// waktu per frame harus tetap karena hanya baris yang terlihat punya widget
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	const Rect<int> client(0, 0, 1280, 1080) ;
+	const uint64_t counts[] = {1'000, 1'000'000, 1'000'000'000} ;
+	FixedText text ;
+
+	double base_small = 0.0 ;
+	double base_jump = 0.0 ;
+	for (const uint64_t count : counts) {
+		WidgetTree tree ;
+		tree.SetTextRenderer(&text) ;
+		tree.SetViewport(Size<float>(1280.0f, 1080.0f)) ;
+		VirtualList list(tree, tree.GetRoot(), WidgetStyle{.grow = 1.0f}, VirtualListStyle{}, {90.0f, 70.0f, -1.0f}, [](uint64_t row, uint32_t column, std::string& out) {
+			out = std::to_string(row * 3 + column) ;
+		}, count) ;
+		const auto frame = [&] {
+			list.Update(client) ;
+			tree.Layout() ;
+			if (list.Update(client)) {
+				tree.Layout() ;
+			}
+		} ;
+		frame() ;
+		std::printf("%llu baris, pool %zu, %zu widget\n", static_cast<unsigned long long>(count), list.GetPoolSize(), tree.GetCount()) ;
+
+		// geser 7.3 px per frame bolak-balik di 1000 baris pertama: kebanyakan frame hanya mengisi satu baris baru
+		size_t step = 0 ;
+		const double small = bench::Run("  scroll kecil (Update + Layout)", 1, [&] {
+			list.ScrollTo(static_cast<double>(step++ % 2000) * 7.3, false) ;
+			frame() ;
+			bench::Keep(list.GetFirstRow()) ;
+		}) ;
+
+		// lompat jauh setiap frame (scrollbar ditarik): semua baris di pool diisi ulang
+		const double jump = bench::Run("  lompat jauh (Update + Layout)", 1, [&] {
+			list.ScrollToRow(static_cast<uint64_t>(step++ * 7919) % count, false) ;
+			frame() ;
+			bench::Keep(list.GetFirstRow()) ;
+		}) ;
+
+		if (count == counts[0]) {
+			base_small = small ;
+			base_jump = jump ;
+		} else {
+			bench::Speedup("scroll kecil relatif 1e3 baris", base_small, small) ;
+			bench::Speedup("lompat jauh relatif 1e3 baris", base_jump, jump) ;
+		}
+	}
+	return 0 ;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "bench.hpp"
+#include "widget.hpp"
+
+using namespace zz ;
+
+class FixedText : public TextRenderer {
+public :
+	void DrawText(Rasterizer&, const Rect<int>&, std::string_view, Color, uint32_t) override {}
+	Size<int> MeasureText(std::string_view text, uint32_t) override { return Size<int>(static_cast<int>(text.size()) * 8, 16) ; }
+} ;
+
+static void build(WidgetTree& tree, SlotHandle parent, size_t level, size_t depth, size_t fanout, std::vector<SlotHandle>& leaves) {
+	for (size_t i = 0 ; i < fanout ; ++i) {
+		if (level + 1 == depth) {
+			leaves.push_back(tree.CreateLabel(parent, "label", Color(255, 255, 255, 255))) ;
+			continue ;
+		}
+		const WidgetStyle style {.layout = level % 2 == 0 ? WidgetLayout::Row : WidgetLayout::Column, .padding = 2.0f, .gap = 1.0f} ;
+		build(tree, tree.Create(parent, style), level + 1, depth, fanout, leaves) ;
+	}
+}
+
+// fanout tetap 10, kedalaman bertambah: layout penuh naik sebanding n, satu SetText naik sebanding depth x fanout
+int main(int argc, char** argv) {
+	bench::Init(argc, argv) ;
+	const size_t max_depth = bench::g_quick ? 3 : 5 ;
+	FixedText text ;
+
+	for (size_t depth = 3 ; depth <= max_depth ; ++depth) {
+		WidgetTree tree ;
+		std::vector<SlotHandle> leaves ;
+		tree.SetTextRenderer(&text) ;
+		tree.SetViewport(Size<float>(1920.0f, 1080.0f)) ;
+		build(tree, tree.GetRoot(), 0, depth, 10, leaves) ;
+		tree.Layout() ;
+		std::printf("%zu node, depth %zu\n", tree.GetCount(), depth) ;
+
+		const double full = bench::Run("  Layout penuh (MarkAll)", 1, [&] {
+			tree.MarkAll() ;
+			bench::Keep(tree.Layout()) ;
+		}) ;
+
+		// tiap label dipanjangkan lalu dikembalikan, ukurannya benar-benar berubah di setiap panggilan
+		size_t step = 0 ;
+		LayoutStats stats {} ;
+		bench::Speedup("incremental", full, bench::Run("  SetText satu label + Layout", 1, [&] {
+			const SlotHandle leaf = leaves[step / 2 * 7919 % leaves.size()] ;
+			tree.SetText(leaf, step % 2 == 0 ? "label yang lebih panjang" : "label") ;
+			stats = tree.Layout() ;
+			++step ;
+			bench::Keep(stats) ;
+		})) ;
+		std::printf("  terakhir: %zu measured, %zu arranged\n", stats.measured, stats.arranged) ;
+	}
+	return 0 ;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "enum.hpp"
+
+namespace zz {
+
+	inline constexpr size_t cache_line = 64 ;
+
+	// allocator untuk std::vector yang datanya harus rata ke cache line (load SIMD, tanpa false sharing)
+	template <typename type, size_t alignment = cache_line>
+	requires (std::has_single_bit(alignment) && alignment >= alignof(type))
+	struct AlignedAllocator {
+		using value_type = type ;
+
+		template <typename rebound>
+		struct rebind { using other = AlignedAllocator<rebound, alignment> ; } ;
+
+		constexpr AlignedAllocator() noexcept = default ;
+
+		template <typename other>
+		constexpr AlignedAllocator(const AlignedAllocator<other, alignment>&) noexcept {}
+
+		type* allocate(size_t n) {
+			return static_cast<type*>(::operator new(n * sizeof(type), std::align_val_t{alignment})) ;
+		}
+
+		void deallocate(type* data, size_t) noexcept {
+			::operator delete(data, std::align_val_t{alignment}) ;
+		}
+
+		template <typename other>
+		constexpr bool operator==(const AlignedAllocator<other, alignment>&) const noexcept { return true ; }
+	} ;
+
+	template <typename type, size_t alignment = cache_line>
+	using AlignedVector = std::vector<type, AlignedAllocator<type, alignment>> ;
+}
\ No newline at end of file
@@ -1,130 +1,172 @@
-#pragma once
-
-#include "event.hpp"
-
-namespace zz {
-	inline LRESULT CALLBACK WindowProcedure(HWND handle, uint32_t message, uint64_t  wparam, int64_t lparam) noexcept ;
-
-	class Application {
-		friend inline LRESULT CALLBACK WindowProcedure(HWND handle, uint32_t message, uint64_t  wparam, int64_t lparam) noexcept ;
-		friend class Event ;
-		
-	protected :
-		static inline bool g_is_running_ = false ;
-		static inline std::unordered_map<HWND, Window*> g_windows_ {} ;
-		static inline HINSTANCE g_hinstance_ = GetModuleHandleW(nullptr) ;
-		static inline std::string g_class_name_ = "zketch_app" ;
-		static inline bool g_class_name_was_registered_ = false ;
-
-		static void RegisterWindow(HWND handle, Window* window) {
-			if (handle && window) {
-				g_windows_[handle] = window ;
-			} else {
-				throw handle ? Ex::application("HWND is Null!") : Ex::application("Window is Null!") ;
-			}
-		}
-
-		static void UnregisterWindow(HWND handle) noexcept {
-			if (handle) {
-				auto it = g_windows_.find(handle) ;
-				if (it != g_windows_.end()) {
-					g_windows_.erase(it) ;
-
-					#ifdef APPLICATION_DEBUG
-						logger::info("Application::UnRegisterWindow - Erased window from g_windows_, current size: ", g_windows_.size()) ;
-					#endif
-
-				}
-			}
-		}
-
-	public :
-		static void QuitProgram() noexcept {
-			std::vector<HWND> destroy_sequence ;
-			destroy_sequence.reserve(g_windows_.size()) ;
-			for (auto& w : g_windows_) {
-				destroy_sequence.push_back(w.first) ;
-			}
-
-			for (auto& w : destroy_sequence) {
-				if (IsWindow(w)) {
-					DestroyWindow(w) ;
-				}
-			}
-
-			g_windows_.clear() ;
-			g_is_running_ = false ;
-			PostQuitMessage(0) ;
-
-			#ifdef APPLICATION_DEBUG
-				logger::info("Application::QuitProgram - PostQuitMessage done.") ;
-			#endif
-		}
-
-		static void SetWindowClass(const std::string_view& class_name) noexcept {
-			if (g_class_name_was_registered_) {
-
-				#ifdef APPREGISTRY_DEBUG
-					logger::warning("AppRegistry::SetWindowClass - Failed to register window class name, window class name was registered.") ;
-				#endif
-
-				return ;
-			} 
-			g_class_name_ = class_name ;
-		}
-
-		static void RegisterWindowClass() {
-			if (g_class_name_was_registered_) {
-
-				#ifdef APPREGISTRY_DEBUG
-					logger::warning("AppRegistry::RegisterWindowClass - Failed to register window class name, window class name was registered.") ;
-				#endif
-
-				return ;
-			}
-
-			WNDCLASSEX wc = {
-				sizeof(wc),
-				CS_HREDRAW | CS_VREDRAW | CS_OWNDC,
-				WindowProcedure,
-				0,
-				0,
-				g_hinstance_,
-				LoadIcon(nullptr, IDI_APPLICATION),
-				LoadCursor(nullptr, IDC_ARROW),
-				nullptr,
-				nullptr,
-				g_class_name_.c_str(),
-				LoadIcon(nullptr, IDI_APPLICATION)
-			} ;
-
-			if (!RegisterClassEx(&wc)) {
-
-				#ifdef APPREGISTRY_DEBUG
-					logger::error("AppRegistry::RegisterWindowClass - Failed to register window class!") ;
-				#endif
-
-				return ;
-			}
-
-			#ifdef APPREGISTRY_DEBUG
-				logger::info("AppRegistry::RegisterWindowClass - Successfully register window class.") ;
-			#endif
-
-			g_class_name_was_registered_ = true ;
-			g_is_running_ = true ;
-		}
-
-		static bool IsRunning() noexcept {
-			return g_is_running_ ;
-		}
-	} ;
-
-	const Window* Event::GetContext() const noexcept {
-		auto it = Application::g_windows_.find(handle_) ;
-		if (it != Application::g_windows_.end()) {
-			return it->second ;
-		}
-		return nullptr ;
-	}
+#pragma once
+
+#include "eventsystem.hpp"
+#include "slotmap.hpp"
+
+namespace zz {
+	struct WindowSlot {
+		WindowHandle handle = nullptr ;
+		Window* window = nullptr ;
+	} ;
+
+	class Application {
+		friend class Event ;
+		
+	protected :
+		static inline bool g_is_running_ = false ;
+		static inline SlotMap<WindowSlot> g_windows_ {} ;
+		static inline std::string g_class_name_ = "zketch_app" ;
+		static inline bool g_class_name_was_registered_ = false ;
+		static inline uint64_t g_window_epoch_ = 0 ;	// naik tiap window masuk/keluar, cache handle -> slot di luar jadi basi
+		static inline std::unordered_map<WindowHandle, SlotHandle> g_slots_ {} ;	// handle -> slot tanpa lewat backend
+
+		// slot handle juga disimpan di window native oleh backend (untuk WndProc), sisi aplikasi memakai g_slots_
+		static SlotHandle RegisterWindow(WindowHandle handle, Window* window) {
+			if (!handle || !window) {
+				throw !handle ? Ex::application("Window handle is Null!") : Ex::application("Window is Null!") ;
+			}
+
+			const SlotHandle slot = g_windows_.Insert(WindowSlot{handle, window}) ;
+			GetBackend().BindSlot(handle, slot) ;
+			g_slots_[handle] = slot ;
+			++g_window_epoch_ ;
+			return slot ;
+		}
+
+		static void UnregisterWindow(SlotHandle slot) noexcept {
+			if (const WindowSlot* entry = g_windows_.Get(slot)) {
+				if (GetBackend().IsAlive(entry->handle)) {
+					GetBackend().BindSlot(entry->handle, SlotHandle{}) ;
+				}
+				g_slots_.erase(entry->handle) ;
+				g_windows_.Erase(slot) ;
+				++g_window_epoch_ ;
+
+				#ifdef APPLICATION_DEBUG
+					logger::info("Application::UnRegisterWindow - Erased window from g_windows_, current size: ", g_windows_.Size()) ;
+				#endif
+
+			}
+		}
+
+		// dipanggil saat objek Window pindah, slot tetap sama hanya pointernya yang diganti
+		static void RebindWindow(SlotHandle slot, Window* window) noexcept {
+			if (WindowSlot* entry = g_windows_.Get(slot)) {
+				entry->window = window ;
+			}
+		}
+
+	public :
+		static void QuitProgram() noexcept {
+			std::vector<WindowHandle> destroy_sequence ;
+			destroy_sequence.reserve(g_windows_.Size()) ;
+			g_windows_.ForEach([&destroy_sequence](SlotHandle, const WindowSlot& w) {
+				destroy_sequence.push_back(w.handle) ;
+			}) ;
+
+			for (auto& w : destroy_sequence) {
+				GetBackend().Destroy(w) ;
+			}
+
+			g_windows_.Clear() ;
+			g_slots_.clear() ;
+			++g_window_epoch_ ;
+			g_is_running_ = false ;
+			GetBackend().Quit() ;
+
+			#ifdef APPLICATION_DEBUG
+				logger::info("Application::QuitProgram - Backend quit done.") ;
+			#endif
+		}
+
+		static void SetWindowClass(const std::string_view& class_name) noexcept {
+			if (g_class_name_was_registered_) {
+
+				#ifdef APPREGISTRY_DEBUG
+					logger::warning("AppRegistry::SetWindowClass - Failed to register window class name, window class name was registered.") ;
+				#endif
+
+				return ;
+			} 
+			g_class_name_ = class_name ;
+		}
+
+		static void RegisterWindowClass() {
+			if (g_class_name_was_registered_) {
+
+				#ifdef APPREGISTRY_DEBUG
+					logger::warning("AppRegistry::RegisterWindowClass - Failed to register window class name, window class name was registered.") ;
+				#endif
+
+				return ;
+			}
+
+			if (!GetBackend().Initialize(g_class_name_)) {
+
+				#ifdef APPREGISTRY_DEBUG
+					logger::error("AppRegistry::RegisterWindowClass - Failed to register window class!") ;
+				#endif
+
+				return ;
+			}
+
+			#ifdef APPREGISTRY_DEBUG
+				logger::info("AppRegistry::RegisterWindowClass - Successfully register window class.") ;
+			#endif
+
+			g_class_name_was_registered_ = true ;
+			g_is_running_ = true ;
+		}
+
+		static void Wakeup() noexcept {
+			EventSys::Wakeup() ;
+		}
+
+		// backend harus dipasang sebelum RegisterWindowClass, default-nya Win32 di Windows dan headless di platform lain
+		static void SetBackend(Backend& backend) noexcept {
+			EventSys::SetBackend(backend) ;
+		}
+
+		static Backend& GetBackend() noexcept {
+			return EventSys::GetBackend() ;
+		}
+
+		// handle basi (window sudah di-unregister) menghasilkan SlotHandle invalid. satu lookup hash, tanpa panggilan
+		// virtual ke backend
+		static SlotHandle GetWindowSlot(WindowHandle handle) noexcept {
+			const auto it = g_slots_.find(handle) ;
+			return it == g_slots_.end() ? SlotHandle{} : it->second ;
+		}
+
+		// tanpa lewat backend: true kalau slot masih milik window dengan handle ini
+		static bool IsWindow(SlotHandle slot, WindowHandle handle) noexcept {
+			const WindowSlot* entry = g_windows_.Get(slot) ;
+			return entry && entry->handle == handle ;
+		}
+
+		static uint64_t GetWindowEpoch() noexcept {
+			return g_window_epoch_ ;
+		}
+
+		static Window* LookupWindow(SlotHandle slot) noexcept {
+			const WindowSlot* entry = g_windows_.Get(slot) ;
+			return entry ? entry->window : nullptr ;
+		}
+
+		static Window* LookupWindow(WindowHandle handle) noexcept {
+			return LookupWindow(GetWindowSlot(handle)) ;
+		}
+
+		static size_t GetWindowCount() noexcept {
+			return g_windows_.Size() ;
+		}
+
+		static bool IsRunning() noexcept {
+			return g_is_running_ ;
+		}
+	} ;
+
+	const Window* Event::GetContext() const noexcept {
+		return Application::LookupWindow(handle_) ;
+	}
 }
\ No newline at end of file
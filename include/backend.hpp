@@ -0,0 +1,58 @@
+#pragma once
+
+#include "event.hpp"
+#include "geometry.hpp"
+#include "slotmap.hpp"
+#include "waiter.hpp"
+
+namespace zz {
+
+	// semua akses ke sistem window native lewat interface ini, Application/Window/EventSys tidak memanggil API OS langsung
+	class Backend {
+	public :
+		using EventSink = bool (*)(const Event&) ;
+
+		static constexpr int DefaultPosition = static_cast<int>(0x80000000) ; // sama dengan CW_USEDEFAULT
+
+	protected :
+		EventSink sink_ = nullptr ;
+
+		// event hasil terjemahan input native dikirim ke EventSys lewat sink
+		bool Emit(const Event& event) noexcept {
+			return sink_ ? sink_(event) : false ;
+		}
+
+	public :
+		Backend() noexcept = default ;
+		Backend(const Backend&) = delete ;
+		Backend& operator=(const Backend&) = delete ;
+		virtual ~Backend() noexcept = default ;
+
+		void SetSink(EventSink sink) noexcept { sink_ = sink ; }
+
+		virtual bool Initialize(std::string_view class_name) noexcept = 0 ;
+
+		virtual WindowHandle Create(const char* title, const Rect<int>& bounds, WindowStyle style) noexcept = 0 ;
+		virtual void Destroy(WindowHandle handle) noexcept = 0 ;
+		virtual bool IsAlive(WindowHandle handle) const noexcept = 0 ;
+		virtual bool Show(WindowHandle handle, WindowShowMode mode) noexcept = 0 ;
+		virtual void SetTitle(WindowHandle handle, const char* title) noexcept = 0 ;
+		virtual Rect<int> GetClientBound(WindowHandle handle) const noexcept = 0 ;
+		virtual Rect<int> GetWindowBound(WindowHandle handle) const noexcept = 0 ;
+
+		// piksel Color (byte r, g, b, a) dengan stride dalam satuan piksel, ditampilkan di client area mulai (0, 0).
+		// hanya area di rects (koordinat surface, tidak tumpang tindih) yang dikirim ke layar.
+		// backend membaca langsung dari buffer pemanggil bila bisa, tanpa salinan perantara
+		virtual bool Present(WindowHandle handle, const Color* pixels, const Size<int>& size, size_t stride, std::span<const Rect<int>> rects) noexcept = 0 ;
+
+		// slot registry disimpan di window native supaya lookup dari handle tidak perlu hashing
+		virtual void BindSlot(WindowHandle handle, SlotHandle slot) noexcept = 0 ;
+		virtual SlotHandle GetSlot(WindowHandle handle) const noexcept = 0 ;
+
+		// ambil semua input yang tertunda dan kirim lewat Emit, tidak pernah blocking
+		virtual void Pump() noexcept = 0 ;
+		virtual WaitResult Wait(uint32_t timeout_ms) noexcept = 0 ;
+		virtual void Wake() noexcept = 0 ;
+		virtual void Quit() noexcept = 0 ;
+	} ;
+}
\ No newline at end of file
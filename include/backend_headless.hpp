@@ -0,0 +1,270 @@
+#pragma once
+
+#include "backend.hpp"
+
+namespace zz {
+
+	// backend in-memory tanpa display: window virtual dan input yang di-inject, untuk test dan benchmark di server
+	class HeadlessBackend : public Backend {
+	private :
+		struct VirtualWindow {
+			std::string title {} ;
+			Rect<int> bounds {} ;
+			WindowStyle style = WindowStyle::Basic ;
+			WindowShowMode mode = WindowShowMode::Hidden ;
+			SlotHandle slot {} ;
+			std::vector<Color> frame {} ;
+			Size<int> frame_size {} ;
+			uint64_t presents = 0 ;
+			uint64_t presented_area = 0 ;	// piksel yang disalin pada present terakhir
+			bool alive = false ;
+		} ;
+
+		std::vector<VirtualWindow> windows_ {} ;
+		std::vector<Event> pending_ {} ;
+		std::vector<Event> pumping_ {} ;
+		mutable std::mutex mutex_ {} ;
+		CondWaiter waiter_ {} ;
+		bool initialized_ = false ;
+		bool quit_ = false ;
+
+		// handle = index + 1, jadi nullptr tidak pernah valid
+		VirtualWindow* find(WindowHandle handle) noexcept {
+			const uintptr_t index = reinterpret_cast<uintptr_t>(handle) - 1 ;
+			return index < windows_.size() && windows_[index].alive ? &windows_[index] : nullptr ;
+		}
+
+		const VirtualWindow* find(WindowHandle handle) const noexcept {
+			return const_cast<HeadlessBackend*>(this)->find(handle) ;
+		}
+
+	public :
+		bool Initialize(std::string_view) noexcept override {
+			initialized_ = true ;
+			return true ;
+		}
+
+		WindowHandle Create(const char* title, const Rect<int>& bounds, WindowStyle style) noexcept override {
+			VirtualWindow window {} ;
+			window.title = title ? title : "" ;
+			window.bounds = Rect<int>{
+				bounds.GetPoint().x == DefaultPosition ? 0 : bounds.GetPoint().x,
+				bounds.GetPoint().y == DefaultPosition ? 0 : bounds.GetPoint().y,
+				bounds.GetSize().w,
+				bounds.GetSize().h
+			} ;
+			window.style = style ;
+			window.alive = true ;
+
+			std::lock_guard lock(mutex_) ;
+			windows_.push_back(std::move(window)) ;
+			return reinterpret_cast<WindowHandle>(static_cast<uintptr_t>(windows_.size())) ;
+		}
+
+		void Destroy(WindowHandle handle) noexcept override {
+			std::lock_guard lock(mutex_) ;
+			if (VirtualWindow* window = find(handle)) {
+				window->alive = false ;
+				window->slot = SlotHandle{} ;
+			}
+		}
+
+		bool IsAlive(WindowHandle handle) const noexcept override {
+			std::lock_guard lock(mutex_) ;
+			return find(handle) != nullptr ;
+		}
+
+		// seperti Win32, tampil pertama kali menghasilkan event Resize dengan ukuran client
+		bool Show(WindowHandle handle, WindowShowMode mode) noexcept override {
+			Size<int> size {} ;
+			bool first_show = false ;
+			{
+				std::lock_guard lock(mutex_) ;
+				VirtualWindow* window = find(handle) ;
+				if (!window) {
+					return false ;
+				}
+
+				first_show = window->mode == WindowShowMode::Hidden && mode != WindowShowMode::Hidden ;
+				window->mode = mode ;
+				size = window->bounds.GetSize() ;
+			}
+
+			if (first_show) {
+				Inject(Event{handle, WindowEvent{WindowState::Resize, size}}) ;
+			}
+			return true ;
+		}
+
+		void SetTitle(WindowHandle handle, const char* title) noexcept override {
+			std::lock_guard lock(mutex_) ;
+			if (VirtualWindow* window = find(handle)) {
+				window->title = title ? title : "" ;
+			}
+		}
+
+		Rect<int> GetClientBound(WindowHandle handle) const noexcept override {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? Rect<int>{0, 0, window->bounds.GetSize().w, window->bounds.GetSize().h} : Rect<int>{} ;
+		}
+
+		Rect<int> GetWindowBound(WindowHandle handle) const noexcept override {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? window->bounds : Rect<int>{} ;
+		}
+
+		void BindSlot(WindowHandle handle, SlotHandle slot) noexcept override {
+			std::lock_guard lock(mutex_) ;
+			if (VirtualWindow* window = find(handle)) {
+				window->slot = slot ;
+			}
+		}
+
+		SlotHandle GetSlot(WindowHandle handle) const noexcept override {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? window->slot : SlotHandle{} ;
+		}
+
+		// tidak ada layar, frame disalin rapat (tanpa padding stride) supaya bisa diperiksa test.
+		// hanya rects yang disalin, sisa frame tetap isi present sebelumnya seperti layar sungguhan
+		bool Present(WindowHandle handle, const Color* pixels, const Size<int>& size, size_t stride, std::span<const Rect<int>> rects) noexcept override {
+			std::lock_guard lock(mutex_) ;
+			VirtualWindow* window = find(handle) ;
+			if (!window) {
+				return false ;
+			}
+
+			try {
+				window->frame.resize(static_cast<size_t>(size.w) * size.h) ;
+			} catch (...) {
+				return false ;
+			}
+
+			uint64_t area = 0 ;
+			for (const Rect<int>& rect : rects) {
+				const Rect<int> r = Intersect(rect, Rect<int>(0, 0, size.w, size.h)) ;
+				if (IsEmpty(r)) {
+					continue ;
+				}
+
+				const size_t x = static_cast<size_t>(r.GetPoint().x) ;
+				for (size_t y = static_cast<size_t>(r.GetPoint().y) ; y < static_cast<size_t>(Bottom(r)) ; ++y) {
+					std::copy_n(pixels + y * stride + x, r.GetSize().w, window->frame.data() + y * size.w + x) ;
+				}
+				area += static_cast<uint64_t>(r.GetSize().w) * r.GetSize().h ;
+			}
+			window->frame_size = size ;
+			window->presented_area = area ;
+			++window->presents ;
+			return true ;
+		}
+
+		void Pump() noexcept override {
+			{
+				std::lock_guard lock(mutex_) ;
+				pumping_.swap(pending_) ;
+			}
+
+			for (const Event& e : pumping_) {
+				Emit(e) ;
+			}
+			pumping_.clear() ;
+		}
+
+		WaitResult Wait(uint32_t timeout_ms) noexcept override {
+			{
+				std::lock_guard lock(mutex_) ;
+				if (!pending_.empty()) {
+					return WaitResult::Input ;
+				}
+			}
+			return waiter_.Wait(timeout_ms) ;
+		}
+
+		void Wake() noexcept override {
+			waiter_.Notify() ;
+		}
+
+		void Quit() noexcept override {
+			quit_ = true ;
+			Wake() ;
+		}
+
+		// input palsu, aman dari thread manapun. dikirim ke EventSys pada Pump berikutnya
+		void Inject(const Event& event) {
+			{
+				std::lock_guard lock(mutex_) ;
+				pending_.push_back(event) ;
+			}
+			waiter_.Notify() ;
+		}
+
+		template <Arithmetic type>
+		void InjectMouse(WindowHandle handle, MouseState state, MouseButton button, const Point<type>& value) {
+			Inject(Event{handle, MouseEvent{state, button, value}}) ;
+		}
+
+		void InjectKey(WindowHandle handle, KeyState state, KeyCode code) {
+			Inject(Event{handle, KeyEvent{state, code}}) ;
+		}
+
+		template <Arithmetic type>
+		void InjectResize(WindowHandle handle, const Size<type>& size) {
+			{
+				std::lock_guard lock(mutex_) ;
+				VirtualWindow* window = find(handle) ;
+				if (!window) {
+					return ;
+				}
+				window->bounds = Rect<int>{window->bounds.GetPoint(), Size<int>{size}} ;
+			}
+			Inject(Event{handle, WindowEvent{WindowState::Resize, size}}) ;
+		}
+
+		void InjectClose(WindowHandle handle) {
+			Inject(Event{handle, WindowEvent{WindowState::Close, Size<uint16_t>{}}}) ;
+		}
+
+		bool IsQuitRequested() const noexcept { return quit_ ; }
+		bool IsInitialized() const noexcept { return initialized_ ; }
+
+		std::string GetTitle(WindowHandle handle) const {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? window->title : std::string{} ;
+		}
+
+		std::vector<Color> GetFrame(WindowHandle handle) const {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? window->frame : std::vector<Color>{} ;
+		}
+
+		Size<int> GetFrameSize(WindowHandle handle) const noexcept {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? window->frame_size : Size<int>{} ;
+		}
+
+		uint64_t GetPresentCount(WindowHandle handle) const noexcept {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? window->presents : 0 ;
+		}
+
+		uint64_t GetPresentedArea(WindowHandle handle) const noexcept {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? window->presented_area : 0 ;
+		}
+
+		WindowShowMode GetShowMode(WindowHandle handle) const noexcept {
+			std::lock_guard lock(mutex_) ;
+			const VirtualWindow* window = find(handle) ;
+			return window ? window->mode : WindowShowMode::Hidden ;
+		}
+	} ;
+}
\ No newline at end of file
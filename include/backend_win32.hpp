@@ -0,0 +1,260 @@
+#pragma once
+
+#include "backend.hpp"
+
+#ifdef _WIN32
+
+namespace zz {
+
+	class Win32Backend : public Backend {
+	private :
+		static inline Win32Backend* g_instance_ = nullptr ;	// WindowProcedure tidak punya this
+
+		HINSTANCE hinstance_ = GetModuleHandleW(nullptr) ;
+		std::string class_name_ {} ;
+		bool registered_ = false ;
+		Win32Waiter waiter_ {} ;
+
+		static Event CreateEventFromMSG(const MSG& msg) noexcept {
+			const Point<int> pos {GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)} ;
+			const float wheel = static_cast<float>(GET_WHEEL_DELTA_WPARAM(msg.wParam)) / WHEEL_DELTA ;
+
+			switch (msg.message) {
+				case WM_LBUTTONDOWN :
+					return Event{msg.hwnd, MouseEvent{MouseState::Down, MouseButton::Left, pos}} ;
+				case WM_RBUTTONDOWN :
+					return Event{msg.hwnd, MouseEvent{MouseState::Down, MouseButton::Right, pos}} ;
+				case WM_MBUTTONDOWN :
+					return Event{msg.hwnd, MouseEvent{MouseState::Down, MouseButton::Middle, pos}} ;
+				case WM_LBUTTONUP :
+					return Event{msg.hwnd, MouseEvent{MouseState::Up, MouseButton::Left, pos}} ;
+				case WM_RBUTTONUP :
+					return Event{msg.hwnd, MouseEvent{MouseState::Up, MouseButton::Right, pos}} ;
+				case WM_MBUTTONUP :
+					return Event{msg.hwnd, MouseEvent{MouseState::Up, MouseButton::Middle, pos}} ;
+				case WM_MOUSEWHEEL :
+					return Event{msg.hwnd, MouseEvent{MouseState::Wheel, MouseButton::None, Point<float>{0.0f, wheel}}} ;
+				case WM_MOUSEHWHEEL :
+					return Event{msg.hwnd, MouseEvent{MouseState::Wheel, MouseButton::None, Point<float>{wheel, 0.0f}}} ;
+				case WM_MOUSEMOVE :
+					return Event{msg.hwnd, MouseEvent{MouseState::Move, MouseButton::None, pos}} ;
+				case WM_LBUTTONDBLCLK :
+					return Event{msg.hwnd, MouseEvent{MouseState::DoubleClick, MouseButton::Left, pos}} ;
+				case WM_RBUTTONDBLCLK :
+					return Event{msg.hwnd, MouseEvent{MouseState::DoubleClick, MouseButton::Right, pos}} ;
+				case WM_MBUTTONDBLCLK :
+					return Event{msg.hwnd, MouseEvent{MouseState::DoubleClick, MouseButton::Middle, pos}} ;
+				case WM_MOUSEHOVER :
+					return Event{msg.hwnd, MouseEvent{MouseState::Hover, MouseButton::None, pos}} ;
+				case WM_KEYDOWN :
+					return Event{msg.hwnd, KeyEvent{KeyState::Down, static_cast<KeyCode>(msg.wParam)}} ;
+				case WM_KEYUP :
+					return Event{msg.hwnd, KeyEvent{KeyState::Up, static_cast<KeyCode>(msg.wParam)}} ;
+			}
+
+			return Event{} ;
+		}
+
+		static LRESULT CALLBACK procedure(HWND handle, UINT message, WPARAM wparam, LPARAM lparam) noexcept {
+			Win32Backend* self = g_instance_ ;
+			switch (message) {
+				case WM_SIZE :
+					if (self) {
+						self->Emit(Event{handle, WindowEvent{WindowState::Resize, Size{LOWORD(lparam), HIWORD(lparam)}}}) ;
+					}
+					break ;
+				// tanpa CS_HREDRAW/CS_VREDRAW OS hanya meminta area yang benar-benar rusak
+				case WM_PAINT : {
+					PAINTSTRUCT ps {} ;
+					BeginPaint(handle, &ps) ;
+					EndPaint(handle, &ps) ;
+					if (self && ps.rcPaint.right > ps.rcPaint.left && ps.rcPaint.bottom > ps.rcPaint.top) {
+						self->Emit(Event{handle, WindowEvent{WindowState::Paint, to_rect(ps.rcPaint)}}) ;
+					}
+					return 0 ;
+				}
+				case WM_CLOSE :
+					if (self) {
+						self->Emit(Event{handle, WindowEvent{WindowState::Close, Size<uint16_t>{}}}) ;
+					}
+					return 0 ;
+
+				case WM_DESTROY :
+					return 0 ;
+			}
+
+			return DefWindowProc(handle, message, wparam, lparam) ;
+		}
+
+		static Rect<int> to_rect(const tagRECT& r) noexcept {
+			return Rect<int>{r} ;
+		}
+
+	public :
+		~Win32Backend() noexcept override {
+			if (g_instance_ == this) {
+				g_instance_ = nullptr ;
+			}
+		}
+
+		bool Initialize(std::string_view class_name) noexcept override {
+			if (registered_) {
+				return true ;
+			}
+
+			class_name_ = class_name ;
+			WNDCLASSEX wc = {
+				sizeof(wc),
+				CS_OWNDC,
+				procedure,
+				0,
+				0,
+				hinstance_,
+				LoadIcon(nullptr, IDI_APPLICATION),
+				LoadCursor(nullptr, IDC_ARROW),
+				nullptr,
+				nullptr,
+				class_name_.c_str(),
+				LoadIcon(nullptr, IDI_APPLICATION)
+			} ;
+
+			if (!RegisterClassEx(&wc)) {
+				return false ;
+			}
+
+			g_instance_ = this ;
+			registered_ = true ;
+			return true ;
+		}
+
+		WindowHandle Create(const char* title, const Rect<int>& bounds, WindowStyle style) noexcept override {
+			return CreateWindowEx(
+				0,
+				class_name_.c_str(),
+				title,
+				static_cast<uint32_t>(style),
+				bounds.GetPoint().x,
+				bounds.GetPoint().y,
+				static_cast<int>(bounds.GetSize().w),
+				static_cast<int>(bounds.GetSize().h),
+				nullptr,
+				nullptr,
+				hinstance_,
+				nullptr
+			) ;
+		}
+
+		void Destroy(WindowHandle handle) noexcept override {
+			if (IsWindow(handle)) {
+				SetWindowLongPtr(handle, GWLP_USERDATA, 0) ;
+				DestroyWindow(handle) ;
+			}
+		}
+
+		bool IsAlive(WindowHandle handle) const noexcept override {
+			return handle && IsWindow(handle) ;
+		}
+
+		bool Show(WindowHandle handle, WindowShowMode mode) noexcept override {
+			ShowWindow(handle, static_cast<uint8_t>(mode)) ;
+			return mode != WindowShowMode::Show || UpdateWindow(handle) ;
+		}
+
+		void SetTitle(WindowHandle handle, const char* title) noexcept override {
+			SetWindowText(handle, title) ;
+		}
+
+		Rect<int> GetClientBound(WindowHandle handle) const noexcept override {
+			tagRECT r {} ;
+			GetClientRect(handle, &r) ;
+			return to_rect(r) ;
+		}
+
+		Rect<int> GetWindowBound(WindowHandle handle) const noexcept override {
+			tagRECT r {} ;
+			GetWindowRect(handle, &r) ;
+			return to_rect(r) ;
+		}
+
+		// zero-copy: SetDIBitsToDevice membaca buffer surface langsung. mask BI_BITFIELDS mengikuti urutan byte Color
+		// (r di byte terendah), biWidth = stride dan tinggi negatif untuk DIB top-down. tiap rect dikirim sebagai DIB
+		// yang dimulai di baris atasnya, jadi ySrc/StartScan selalu 0. CS_OWNDC membuat GetDC murah
+		bool Present(WindowHandle handle, const Color* pixels, const Size<int>& size, size_t stride, std::span<const Rect<int>> rects) noexcept override {
+			struct {
+				BITMAPINFOHEADER header ;
+				DWORD masks[3] ;
+			} info {} ;
+
+			info.header.biSize = sizeof(BITMAPINFOHEADER) ;
+			info.header.biWidth = static_cast<LONG>(stride) ;
+			info.header.biPlanes = 1 ;
+			info.header.biBitCount = 32 ;
+			info.header.biCompression = BI_BITFIELDS ;
+			info.masks[0] = 0x000000FF ;
+			info.masks[1] = 0x0000FF00 ;
+			info.masks[2] = 0x00FF0000 ;
+
+			HDC dc = GetDC(handle) ;
+			if (!dc) {
+				return false ;
+			}
+
+			bool ok = true ;
+			for (const Rect<int>& rect : rects) {
+				const Rect<int> r = Intersect(rect, Rect<int>(0, 0, size.w, size.h)) ;
+				if (IsEmpty(r)) {
+					continue ;
+				}
+
+				const int x = r.GetPoint().x ;
+				const int y = r.GetPoint().y ;
+				const int w = static_cast<int>(r.GetSize().w) ;
+				const int h = static_cast<int>(r.GetSize().h) ;
+				info.header.biHeight = -h ;
+				const int lines = SetDIBitsToDevice(dc, x, y, w, h, x, 0, 0, h, pixels + static_cast<size_t>(y) * stride, reinterpret_cast<const BITMAPINFO*>(&info), DIB_RGB_COLORS) ;
+				ok &= lines == h ;
+			}
+			ReleaseDC(handle, dc) ;
+			return ok ;
+		}
+
+		// slot handle disimpan di GWLP_USERDATA, jadi lookup dari HWND cukup satu index tanpa hashing
+		void BindSlot(WindowHandle handle, SlotHandle slot) noexcept override {
+			if (IsWindow(handle)) {
+				SetWindowLongPtr(handle, GWLP_USERDATA, static_cast<LONG_PTR>(slot.Pack())) ;
+			}
+		}
+
+		SlotHandle GetSlot(WindowHandle handle) const noexcept override {
+			return SlotHandle::Unpack(static_cast<uint64_t>(GetWindowLongPtr(handle, GWLP_USERDATA))) ;
+		}
+
+		void Pump() noexcept override {
+			MSG msg{} ;
+			while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
+				const Event created = CreateEventFromMSG(msg) ;
+
+				if (created.GetType() != EventType::None) {
+					Emit(created) ;
+				}
+
+				TranslateMessage(&msg) ;
+				DispatchMessage(&msg) ;
+			}
+		}
+
+		WaitResult Wait(uint32_t timeout_ms) noexcept override {
+			return waiter_.Wait(timeout_ms) ;
+		}
+
+		void Wake() noexcept override {
+			waiter_.Notify() ;
+		}
+
+		void Quit() noexcept override {
+			PostQuitMessage(0) ;
+		}
+	} ;
+}
+
+#endif
\ No newline at end of file
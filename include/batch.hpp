@@ -0,0 +1,533 @@
+#pragma once
+
+#include "unit.hpp"
+#include "simd.hpp"
+
+namespace zz {
+
+	// kernel atas array datar dengan pola 4 lane yang berulang: Rect = {x, y, w, h}, Point = {x, y, x, y}
+	// level SIMD dipilih saat runtime lewat Simd::GetLevel(), sisa elemen yang tidak genap 4 selalu lewat jalur scalar
+	class Kernel {
+	public :
+		using F32x4 = std::array<float, 4> ;
+		using I32x4 = std::array<int32_t, 4> ;
+
+	private :
+		// pola lane ditulis eksplisit per grup 4 supaya compiler bisa memvektorkan jalur scalar, p[i & 3] di dalam
+		// loop menghalanginya. begin selalu kelipatan 4 (hasil kernel SIMD), sisa < 4 elemen lewat loop terakhir
+		template <typename fn>
+		static void for_lanes(size_t begin, size_t n, fn&& op) noexcept {
+			size_t i = begin ;
+			for ( ; i + 4 <= n ; i += 4) {
+				op(i, 0) ;
+				op(i + 1, 1) ;
+				op(i + 2, 2) ;
+				op(i + 3, 3) ;
+			}
+			for ( ; i < n ; ++i) {
+				op(i, i & 3) ;
+			}
+		}
+
+		static void add_scalar(float* data, size_t begin, size_t n, const F32x4& p) noexcept {
+			for_lanes(begin, n, [data, &p](size_t i, size_t lane) { data[i] += p[lane] ; }) ;
+		}
+
+		static void mul_scalar(float* data, size_t begin, size_t n, const F32x4& p) noexcept {
+			for_lanes(begin, n, [data, &p](size_t i, size_t lane) { data[i] *= p[lane] ; }) ;
+		}
+
+		// urutan perbandingan sama dengan maxps/minps, jadi NaN menghasilkan nilai yang sama di semua level
+		static void clamp_scalar(float* data, size_t begin, size_t n, const F32x4& lo, const F32x4& hi) noexcept {
+			for_lanes(begin, n, [data, &lo, &hi](size_t i, size_t lane) {
+				const float v = data[i] > lo[lane] ? data[i] : lo[lane] ;
+				data[i] = v < hi[lane] ? v : hi[lane] ;
+			}) ;
+		}
+
+		// lewat uint32_t supaya overflow wrap seperti paddd, bukan UB
+		static void add_scalar(int32_t* data, size_t begin, size_t n, const I32x4& p) noexcept {
+			for_lanes(begin, n, [data, &p](size_t i, size_t lane) {
+				data[i] = static_cast<int32_t>(static_cast<uint32_t>(data[i]) + static_cast<uint32_t>(p[lane])) ;
+			}) ;
+		}
+
+		// hasil kali 64-bit lalu digeser aritmatika (floor), sama persis dengan Fixed::operator*
+		static void mul_fixed_scalar(int32_t* data, size_t begin, size_t n, const I32x4& p, int shift) noexcept {
+			for_lanes(begin, n, [data, &p, shift](size_t i, size_t lane) {
+				data[i] = static_cast<int32_t>((static_cast<int64_t>(data[i]) * p[lane]) >> shift) ;
+			}) ;
+		}
+
+		static void shift_scalar(const int32_t* src, int32_t* dst, size_t begin, size_t n, int shift) noexcept {
+			for (size_t i = begin ; i < n ; ++i) {
+				dst[i] = src[i] >> shift ;
+			}
+		}
+
+		static void convert_scalar(const int32_t* src, float* dst, size_t begin, size_t n) noexcept {
+			for (size_t i = begin ; i < n ; ++i) {
+				dst[i] = static_cast<float>(src[i]) ;
+			}
+		}
+
+		// di luar range int32 (dan NaN) menghasilkan INT32_MIN seperti cvttps2dq
+		static void convert_scalar(const float* src, int32_t* dst, size_t begin, size_t n) noexcept {
+			for (size_t i = begin ; i < n ; ++i) {
+				dst[i] = src[i] >= -2147483648.0f && src[i] < 2147483648.0f ? static_cast<int32_t>(src[i]) : std::numeric_limits<int32_t>::min() ;
+			}
+		}
+
+		#ifdef ZZ_SIMD_X86
+			static size_t add_sse2(float* data, size_t n, const F32x4& p) noexcept {
+				const __m128 v = _mm_loadu_ps(p.data()) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					_mm_storeu_ps(data + i, _mm_add_ps(_mm_loadu_ps(data + i), v)) ;
+				}
+				return i ;
+			}
+
+			static size_t mul_sse2(float* data, size_t n, const F32x4& p) noexcept {
+				const __m128 v = _mm_loadu_ps(p.data()) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					_mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), v)) ;
+				}
+				return i ;
+			}
+
+			static size_t clamp_sse2(float* data, size_t n, const F32x4& lo, const F32x4& hi) noexcept {
+				const __m128 l = _mm_loadu_ps(lo.data()) ;
+				const __m128 h = _mm_loadu_ps(hi.data()) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					_mm_storeu_ps(data + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(data + i), l), h)) ;
+				}
+				return i ;
+			}
+
+			static size_t add_sse2(int32_t* data, size_t n, const I32x4& p) noexcept {
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p.data())) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					__m128i* at = reinterpret_cast<__m128i*>(data + i) ;
+					_mm_storeu_si128(at, _mm_add_epi32(_mm_loadu_si128(at), v)) ;
+				}
+				return i ;
+			}
+
+			// SSE2 hanya punya perkalian unsigned (pmuludq). hasil unsigned dan signed hanya beda di 32 bit atas,
+			// jadi koreksinya (a < 0 ? b : 0) + (b < 0 ? a : 0) cukup dikurangkan setelah digeser
+			static size_t mul_fixed_sse2(int32_t* data, size_t n, const I32x4& p, int shift) noexcept {
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p.data())) ;
+				const __m128i b_odd = _mm_srli_epi64(b, 32) ;
+				const __m128i right = _mm_cvtsi32_si128(shift) ;
+				const __m128i left = _mm_cvtsi32_si128(32 - shift) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					__m128i* at = reinterpret_cast<__m128i*>(data + i) ;
+					const __m128i a = _mm_loadu_si128(at) ;
+					const __m128i even = _mm_srl_epi64(_mm_mul_epu32(a, b), right) ;
+					const __m128i odd = _mm_srl_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b_odd), right) ;
+					const __m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(3, 1, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(3, 1, 2, 0))) ;
+					const __m128i fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a)) ;
+					_mm_storeu_si128(at, _mm_sub_epi32(product, _mm_sll_epi32(fix, left))) ;
+				}
+				return i ;
+			}
+
+			static size_t shift_sse2(const int32_t* src, int32_t* dst, size_t n, int shift) noexcept {
+				const __m128i count = _mm_cvtsi32_si128(shift) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_sra_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), count)) ;
+				}
+				return i ;
+			}
+
+			static size_t convert_sse2(const int32_t* src, float* dst, size_t n) noexcept {
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					_mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)))) ;
+				}
+				return i ;
+			}
+
+			static size_t convert_sse2(const float* src, int32_t* dst, size_t n) noexcept {
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_cvttps_epi32(_mm_loadu_ps(src + i))) ;
+				}
+				return i ;
+			}
+
+			// 8 lane = pola 4 lane diulang dua kali, sisa 4 terakhir diteruskan ke SSE2
+			ZZ_TARGET_AVX2 static size_t add_avx2(float* data, size_t n, const F32x4& p) noexcept {
+				const __m256 v = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(p.data())) ;
+				size_t i = 0 ;
+				for ( ; i + 8 <= n ; i += 8) {
+					_mm256_storeu_ps(data + i, _mm256_add_ps(_mm256_loadu_ps(data + i), v)) ;
+				}
+				return i + add_sse2(data + i, n - i, p) ;
+			}
+
+			ZZ_TARGET_AVX2 static size_t mul_avx2(float* data, size_t n, const F32x4& p) noexcept {
+				const __m256 v = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(p.data())) ;
+				size_t i = 0 ;
+				for ( ; i + 8 <= n ; i += 8) {
+					_mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_loadu_ps(data + i), v)) ;
+				}
+				return i + mul_sse2(data + i, n - i, p) ;
+			}
+
+			ZZ_TARGET_AVX2 static size_t clamp_avx2(float* data, size_t n, const F32x4& lo, const F32x4& hi) noexcept {
+				const __m256 l = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lo.data())) ;
+				const __m256 h = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(hi.data())) ;
+				size_t i = 0 ;
+				for ( ; i + 8 <= n ; i += 8) {
+					_mm256_storeu_ps(data + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(data + i), l), h)) ;
+				}
+				return i + clamp_sse2(data + i, n - i, lo, hi) ;
+			}
+
+			ZZ_TARGET_AVX2 static size_t add_avx2(int32_t* data, size_t n, const I32x4& p) noexcept {
+				const __m256i v = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p.data()))) ;
+				size_t i = 0 ;
+				for ( ; i + 8 <= n ; i += 8) {
+					__m256i* at = reinterpret_cast<__m256i*>(data + i) ;
+					_mm256_storeu_si256(at, _mm256_add_epi32(_mm256_loadu_si256(at), v)) ;
+				}
+				return i + add_sse2(data + i, n - i, p) ;
+			}
+
+			// lane genap dan ganjil dikalikan terpisah (vpmuldq), lalu digabung lagi dengan blend
+			ZZ_TARGET_AVX2 static size_t mul_fixed_avx2(int32_t* data, size_t n, const I32x4& p, int shift) noexcept {
+				const __m256i b = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p.data()))) ;
+				const __m256i b_odd = _mm256_srli_epi64(b, 32) ;
+				const __m128i right = _mm_cvtsi32_si128(shift) ;
+				size_t i = 0 ;
+				for ( ; i + 8 <= n ; i += 8) {
+					__m256i* at = reinterpret_cast<__m256i*>(data + i) ;
+					const __m256i a = _mm256_loadu_si256(at) ;
+					const __m256i even = _mm256_srl_epi64(_mm256_mul_epi32(a, b), right) ;
+					const __m256i odd = _mm256_slli_epi64(_mm256_srl_epi64(_mm256_mul_epi32(_mm256_srli_epi64(a, 32), b_odd), right), 32) ;
+					_mm256_storeu_si256(at, _mm256_blend_epi32(even, odd, 0xAA)) ;
+				}
+				return i + mul_fixed_sse2(data + i, n - i, p, shift) ;
+			}
+
+			ZZ_TARGET_AVX2 static size_t shift_avx2(const int32_t* src, int32_t* dst, size_t n, int shift) noexcept {
+				const __m128i count = _mm_cvtsi32_si128(shift) ;
+				size_t i = 0 ;
+				for ( ; i + 8 <= n ; i += 8) {
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_sra_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), count)) ;
+				}
+				return i + shift_sse2(src + i, dst + i, n - i, shift) ;
+			}
+
+			ZZ_TARGET_AVX2 static size_t convert_avx2(const int32_t* src, float* dst, size_t n) noexcept {
+				size_t i = 0 ;
+				for ( ; i + 8 <= n ; i += 8) {
+					_mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)))) ;
+				}
+				return i + convert_sse2(src + i, dst + i, n - i) ;
+			}
+
+			ZZ_TARGET_AVX2 static size_t convert_avx2(const float* src, int32_t* dst, size_t n) noexcept {
+				size_t i = 0 ;
+				for ( ; i + 8 <= n ; i += 8) {
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvttps_epi32(_mm256_loadu_ps(src + i))) ;
+				}
+				return i + convert_sse2(src + i, dst + i, n - i) ;
+			}
+		#endif
+
+		#ifdef ZZ_SIMD_NEON
+			static size_t add_neon(float* data, size_t n, const F32x4& p) noexcept {
+				const float32x4_t v = vld1q_f32(p.data()) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					vst1q_f32(data + i, vaddq_f32(vld1q_f32(data + i), v)) ;
+				}
+				return i ;
+			}
+
+			static size_t mul_neon(float* data, size_t n, const F32x4& p) noexcept {
+				const float32x4_t v = vld1q_f32(p.data()) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					vst1q_f32(data + i, vmulq_f32(vld1q_f32(data + i), v)) ;
+				}
+				return i ;
+			}
+
+			static size_t clamp_neon(float* data, size_t n, const F32x4& lo, const F32x4& hi) noexcept {
+				const float32x4_t l = vld1q_f32(lo.data()) ;
+				const float32x4_t h = vld1q_f32(hi.data()) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					const float32x4_t v = vld1q_f32(data + i) ;
+					const float32x4_t t = vbslq_f32(vcgtq_f32(v, l), v, l) ;
+					vst1q_f32(data + i, vbslq_f32(vcltq_f32(t, h), t, h)) ;
+				}
+				return i ;
+			}
+
+			static size_t add_neon(int32_t* data, size_t n, const I32x4& p) noexcept {
+				const int32x4_t v = vld1q_s32(p.data()) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					vst1q_s32(data + i, vaddq_s32(vld1q_s32(data + i), v)) ;
+				}
+				return i ;
+			}
+
+			static size_t mul_fixed_neon(int32_t* data, size_t n, const I32x4& p, int shift) noexcept {
+				const int32x4_t b = vld1q_s32(p.data()) ;
+				const int64x2_t right = vdupq_n_s64(-shift) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					const int32x4_t a = vld1q_s32(data + i) ;
+					const int64x2_t lo = vshlq_s64(vmull_s32(vget_low_s32(a), vget_low_s32(b)), right) ;
+					const int64x2_t hi = vshlq_s64(vmull_s32(vget_high_s32(a), vget_high_s32(b)), right) ;
+					vst1q_s32(data + i, vcombine_s32(vmovn_s64(lo), vmovn_s64(hi))) ;
+				}
+				return i ;
+			}
+
+			static size_t shift_neon(const int32_t* src, int32_t* dst, size_t n, int shift) noexcept {
+				const int32x4_t count = vdupq_n_s32(-shift) ;
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					vst1q_s32(dst + i, vshlq_s32(vld1q_s32(src + i), count)) ;
+				}
+				return i ;
+			}
+
+			static size_t convert_neon(const int32_t* src, float* dst, size_t n) noexcept {
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					vst1q_f32(dst + i, vcvtq_f32_s32(vld1q_s32(src + i))) ;
+				}
+				return i ;
+			}
+
+			// vcvtq saturasi, berbeda dengan x86 hanya untuk nilai di luar range int32
+			static size_t convert_neon(const float* src, int32_t* dst, size_t n) noexcept {
+				size_t i = 0 ;
+				for ( ; i + 4 <= n ; i += 4) {
+					vst1q_s32(dst + i, vcvtq_s32_f32(vld1q_f32(src + i))) ;
+				}
+				return i ;
+			}
+		#endif
+
+	public :
+		static void Add(float* data, size_t n, const F32x4& pattern) noexcept {
+			size_t done = 0 ;
+			switch (Simd::GetLevel()) {
+				#ifdef ZZ_SIMD_X86
+					case SimdLevel::AVX2 : done = add_avx2(data, n, pattern) ; break ;
+					case SimdLevel::SSE2 : done = add_sse2(data, n, pattern) ; break ;
+				#endif
+				#ifdef ZZ_SIMD_NEON
+					case SimdLevel::NEON : done = add_neon(data, n, pattern) ; break ;
+				#endif
+				default : break ;
+			}
+			add_scalar(data, done, n, pattern) ;
+		}
+
+		static void Mul(float* data, size_t n, const F32x4& pattern) noexcept {
+			size_t done = 0 ;
+			switch (Simd::GetLevel()) {
+				#ifdef ZZ_SIMD_X86
+					case SimdLevel::AVX2 : done = mul_avx2(data, n, pattern) ; break ;
+					case SimdLevel::SSE2 : done = mul_sse2(data, n, pattern) ; break ;
+				#endif
+				#ifdef ZZ_SIMD_NEON
+					case SimdLevel::NEON : done = mul_neon(data, n, pattern) ; break ;
+				#endif
+				default : break ;
+			}
+			mul_scalar(data, done, n, pattern) ;
+		}
+
+		static void Clamp(float* data, size_t n, const F32x4& lo, const F32x4& hi) noexcept {
+			size_t done = 0 ;
+			switch (Simd::GetLevel()) {
+				#ifdef ZZ_SIMD_X86
+					case SimdLevel::AVX2 : done = clamp_avx2(data, n, lo, hi) ; break ;
+					case SimdLevel::SSE2 : done = clamp_sse2(data, n, lo, hi) ; break ;
+				#endif
+				#ifdef ZZ_SIMD_NEON
+					case SimdLevel::NEON : done = clamp_neon(data, n, lo, hi) ; break ;
+				#endif
+				default : break ;
+			}
+			clamp_scalar(data, done, n, lo, hi) ;
+		}
+
+		static void Add(int32_t* data, size_t n, const I32x4& pattern) noexcept {
+			size_t done = 0 ;
+			switch (Simd::GetLevel()) {
+				#ifdef ZZ_SIMD_X86
+					case SimdLevel::AVX2 : done = add_avx2(data, n, pattern) ; break ;
+					case SimdLevel::SSE2 : done = add_sse2(data, n, pattern) ; break ;
+				#endif
+				#ifdef ZZ_SIMD_NEON
+					case SimdLevel::NEON : done = add_neon(data, n, pattern) ; break ;
+				#endif
+				default : break ;
+			}
+			add_scalar(data, done, n, pattern) ;
+		}
+
+		// perkalian fixed-point: (data * pattern) >> shift dengan hasil antara 64-bit, 0 <= shift <= 32
+		static void MulFixed(int32_t* data, size_t n, const I32x4& pattern, int shift) noexcept {
+			size_t done = 0 ;
+			switch (Simd::GetLevel()) {
+				#ifdef ZZ_SIMD_X86
+					case SimdLevel::AVX2 : done = mul_fixed_avx2(data, n, pattern, shift) ; break ;
+					case SimdLevel::SSE2 : done = mul_fixed_sse2(data, n, pattern, shift) ; break ;
+				#endif
+				#ifdef ZZ_SIMD_NEON
+					case SimdLevel::NEON : done = mul_fixed_neon(data, n, pattern, shift) ; break ;
+				#endif
+				default : break ;
+			}
+			mul_fixed_scalar(data, done, n, pattern, shift) ;
+		}
+
+		// geser kanan aritmatika (floor), 0 <= shift < 32
+		static void ShiftRight(const int32_t* src, int32_t* dst, size_t n, int shift) noexcept {
+			size_t done = 0 ;
+			switch (Simd::GetLevel()) {
+				#ifdef ZZ_SIMD_X86
+					case SimdLevel::AVX2 : done = shift_avx2(src, dst, n, shift) ; break ;
+					case SimdLevel::SSE2 : done = shift_sse2(src, dst, n, shift) ; break ;
+				#endif
+				#ifdef ZZ_SIMD_NEON
+					case SimdLevel::NEON : done = shift_neon(src, dst, n, shift) ; break ;
+				#endif
+				default : break ;
+			}
+			shift_scalar(src, dst, done, n, shift) ;
+		}
+
+		static void Convert(const int32_t* src, float* dst, size_t n) noexcept {
+			size_t done = 0 ;
+			switch (Simd::GetLevel()) {
+				#ifdef ZZ_SIMD_X86
+					case SimdLevel::AVX2 : done = convert_avx2(src, dst, n) ; break ;
+					case SimdLevel::SSE2 : done = convert_sse2(src, dst, n) ; break ;
+				#endif
+				#ifdef ZZ_SIMD_NEON
+					case SimdLevel::NEON : done = convert_neon(src, dst, n) ; break ;
+				#endif
+				default : break ;
+			}
+			convert_scalar(src, dst, done, n) ;
+		}
+
+		static void Convert(const float* src, int32_t* dst, size_t n) noexcept {
+			size_t done = 0 ;
+			switch (Simd::GetLevel()) {
+				#ifdef ZZ_SIMD_X86
+					case SimdLevel::AVX2 : done = convert_avx2(src, dst, n) ; break ;
+					case SimdLevel::SSE2 : done = convert_sse2(src, dst, n) ; break ;
+				#endif
+				#ifdef ZZ_SIMD_NEON
+					case SimdLevel::NEON : done = convert_neon(src, dst, n) ; break ;
+				#endif
+				default : break ;
+			}
+			convert_scalar(src, dst, done, n) ;
+		}
+	} ;
+
+	// Point/Rect dianggap array datar, urutannya x, y lalu w, h
+	static_assert(sizeof(Point<float>) == 2 * sizeof(float) && sizeof(Point<int>) == 2 * sizeof(int32_t)) ;
+	static_assert(sizeof(Rect<float>) == 4 * sizeof(float) && sizeof(Rect<int>) == 4 * sizeof(int32_t)) ;
+}
+
+namespace utility {
+	template <typename scalar, typename type>
+	scalar* Flatten(std::span<type> items) noexcept {
+		return reinterpret_cast<scalar*>(items.data()) ;
+	}
+
+	template <typename scalar, typename type>
+	const scalar* Flatten(std::span<const type> items) noexcept {
+		return reinterpret_cast<const scalar*>(items.data()) ;
+	}
+}
+
+namespace zz {
+
+	inline void Translate(std::span<Rect<float>> rects, const Point<float>& offset) noexcept {
+		Kernel::Add(utility::Flatten<float>(rects), rects.size() * 4, {offset.x, offset.y, 0.0f, 0.0f}) ;
+	}
+
+	inline void Translate(std::span<Rect<int>> rects, const Point<int>& offset) noexcept {
+		Kernel::Add(utility::Flatten<int32_t>(rects), rects.size() * 4, {offset.x, offset.y, 0, 0}) ;
+	}
+
+	inline void Translate(std::span<Point<float>> points, const Point<float>& offset) noexcept {
+		Kernel::Add(utility::Flatten<float>(points), points.size() * 2, {offset.x, offset.y, offset.x, offset.y}) ;
+	}
+
+	inline void Translate(std::span<Point<int>> points, const Point<int>& offset) noexcept {
+		Kernel::Add(utility::Flatten<int32_t>(points), points.size() * 2, {offset.x, offset.y, offset.x, offset.y}) ;
+	}
+
+	// terhadap titik (0, 0), posisi dan ukuran ikut diskalakan
+	inline void Scale(std::span<Rect<float>> rects, const Point<float>& factor) noexcept {
+		Kernel::Mul(utility::Flatten<float>(rects), rects.size() * 4, {factor.x, factor.y, factor.x, factor.y}) ;
+	}
+
+	inline void Scale(std::span<Point<float>> points, const Point<float>& factor) noexcept {
+		Kernel::Mul(utility::Flatten<float>(points), points.size() * 2, {factor.x, factor.y, factor.x, factor.y}) ;
+	}
+
+	// per komponen, sama seperti operator aritmatika Rect
+	inline void Clamp(std::span<Rect<float>> rects, const Rect<float>& lo, const Rect<float>& hi) noexcept {
+		Kernel::Clamp(
+			utility::Flatten<float>(rects),
+			rects.size() * 4,
+			{lo.GetPoint().x, lo.GetPoint().y, lo.GetSize().w, lo.GetSize().h},
+			{hi.GetPoint().x, hi.GetPoint().y, hi.GetSize().w, hi.GetSize().h}
+		) ;
+	}
+
+	inline void Clamp(std::span<Point<float>> points, const Point<float>& lo, const Point<float>& hi) noexcept {
+		Kernel::Clamp(utility::Flatten<float>(points), points.size() * 2, {lo.x, lo.y, lo.x, lo.y}, {hi.x, hi.y, hi.x, hi.y}) ;
+	}
+
+	// w/h Rect<int> diperlakukan sebagai int32, ukuran di atas INT32_MAX tidak didukung.
+	// float -> int dipotong ke arah nol. hasilnya jumlah elemen yang dikonversi (yang terkecil dari dua span)
+	inline size_t Convert(std::span<const Rect<int>> src, std::span<Rect<float>> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		Kernel::Convert(utility::Flatten<int32_t>(src), utility::Flatten<float>(dst), count * 4) ;
+		return count ;
+	}
+
+	inline size_t Convert(std::span<const Rect<float>> src, std::span<Rect<int>> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		Kernel::Convert(utility::Flatten<float>(src), utility::Flatten<int32_t>(dst), count * 4) ;
+		return count ;
+	}
+
+	inline size_t Convert(std::span<const Point<int>> src, std::span<Point<float>> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		Kernel::Convert(utility::Flatten<int32_t>(src), utility::Flatten<float>(dst), count * 2) ;
+		return count ;
+	}
+
+	inline size_t Convert(std::span<const Point<float>> src, std::span<Point<int>> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		Kernel::Convert(utility::Flatten<float>(src), utility::Flatten<int32_t>(dst), count * 2) ;
+		return count ;
+	}
+}
\ No newline at end of file
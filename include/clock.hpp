@@ -0,0 +1,11 @@
+#pragma once
+
+#include "enum.hpp"
+
+namespace zz {
+
+	// waktu monotonic dalam nanodetik, basis semua timestamp event
+	inline uint64_t Now() noexcept {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()) ;
+	}
+}
\ No newline at end of file
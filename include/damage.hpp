@@ -0,0 +1,161 @@
+#pragma once
+
+#include "geometry.hpp"
+#include "latency.hpp"
+
+namespace zz {
+
+	// kumpulan area yang perlu digambar ulang, selalu tidak tumpang tindih dan paling banyak capacity rect.
+	// rect yang beririsan atau bersebelahan tanpa celah digabung jadi bounding box-nya; saat penuh, rect baru digabung
+	// dengan rect yang menambah area paling sedikit. hasilnya bisa sedikit lebih luas dari yang di-invalidate, tidak pernah kurang
+	class DamageRegion {
+	public :
+		static constexpr size_t capacity = 16 ;
+
+	private :
+		std::array<Rect<int>, capacity> rects_ {} ;
+		size_t count_ = 0 ;
+
+		static int64_t area_of(const Rect<int>& r) noexcept {
+			return IsEmpty(r) ? 0 : static_cast<int64_t>(r.GetSize().w) * static_cast<int64_t>(r.GetSize().h) ;
+		}
+
+		// area tambahan kalau a dan b diganti bounding box-nya
+		static int64_t waste_of(const Rect<int>& a, const Rect<int>& b) noexcept {
+			return area_of(Union(a, b)) - area_of(a) - area_of(b) ;
+		}
+
+		void remove(size_t i) noexcept {
+			rects_[i] = rects_[--count_] ;
+		}
+
+		void insert(Rect<int> r) noexcept {
+			size_t i = 0 ;
+			while (i < count_) {
+				if (Contains(rects_[i], r)) {
+					return ;
+				}
+
+				if (zz::Intersects(rects_[i], r) || waste_of(rects_[i], r) <= 0) {
+					r = Union(r, rects_[i]) ;
+					remove(i) ;
+					i = 0 ;
+				} else {
+					++i ;
+				}
+			}
+
+			if (count_ < capacity) {
+				rects_[count_++] = r ;
+				return ;
+			}
+
+			size_t best = 0 ;
+			for (size_t j = 1 ; j < count_ ; ++j) {
+				if (waste_of(rects_[j], r) < waste_of(rects_[best], r)) {
+					best = j ;
+				}
+			}
+			r = Union(r, rects_[best]) ;
+			remove(best) ;
+			insert(r) ;
+		}
+
+	public :
+		DamageRegion() noexcept = default ;
+
+		void Add(const Rect<int>& r) noexcept {
+			if (!IsEmpty(r)) {
+				insert(r) ;
+			}
+		}
+
+		void Clear() noexcept { count_ = 0 ; }
+		bool Empty() const noexcept { return count_ == 0 ; }
+		size_t Count() const noexcept { return count_ ; }
+
+		std::span<const Rect<int>> GetRects() const noexcept { return std::span<const Rect<int>>(rects_.data(), count_) ; }
+
+		// jumlah piksel, eksak karena rect tidak pernah tumpang tindih
+		int64_t GetArea() const noexcept {
+			int64_t area = 0 ;
+			for (const Rect<int>& r : GetRects()) {
+				area += area_of(r) ;
+			}
+			return area ;
+		}
+
+		Rect<int> GetBound() const noexcept {
+			Rect<int> bound {} ;
+			for (const Rect<int>& r : GetRects()) {
+				bound = Union(bound, r) ;
+			}
+			return bound ;
+		}
+
+		bool Intersects(const Rect<int>& r) const noexcept {
+			for (const Rect<int>& damaged : GetRects()) {
+				if (zz::Intersects(damaged, r)) {
+					return true ;
+				}
+			}
+			return false ;
+		}
+
+		// potong ke bound (biasanya ukuran surface), rect yang jatuh di luar dibuang
+		void Clip(const Rect<int>& bound) noexcept {
+			for (size_t i = 0 ; i < count_ ; ) {
+				rects_[i] = Intersect(rects_[i], bound) ;
+				if (IsEmpty(rects_[i])) {
+					remove(i) ;
+				} else {
+					++i ;
+				}
+			}
+		}
+	} ;
+
+	// fraksi piksel yang digambar ulang per frame. histogram menyimpan per-mil supaya persentil bisa dibaca langsung
+	class DamageStats {
+	private :
+		Histogram permille_ {} ;
+		uint64_t redrawn_ = 0 ;
+		uint64_t total_ = 0 ;
+		double last_ = 0.0 ;
+
+	public :
+		void Record(uint64_t redrawn, uint64_t total) noexcept {
+			if (total == 0) {
+				return ;
+			}
+
+			redrawn = std::min(redrawn, total) ;
+			redrawn_ += redrawn ;
+			total_ += total ;
+			last_ = static_cast<double>(redrawn) / static_cast<double>(total) ;
+			permille_.Record(redrawn * 1000 / total) ;
+		}
+
+		uint64_t GetFrameCount() const noexcept { return permille_.Count() ; }
+		double GetLastFraction() const noexcept { return last_ ; }
+
+		// total piksel yang digambar dibagi total piksel semua frame
+		double GetAverageFraction() const noexcept {
+			return total_ ? static_cast<double>(redrawn_) / static_cast<double>(total_) : 0.0 ;
+		}
+
+		const Histogram& GetHistogram() const noexcept { return permille_ ; }
+
+		void Reset() noexcept {
+			*this = DamageStats{} ;
+		}
+
+		void Dump(std::ostream& os, std::string_view label = "damage") const {
+			os << label << " - frames: " << GetFrameCount()
+			   << ", average: " << GetAverageFraction() * 100.0
+			   << ", p50: " << permille_.Percentile(50) / 10.0
+			   << ", p90: " << permille_.Percentile(90) / 10.0
+			   << ", max: " << permille_.Max() / 10.0 << " %\n" ;
+		}
+	} ;
+}
\ No newline at end of file
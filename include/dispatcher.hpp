@@ -0,0 +1,173 @@
+#pragma once
+
+#include "window.hpp"
+
+namespace zz {
+
+	inline constexpr size_t event_type_count = static_cast<size_t>(EventType::User) + 1 ;
+
+	// tipe payload yang diterima handler, diambil dari parameter pertama operator() / function pointer
+	template <typename fn> struct handler_traits : handler_traits<decltype(&fn::operator())> {} ;
+	template <typename cls, typename ret, typename arg> struct handler_traits<ret (cls::*)(arg) const> { using type = std::remove_cvref_t<arg> ; } ;
+	template <typename cls, typename ret, typename arg> struct handler_traits<ret (cls::*)(arg)> { using type = std::remove_cvref_t<arg> ; } ;
+	template <typename ret, typename arg> struct handler_traits<ret (*)(arg)> { using type = std::remove_cvref_t<arg> ; } ;
+
+	template <typename fn>
+	using handler_event_t = typename handler_traits<std::decay_t<fn>>::type ;
+
+	template <typename fn>
+	concept EventHandler = EventType_t<handler_event_t<fn>> ;
+
+	// tabel lompat disusun saat compile dari daftar handler, Dispatch = satu index + satu call
+	template <EventHandler... handlers>
+	class StaticDispatcher {
+	private :
+		using thunk = void (*)(StaticDispatcher&, const Event&) ;
+
+		std::tuple<handlers...> handlers_ ;
+
+		template <size_t index>
+		static void invoke(StaticDispatcher& self, const Event& e) {
+			using type = handler_event_t<std::tuple_element_t<index, std::tuple<handlers...>>> ;
+			std::get<index>(self.handlers_)(e.Get<type>()) ;
+		}
+
+		static void ignore(StaticDispatcher&, const Event&) noexcept {}
+
+		static constexpr std::array<thunk, event_type_count> make_table() noexcept {
+			std::array<thunk, event_type_count> table {} ;
+			table.fill(&ignore) ;
+			[&]<size_t... i>(std::index_sequence<i...>) {
+				((table[static_cast<size_t>(event_type_of<handler_event_t<handlers>>::value)] = &invoke<i>), ...) ;
+			}(std::index_sequence_for<handlers...>{}) ;
+			return table ;
+		}
+
+		static constexpr std::array<thunk, event_type_count> table_ = make_table() ;
+
+	public :
+		explicit StaticDispatcher(handlers... h) : handlers_(std::move(h)...) {}
+
+		void Dispatch(const Event& e) {
+			const DispatchTimer timer ;
+			table_[static_cast<size_t>(e.GetType())](*this, e) ;
+		}
+	} ;
+
+	// versi runtime: handler bisa didaftarkan/diganti kapan saja, global atau per window
+	class Dispatcher {
+	private :
+		using Handler = std::function<void(const Event&)> ;
+		using Table = std::array<Handler, event_type_count> ;
+
+		struct Entry {
+			SlotHandle slot {} ;
+			WindowHandle handle = nullptr ;
+			Table table {} ;
+		} ;
+
+		Table global_ {} ;
+		std::vector<Entry> windows_ {} ;	// di-index langsung dengan SlotHandle::index
+
+		// cache handle -> tabel untuk event terakhir di depan lookup: event datang beruntun dari window yang sama, jadi
+		// jalur umum hanya dua perbandingan tanpa hashing. basi kalau epoch Application berubah
+		static constexpr uint32_t none = ~uint32_t{0} ;
+		mutable WindowHandle cached_handle_ = nullptr ;
+		mutable uint32_t cached_index_ = none ;	// index, bukan pointer, supaya Dispatcher tetap aman di-copy
+		mutable uint64_t cached_epoch_ = ~uint64_t{0} ;
+
+		template <EventHandler fn>
+		static Handler wrap(fn&& handler) {
+			using type = handler_event_t<fn> ;
+			return [h = std::forward<fn>(handler)](const Event& e) { h(e.Get<type>()) ; } ;
+		}
+
+		void invalidate() noexcept {
+			cached_handle_ = nullptr ;
+			cached_index_ = none ;
+			cached_epoch_ = ~uint64_t{0} ;
+		}
+
+		const Table* find(WindowHandle handle) const noexcept {
+			const uint64_t epoch = Application::GetWindowEpoch() ;
+			if (handle == cached_handle_ && epoch == cached_epoch_) {
+				return cached_index_ == none ? nullptr : &windows_[cached_index_].table ;
+			}
+			return lookup(handle, epoch) ;
+		}
+
+		// jalur lambat: window berganti atau ada window yang masuk/keluar sejak lookup terakhir. handle -> slot lewat
+		// map di Application, slot langsung jadi index windows_, jadi biayanya tetap berapapun jumlah window
+		const Table* lookup(WindowHandle handle, uint64_t epoch) const noexcept {
+			const SlotHandle slot = Application::GetWindowSlot(handle) ;
+			const uint32_t found = slot.IsValid() && slot.index < windows_.size() && windows_[slot.index].slot == slot && windows_[slot.index].handle == handle ? slot.index : none ;
+
+			cached_handle_ = handle ;
+			cached_index_ = found ;
+			cached_epoch_ = epoch ;
+			return found == none ? nullptr : &windows_[found].table ;
+		}
+
+		Table& get_or_add(SlotHandle slot, WindowHandle handle) {
+			invalidate() ;
+			if (slot.index >= windows_.size()) {
+				windows_.resize(slot.index + 1) ;
+			}
+
+			Entry& entry = windows_[slot.index] ;
+			if (entry.slot != slot || entry.handle != handle) {
+				entry = Entry{slot, handle, Table{}} ;
+			}
+			return entry.table ;
+		}
+
+	public :
+		template <EventHandler fn>
+		Dispatcher& On(fn&& handler) {
+			global_[static_cast<size_t>(event_type_of<handler_event_t<fn>>::value)] = wrap(std::forward<fn>(handler)) ;
+			return *this ;
+		}
+
+		template <EventHandler fn>
+		Dispatcher& On(const Window& window, fn&& handler) {
+			if (!window.GetSlot().IsValid()) {
+				return *this ;
+			}
+
+			get_or_add(window.GetSlot(), window.GetHandle())[static_cast<size_t>(event_type_of<handler_event_t<fn>>::value)] = wrap(std::forward<fn>(handler)) ;
+			return *this ;
+		}
+
+		// handler menerima Event mentah, untuk handler yang butuh handle atau timestamp event
+		Dispatcher& On(EventType type, Handler handler) {
+			global_[static_cast<size_t>(type)] = std::move(handler) ;
+			return *this ;
+		}
+
+		void Off(const Window& window) noexcept {
+			const SlotHandle slot = window.GetSlot() ;
+			if (slot.index < windows_.size() && windows_[slot.index].slot == slot) {
+				windows_[slot.index] = {} ;
+				invalidate() ;
+			}
+		}
+
+		// handler per window didahulukan, false kalau tidak ada handler untuk event ini. waktunya masuk
+		// Latency::GetDispatch kalau instrumentasi aktif
+		bool Dispatch(const Event& e) const {
+			const DispatchTimer timer ;
+			const size_t index = static_cast<size_t>(e.GetType()) ;
+			if (const Table* table = find(e.GetHandle()) ; table && (*table)[index]) {
+				(*table)[index](e) ;
+				return true ;
+			}
+
+			if (global_[index]) {
+				global_[index](e) ;
+				return true ;
+			}
+
+			return false ;
+		}
+	} ;
+}
\ No newline at end of file
@@ -0,0 +1,432 @@
+#pragma once
+
+#include "raster.hpp"
+#include "damage.hpp"
+#include "eventlog.hpp"
+
+namespace utility {
+	// FNV-1a 64-bit, cukup untuk membandingkan isi perintah antar frame
+	inline uint64_t Fnv1a(const uint8_t* data, size_t size, uint64_t hash = 0xCBF29CE484222325ull) noexcept {
+		for (size_t i = 0 ; i < size ; ++i) {
+			hash = (hash ^ data[i]) * 0x100000001B3ull ;
+		}
+		return hash ;
+	}
+}
+
+namespace zz {
+
+	// DisplayOp::Text digambar lewat interface ini, implementasinya ada di modul font
+	class TextRenderer {
+	public :
+		virtual ~TextRenderer() noexcept = default ;
+		virtual void DrawText(Rasterizer& raster, const Rect<int>& bound, std::string_view text, Color color, uint32_t font) = 0 ;
+
+		// lebar satu baris text dan tinggi baris font, dipakai layout widget
+		virtual Size<int> MeasureText(std::string_view text, uint32_t font) = 0 ;
+	} ;
+
+	struct DisplayListHeader {
+		char magic[4] = {'Z', 'Z', 'D', 'L'} ;
+		uint32_t version = 1 ;
+		uint64_t size = 0 ;		// byte perintah setelah header
+	} ;
+
+	// daftar perintah gambar retained. semua perintah ditulis berurutan ke satu arena byte (header + payload,
+	// rata 8 byte), Clear mempertahankan kapasitas jadi frame berikutnya tidak alokasi lagi. bentuk binernya
+	// adalah arena itu sendiri, jadi Serialize/Load cukup memcpy (little-endian, sama seperti event log)
+	class DisplayList {
+	private :
+		struct Record {
+			DisplayOp op = DisplayOp::FillRect ;
+			uint8_t reserved[3] {} ;
+			uint32_t size = 0 ;		// termasuk header dan padding
+		} ;
+
+		struct FillRectData {
+			Rect<int> rect {} ;
+			Color color {} ;
+		} ;
+
+		struct RoundedRectData {
+			Rect<float> rect {} ;
+			float radius = 0.0f ;
+			Color color {} ;
+		} ;
+
+		struct LineData {
+			Point<float> a {} ;
+			Point<float> b {} ;
+			float width = 0.0f ;
+			Color color {} ;
+		} ;
+
+		// image = index ke span images saat Replay, version dinaikkan pemanggil kalau isi image berubah
+		struct BlitData {
+			Rect<int> source {} ;
+			Point<int> at {} ;
+			uint32_t image = 0 ;
+			uint32_t version = 0 ;
+		} ;
+
+		// diikuti length byte UTF-8
+		struct TextData {
+			Rect<int> bound {} ;
+			Color color {} ;
+			uint32_t font = 0 ;
+			uint32_t length = 0 ;
+		} ;
+
+		struct ClipData {
+			Rect<int> rect {} ;
+		} ;
+
+		// perintah gambar setelah clip diratakan: hash isi + clip efektif, dan area piksel yang bisa disentuh
+		struct Item {
+			uint64_t hash = 0 ;
+			Rect<int> bound {} ;
+
+			bool operator==(const Item& o) const noexcept { return hash == o.hash && bound == o.bound ; }
+		} ;
+
+		static_assert(sizeof(Record) == 8 && sizeof(FillRectData) == 20 && sizeof(RoundedRectData) == 24 && sizeof(LineData) == 24) ;
+		static_assert(sizeof(BlitData) == 32 && sizeof(TextData) == 28 && sizeof(ClipData) == 16) ;
+
+		static constexpr size_t alignment_ = 8 ;
+
+		std::vector<uint8_t> arena_ {} ;
+		size_t count_ = 0 ;
+		mutable std::vector<Item> items_ {} ;
+		mutable std::vector<Rect<int>> clips_ {} ;
+		mutable bool items_valid_ = false ;
+
+		static constexpr size_t payload_size(DisplayOp op) noexcept {
+			switch (op) {
+				case DisplayOp::FillRect : return sizeof(FillRectData) ;
+				case DisplayOp::FillRoundedRect : return sizeof(RoundedRectData) ;
+				case DisplayOp::Line : return sizeof(LineData) ;
+				case DisplayOp::Blit : return sizeof(BlitData) ;
+				case DisplayOp::Text : return sizeof(TextData) ;
+				case DisplayOp::PushClip : return sizeof(ClipData) ;
+				default : return 0 ;
+			}
+		}
+
+		template <typename data>
+		static data read(const uint8_t* payload) noexcept {
+			data value ;
+			std::memcpy(&value, payload, sizeof(data)) ;
+			return value ;
+		}
+
+		// padding ikut di-nol-kan, jadi byte arena (dan hash-nya) hanya bergantung pada isi perintah
+		template <typename data>
+		void append(DisplayOp op, const data& payload, const void* extra = nullptr, size_t extra_size = 0) {
+			const size_t size = (sizeof(Record) + sizeof(data) + extra_size + alignment_ - 1) / alignment_ * alignment_ ;
+			const size_t offset = arena_.size() ;
+			arena_.resize(offset + size) ;
+
+			Record record {} ;
+			record.op = op ;
+			record.size = static_cast<uint32_t>(size) ;
+			std::memcpy(arena_.data() + offset, &record, sizeof(Record)) ;
+			std::memcpy(arena_.data() + offset + sizeof(Record), &payload, sizeof(data)) ;
+			if (extra_size) {
+				std::memcpy(arena_.data() + offset + sizeof(Record) + sizeof(data), extra, extra_size) ;
+			}
+
+			++count_ ;
+			items_valid_ = false ;
+		}
+
+		// fn(op, record, payload) untuk tiap perintah, record menunjuk ke header di arena
+		template <typename fn>
+		void visit(fn&& f) const {
+			for (size_t offset = 0 ; offset < arena_.size() ; ) {
+				const Record record = read<Record>(arena_.data() + offset) ;
+				f(record.op, arena_.data() + offset, arena_.data() + offset + sizeof(Record)) ;
+				offset += record.size ;
+			}
+		}
+
+		static Rect<int> float_bound(float x0, float y0, float x1, float y1) noexcept {
+			constexpr float limit = 1 << 30 ;
+			const auto pixel = [limit](float v) { return static_cast<int>(std::clamp(v, -limit, limit)) ; } ;
+			const int left = pixel(std::floor(x0)) ;
+			const int top = pixel(std::floor(y0)) ;
+			const int64_t width = static_cast<int64_t>(pixel(std::ceil(x1))) - left ;
+			const int64_t height = static_cast<int64_t>(pixel(std::ceil(y1))) - top ;
+			return Rect<int>(left, top, static_cast<uint32_t>(std::max<int64_t>(width, 0)), static_cast<uint32_t>(std::max<int64_t>(height, 0))) ;
+		}
+
+		// area yang mungkin diubah perintah, boleh lebih luas (AA) tapi tidak boleh kurang dari yang digambar Rasterizer
+		static Rect<int> bound_of(DisplayOp op, const uint8_t* payload) noexcept {
+			switch (op) {
+				case DisplayOp::FillRect :
+					return read<FillRectData>(payload).rect ;
+				case DisplayOp::FillRoundedRect : {
+					const Rect<float> r = read<RoundedRectData>(payload).rect ;
+					return float_bound(r.GetPoint().x, r.GetPoint().y, r.GetPoint().x + r.GetSize().w, r.GetPoint().y + r.GetSize().h) ;
+				}
+				case DisplayOp::Line : {
+					const LineData line = read<LineData>(payload) ;
+					const float pad = line.width * 0.5f + 1.0f ;
+					return float_bound(std::min(line.a.x, line.b.x) - pad, std::min(line.a.y, line.b.y) - pad, std::max(line.a.x, line.b.x) + pad, std::max(line.a.y, line.b.y) + pad) ;
+				}
+				case DisplayOp::Blit : {
+					const BlitData blit = read<BlitData>(payload) ;
+					return Rect<int>(blit.at, blit.source.GetSize()) ;
+				}
+				case DisplayOp::Text :
+					return read<TextData>(payload).bound ;
+				default :
+					return Rect<int>{} ;
+			}
+		}
+
+		const std::vector<Item>& items() const {
+			if (items_valid_) {
+				return items_ ;
+			}
+
+			items_.clear() ;
+			clips_.clear() ;
+			visit([this](DisplayOp op, const uint8_t* record, const uint8_t* payload) {
+				if (op == DisplayOp::PushClip) {
+					const Rect<int> r = read<ClipData>(payload).rect ;
+					clips_.push_back(clips_.empty() ? r : Intersect(r, clips_.back())) ;
+					return ;
+				}
+				if (op == DisplayOp::PopClip) {
+					if (!clips_.empty()) {
+						clips_.pop_back() ;
+					}
+					return ;
+				}
+
+				Rect<int> bound = bound_of(op, payload) ;
+				uint64_t hash = utility::Fnv1a(record, read<Record>(record).size) ;
+				if (!clips_.empty()) {
+					bound = Intersect(bound, clips_.back()) ;
+					hash = utility::Fnv1a(reinterpret_cast<const uint8_t*>(&clips_.back()), sizeof(Rect<int>), hash) ;
+				}
+				if (!IsEmpty(bound)) {
+					items_.push_back(Item{hash, bound}) ;
+				}
+			}) ;
+
+			items_valid_ = true ;
+			return items_ ;
+		}
+
+		// struktur arena harus utuh: ukuran record rata 8, tidak keluar buffer dan cukup untuk payload-nya
+		static bool validate(std::span<const uint8_t> bytes, size_t& count) noexcept {
+			count = 0 ;
+			for (size_t offset = 0 ; offset < bytes.size() ; ++count) {
+				if (bytes.size() - offset < sizeof(Record)) {
+					return false ;
+				}
+
+				const Record record = read<Record>(bytes.data() + offset) ;
+				if (record.op >= DisplayOp::Count || record.size < sizeof(Record) || record.size % alignment_ != 0 || record.size > bytes.size() - offset) {
+					return false ;
+				}
+
+				const size_t available = record.size - sizeof(Record) ;
+				if (available < payload_size(record.op)) {
+					return false ;
+				}
+				if (record.op == DisplayOp::Text && read<TextData>(bytes.data() + offset + sizeof(Record)).length > available - sizeof(TextData)) {
+					return false ;
+				}
+				offset += record.size ;
+			}
+			return true ;
+		}
+
+	public :
+		DisplayList() noexcept = default ;
+
+		// kapasitas arena tetap dipakai ulang
+		void Clear() noexcept {
+			arena_.clear() ;
+			count_ = 0 ;
+			items_valid_ = false ;
+		}
+
+		bool Empty() const noexcept { return count_ == 0 ; }
+		size_t GetCount() const noexcept { return count_ ; }
+		size_t GetByteSize() const noexcept { return arena_.size() ; }
+
+		void FillRect(const Rect<int>& r, Color color) {
+			append(DisplayOp::FillRect, FillRectData{r, color}) ;
+		}
+
+		void FillRoundedRect(const Rect<float>& r, float radius, Color color) {
+			append(DisplayOp::FillRoundedRect, RoundedRectData{r, radius, color}) ;
+		}
+
+		void DrawLine(const Point<float>& a, const Point<float>& b, float width, Color color) {
+			append(DisplayOp::Line, LineData{a, b, width, color}) ;
+		}
+
+		// source dalam koordinat image, dipotong ke ukuran image saat Replay
+		void Blit(uint32_t image, const Rect<int>& source, const Point<int>& at, uint32_t version = 0) {
+			append(DisplayOp::Blit, BlitData{source, at, image, version}) ;
+		}
+
+		// bound = kotak layout teks, dipakai untuk diff dan diteruskan ke TextRenderer
+		void DrawText(const Rect<int>& bound, std::string_view text, Color color, uint32_t font = 0) {
+			append(DisplayOp::Text, TextData{bound, color, font, static_cast<uint32_t>(text.size())}, text.data(), text.size()) ;
+		}
+
+		void PushClip(const Rect<int>& r) {
+			append(DisplayOp::PushClip, ClipData{r}) ;
+		}
+
+		void PopClip() {
+			const Record record {DisplayOp::PopClip, {}, sizeof(Record)} ;
+			const size_t offset = arena_.size() ;
+			arena_.resize(offset + sizeof(Record)) ;
+			std::memcpy(arena_.data() + offset, &record, sizeof(Record)) ;
+			++count_ ;
+			items_valid_ = false ;
+		}
+
+		// perintah dipasangkan dengan frame sebelumnya: prefix dan suffix yang sama dilewati, sisanya dibandingkan
+		// per posisi. area perintah lama dan baru yang berbeda masuk ke damage. piksel di luar damage dijamin ditutup
+		// urutan perintah yang sama persis, jadi hasil gambarnya juga sama. return jumlah pasangan yang berbeda
+		size_t Diff(const DisplayList& previous, DamageRegion& damage) const {
+			const std::vector<Item>& now = items() ;
+			const std::vector<Item>& before = previous.items() ;
+
+			size_t prefix = 0 ;
+			while (prefix < now.size() && prefix < before.size() && now[prefix] == before[prefix]) {
+				++prefix ;
+			}
+
+			size_t suffix = 0 ;
+			while (suffix < now.size() - prefix && suffix < before.size() - prefix && now[now.size() - 1 - suffix] == before[before.size() - 1 - suffix]) {
+				++suffix ;
+			}
+
+			const size_t now_count = now.size() - prefix - suffix ;
+			const size_t before_count = before.size() - prefix - suffix ;
+			size_t changed = 0 ;
+			for (size_t i = 0 ; i < std::max(now_count, before_count) ; ++i) {
+				if (i < now_count && i < before_count && now[prefix + i] == before[prefix + i]) {
+					continue ;
+				}
+				if (i < now_count) {
+					damage.Add(now[prefix + i].bound) ;
+				}
+				if (i < before_count) {
+					damage.Add(before[prefix + i].bound) ;
+				}
+				++changed ;
+			}
+			return changed ;
+		}
+
+		// terjemahkan ke perintah Rasterizer (tanpa Clear). Blit dengan index di luar images dan Text tanpa renderer dilewati
+		void Replay(Rasterizer& raster, std::span<const SurfaceView> images = {}, TextRenderer* text = nullptr) const {
+			visit([&](DisplayOp op, const uint8_t*, const uint8_t* payload) {
+				switch (op) {
+					case DisplayOp::FillRect : {
+						const FillRectData data = read<FillRectData>(payload) ;
+						raster.FillRect(data.rect, data.color) ;
+						break ;
+					}
+					case DisplayOp::FillRoundedRect : {
+						const RoundedRectData data = read<RoundedRectData>(payload) ;
+						raster.FillRoundedRect(data.rect, data.radius, data.color) ;
+						break ;
+					}
+					case DisplayOp::Line : {
+						const LineData data = read<LineData>(payload) ;
+						raster.DrawLine(data.a, data.b, data.width, data.color) ;
+						break ;
+					}
+					case DisplayOp::Blit : {
+						const BlitData data = read<BlitData>(payload) ;
+						if (data.image < images.size()) {
+							const SurfaceView source = images[data.image].Sub(data.source) ;
+							const Point<int> shift {std::max(data.source.GetPoint().x, 0) - data.source.GetPoint().x, std::max(data.source.GetPoint().y, 0) - data.source.GetPoint().y} ;
+							raster.Blit(source, Point<int>{data.at.x + shift.x, data.at.y + shift.y}) ;
+						}
+						break ;
+					}
+					case DisplayOp::Text : {
+						const TextData data = read<TextData>(payload) ;
+						if (text) {
+							text->DrawText(raster, data.bound, std::string_view(reinterpret_cast<const char*>(payload + sizeof(TextData)), data.length), data.color, data.font) ;
+						}
+						break ;
+					}
+					case DisplayOp::PushClip :
+						raster.PushClip(read<ClipData>(payload).rect) ;
+						break ;
+					case DisplayOp::PopClip :
+						raster.PopClip() ;
+						break ;
+					default :
+						break ;
+				}
+			}) ;
+		}
+
+		std::vector<uint8_t> Serialize() const {
+			DisplayListHeader header {} ;
+			header.size = arena_.size() ;
+
+			std::vector<uint8_t> bytes(sizeof(header) + arena_.size()) ;
+			std::memcpy(bytes.data(), &header, sizeof(header)) ;
+			std::copy(arena_.begin(), arena_.end(), bytes.begin() + sizeof(header)) ;
+			return bytes ;
+		}
+
+		// isi lama tetap utuh kalau data tidak valid
+		bool Deserialize(std::span<const uint8_t> bytes) {
+			DisplayListHeader header {} ;
+			const DisplayListHeader expected {} ;
+			if (bytes.size() < sizeof(header)) {
+				return false ;
+			}
+
+			std::memcpy(&header, bytes.data(), sizeof(header)) ;
+			if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.version != expected.version || header.size != bytes.size() - sizeof(header)) {
+				return false ;
+			}
+
+			size_t count = 0 ;
+			const std::span<const uint8_t> body = bytes.subspan(sizeof(header)) ;
+			if (!validate(body, count)) {
+				return false ;
+			}
+
+			arena_.assign(body.begin(), body.end()) ;
+			count_ = count ;
+			items_valid_ = false ;
+			return true ;
+		}
+
+		bool Save(const char* path) const {
+			const std::vector<uint8_t> bytes = Serialize() ;
+			MappedFile file {} ;
+			if (!file.Open(path, true, bytes.size())) {
+				return false ;
+			}
+			std::memcpy(file.GetData(), bytes.data(), bytes.size()) ;
+			file.Close(bytes.size()) ;
+			return true ;
+		}
+
+		bool Load(const char* path) {
+			MappedFile file {} ;
+			if (!file.Open(path, false)) {
+				return false ;
+			}
+			return Deserialize(std::span<const uint8_t>(file.GetData(), file.GetSize())) ;
+		}
+	} ;
+}
\ No newline at end of file
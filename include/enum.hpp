@@ -1,208 +1,285 @@
-#pragma once
-
-#include "debug.hpp"
-
-namespace zz {
-
-	// Enum WindowStyle dengan nama yang lebih mudah dipahami
-	enum class WindowStyle : uint32_t {
-		Basic             = WS_OVERLAPPED,           // jendela standar tanpa tambahan
-		Popup             = WS_POPUP,                // jendela pop-up (tanpa border normal)
-		Child             = WS_CHILD,                // jendela anak (tertanam di parent)
-		Minimized         = WS_MINIMIZE,             // jendela dalam keadaan minimize
-		Visible           = WS_VISIBLE,              // jendela terlihat
-		Disabled          = WS_DISABLED,             // jendela nonaktif
-		ClipSiblings      = WS_CLIPSIBLINGS,         // hindari gambar tumpang tindih antar child
-		ClipChildren      = WS_CLIPCHILDREN,         // cegah parent menggambar di area child
-		Maximized         = WS_MAXIMIZE,             // jendela dalam keadaan maximize
-		TitleBar          = WS_CAPTION,              // judul + border atas
-		Border            = WS_BORDER,               // border tipis
-		DialogFrame       = WS_DLGFRAME,             // frame dialog
-		VerticalScroll    = WS_VSCROLL,              // scrollbar vertikal
-		HorizontalScroll  = WS_HSCROLL,              // scrollbar horizontal
-		SystemMenu        = WS_SYSMENU,              // tombol sistem (close, minimize, dsb)
-		ResizableFrame    = WS_THICKFRAME,           // border bisa di-resize (sizebox)
-		MinimizeButton    = WS_MINIMIZEBOX,          // tombol minimize
-		MaximizeButton    = WS_MAXIMIZEBOX,          // tombol maximize
-		TabStop           = WS_TABSTOP,              // bisa diakses dengan Tab
-		Group             = WS_GROUP,                // grup kontrol
-		TiledLegacy       = WS_TILED,                // alias lama untuk OVERLAPPED
-		OverlappedWindow  = WS_OVERLAPPEDWINDOW,     // jendela normal lengkap (title, border, dsb)
-		PopupWindow       = WS_POPUPWINDOW,          // jendela pop-up dengan border & menu sistem
-		ChildWindow       = WS_CHILDWINDOW,          // jendela anak (kombinasi child style)
-		FixedWindow       = Basic | TitleBar | SystemMenu | MinimizeButton // non-resizable
-	} ;
-
-	enum class WindowShowMode : uint8_t {
-		Hidden           = 0,  // SW_HIDE
-		Normal           = 1,  // SW_SHOWNORMAL / SW_NORMAL
-		Minimized        = 2,  // SW_SHOWMINIMIZED
-		Maximized        = 3,  // SW_SHOWMAXIMIZED / SW_MAXIMIZE
-		NoActivate       = 4,  // SW_SHOWNOACTIVATE
-		Show             = 5,  // SW_SHOW
-		Minimize         = 6,  // SW_MINIMIZE
-		MinNoActivate    = 7,  // SW_SHOWMINNOACTIVE
-		ShowNoActivate   = 8,  // SW_SHOWNA
-		Restore          = 9,  // SW_RESTORE
-		Default          = 10, // SW_SHOWDEFAULT
-		ForceMinimize    = 11, // SW_FORCEMINIMIZE
-		Max              = 11  // SW_MAX
-	};
-
-	enum class WindowFlag : uint8_t {
-		None			= 0,
-		Registered		= 1 << 0,
-		Closed			= 1 << 1,
-		Destroyed		= 1 << 2,
-		Active			= 1 << 3,
-	} ;
-
-	enum class EventType : uint8_t {
-		None,
-		Window,
-		Mouse,
-		Key,
-		Widget,
-	} ;
-
-	enum class WindowState : uint8_t {
-		None,
-		Close,
-		Minimize,
-		Maximize,
-		Resize
-	} ;
-
-	enum class MouseState : uint8_t {
-		None,
-		Move,
-		Up,
-		Down,
-		Middle,
-		DoubleClick,
-		Hover,
-		Wheel
-	} ;
-
-	enum class MouseButton : uint8_t {
-		None,
-		Left,
-		Right,
-		Middle,
-		Undefined
-	} ;
-
-	enum class KeyState : uint8_t {
-		None,
-		Up,
-		Down
-	} ;
-
-	enum class KeyCode : uint16_t {
-		// CONTROL & NAVIGATION
-		None		= 0,
-		Back		= 8,
-		Tab			= 9,
-		Enter		= 13,
-		Shift		= 16,
-		Control		= 17,
-		Alt			= 18,    // Alt
-		Pause		= 19,
-		CapsLock	= 20,
-		Escape		= 27,
-		Space		= 32,
-		PageUp		= 33,
-		PageDown	= 34,
-		End			= 35,
-		Home		= 36,
-		Left		= 37,
-		Up			= 38,
-		Right		= 39,
-		Down		= 40,
-		Insert		= 45,
-		Delete		= 46,
-
-		// NUMBER KEYS (TOP)
-		Number0 = 48,
-		Number1 = 49,
-		Number2 = 50,
-		Number3 = 51,
-		Number4 = 52,
-		Number5 = 53,
-		Number6 = 54,
-		Number7 = 55,
-		Number8 = 56,
-		Number9 = 57,
-
-		// LETTER KEYS (A–Z)
-		A = 65, B = 66, C = 67, D = 68, E = 69, F = 70, G = 71, H = 72,
-		I = 73, J = 74, K = 75, L = 76, M = 77, N = 78, O = 79, P = 80,
-		Q = 81, R = 82, S = 83, T = 84, U = 85, V = 86, W = 87, X = 88,
-		Y = 89, Z = 90,
-
-		// WINDOWS & MENU
-		LeftWindows  = 91,
-		RightWindows = 92,
-		Application  = 93,
-
-		// NUMPAD SECTION
-		NumPad0 = 96,
-		NumPad1 = 97,
-		NumPad2 = 98,
-		NumPad3 = 99,
-		NumPad4 = 100,
-		NumPad5 = 101,
-		NumPad6 = 102,
-		NumPad7 = 103,
-		NumPad8 = 104,
-		NumPad9 = 105,
-
-		Multiply	= 106,
-		Add			= 107,
-		Separator	= 108, // Enter (numeric)
-		Subtract	= 109,
-		Decimal		= 110,
-		Divide		= 111,
-		NumLock		= 144,
-
-		// FUNCTION KEYS
-		F1 = 112, F2 = 113, F3 = 114, F4 = 115, F5 = 116, F6 = 117,
-		F7 = 118, F8 = 119, F9 = 120, F10 = 121, F11 = 122, F12 = 123,
-		F13 = 124, F14 = 125, F15 = 126, F16 = 127, F17 = 128, F18 = 129,
-		F19 = 130, F20 = 131, F21 = 132, F22 = 133, F23 = 134, F24 = 135,
-
-		// MODIFIER KEYS
-		LeftShift		= 160,
-		RightShift		= 161,
-		LeftControl		= 162,
-		RightControl	= 163,
-		LeftAlt			= 164,
-		RightAlt		= 165,
-
-		// GAMEPAD / CONTROLLER
-		GamepadA						= 195,
-		GamepadB						= 196,
-		GamepadX						= 197,
-		GamepadY						= 198,
-		GamepadRightShoulder			= 199,
-		GamepadLeftShoulder				= 200,
-		GamepadLeftTrigger				= 201,
-		GamepadRightTrigger				= 202,
-		GamepadDPadUp					= 203,
-		GamepadDPadDown					= 204,
-		GamepadDPadLeft					= 205,
-		GamepadDPadRight				= 206,
-		GamepadMenu						= 207,
-		GamepadView						= 208,
-		GamepadLeftThumbstickButton		= 209,
-		GamepadRightThumbstickButton	= 210,
-		GamepadLeftThumbstickUp			= 211,
-		GamepadLeftThumbstickDown		= 212,
-		GamepadLeftThumbstickRight		= 213,
-		GamepadLeftThumbstickLeft		= 214,
-		GamepadRightThumbstickUp		= 215,
-		GamepadRightThumbstickDown		= 216,
-		GamepadRightThumbstickRight		= 217,
-		GamepadRightThumbstickLeft		= 218
-	} ;
+#pragma once
+
+#include "debug.hpp"
+
+namespace zz {
+
+	// Enum WindowStyle dengan nama yang lebih mudah dipahami, nilainya sama dengan konstanta WS_* Win32
+	enum class WindowStyle : uint32_t {
+		Basic             = 0x00000000,              // WS_OVERLAPPED - jendela standar tanpa tambahan
+		Popup             = 0x80000000,              // WS_POPUP - jendela pop-up (tanpa border normal)
+		Child             = 0x40000000,              // WS_CHILD - jendela anak (tertanam di parent)
+		Minimized         = 0x20000000,              // WS_MINIMIZE - jendela dalam keadaan minimize
+		Visible           = 0x10000000,              // WS_VISIBLE - jendela terlihat
+		Disabled          = 0x08000000,              // WS_DISABLED - jendela nonaktif
+		ClipSiblings      = 0x04000000,              // WS_CLIPSIBLINGS - hindari gambar tumpang tindih antar child
+		ClipChildren      = 0x02000000,              // WS_CLIPCHILDREN - cegah parent menggambar di area child
+		Maximized         = 0x01000000,              // WS_MAXIMIZE - jendela dalam keadaan maximize
+		TitleBar          = 0x00C00000,              // WS_CAPTION - judul + border atas
+		Border            = 0x00800000,              // WS_BORDER - border tipis
+		DialogFrame       = 0x00400000,              // WS_DLGFRAME - frame dialog
+		VerticalScroll    = 0x00200000,              // WS_VSCROLL - scrollbar vertikal
+		HorizontalScroll  = 0x00100000,              // WS_HSCROLL - scrollbar horizontal
+		SystemMenu        = 0x00080000,              // WS_SYSMENU - tombol sistem (close, minimize, dsb)
+		ResizableFrame    = 0x00040000,              // WS_THICKFRAME - border bisa di-resize (sizebox)
+		MinimizeButton    = 0x00020000,              // WS_MINIMIZEBOX - tombol minimize
+		MaximizeButton    = 0x00010000,              // WS_MAXIMIZEBOX - tombol maximize
+		TabStop           = 0x00010000,              // WS_TABSTOP - bisa diakses dengan Tab
+		Group             = 0x00020000,              // WS_GROUP - grup kontrol
+		TiledLegacy       = 0x00000000,              // WS_TILED - alias lama untuk OVERLAPPED
+		OverlappedWindow  = 0x00CF0000,              // WS_OVERLAPPEDWINDOW - jendela normal lengkap (title, border, dsb)
+		PopupWindow       = 0x80880000,              // WS_POPUPWINDOW - jendela pop-up dengan border & menu sistem
+		ChildWindow       = 0x40000000,              // WS_CHILDWINDOW - jendela anak (kombinasi child style)
+		FixedWindow       = Basic | TitleBar | SystemMenu | MinimizeButton // non-resizable
+	} ;
+
+	enum class WindowShowMode : uint8_t {
+		Hidden           = 0,  // SW_HIDE
+		Normal           = 1,  // SW_SHOWNORMAL / SW_NORMAL
+		Minimized        = 2,  // SW_SHOWMINIMIZED
+		Maximized        = 3,  // SW_SHOWMAXIMIZED / SW_MAXIMIZE
+		NoActivate       = 4,  // SW_SHOWNOACTIVATE
+		Show             = 5,  // SW_SHOW
+		Minimize         = 6,  // SW_MINIMIZE
+		MinNoActivate    = 7,  // SW_SHOWMINNOACTIVE
+		ShowNoActivate   = 8,  // SW_SHOWNA
+		Restore          = 9,  // SW_RESTORE
+		Default          = 10, // SW_SHOWDEFAULT
+		ForceMinimize    = 11, // SW_FORCEMINIMIZE
+		Max              = 11  // SW_MAX
+	};
+
+	enum class WindowFlag : uint8_t {
+		None			= 0,
+		Registered		= 1 << 0,
+		Closed			= 1 << 1,
+		Destroyed		= 1 << 2,
+		Active			= 1 << 3,
+	} ;
+
+	enum class QueuePolicy : uint8_t {
+		Grow,			// gandakan kapasitas ke heap saat penuh
+		DropOldest,		// timpa event paling lama
+		DropNewest		// tolak event baru
+	} ;
+
+	enum class Coalesce : uint8_t {
+		None	= 0,
+		Move	= 1 << 0,	// MouseState::Move berurutan, ambil posisi terakhir
+		Resize	= 1 << 1,	// WindowState::Resize berurutan, ambil ukuran terakhir
+		Wheel	= 1 << 2,	// MouseState::Wheel berurutan, delta dijumlahkan
+		All		= Move | Resize | Wheel
+	} ;
+
+	// urutan dari yang paling lemah, level runtime tidak pernah melebihi yang didukung CPU
+	enum class SimdLevel : uint8_t {
+		Scalar,
+		SSE2,
+		AVX2,
+		NEON
+	} ;
+
+	// semua mode bekerja pada warna premultiplied. SourceOverGamma = source-over di ruang linear (lewat tabel sRGB),
+	// mode baru ditambahkan di akhir
+	enum class BlendMode : uint8_t {
+		SourceOver,
+		Multiply,
+		Screen,
+		SourceOverGamma
+	} ;
+
+	// nilainya ikut tersimpan di display list biner, jangan diubah urutannya
+	enum class DisplayOp : uint8_t {
+		FillRect,
+		FillRoundedRect,
+		Line,
+		Blit,
+		Text,
+		PushClip,
+		PopClip,
+		Count
+	} ;
+
+	enum class EventType : uint8_t {
+		None,
+		Window,
+		Mouse,
+		Key,
+		Widget,
+		User,
+	} ;
+
+	enum class WidgetState : uint8_t {
+		None,
+		Enter,		// kursor masuk widget interaktif
+		Leave,
+		Press,		// tombol mouse ditekan di atas widget
+		Release,	// tombol dilepas, dikirim ke widget yang menerima Press
+		Click		// Press dan Release di widget yang sama
+	} ;
+
+	// Row/Column menyusun anak sepanjang satu sumbu (flex), Stack menumpuk semua anak di area yang sama
+	enum class WidgetLayout : uint8_t {
+		Column,
+		Row,
+		Stack
+	} ;
+
+	// posisi anak di sumbu silang
+	enum class WidgetAlign : uint8_t {
+		Stretch,
+		Start,
+		Center,
+		End
+	} ;
+
+	enum class WidgetDirty : uint8_t {
+		None	= 0,
+		Measure	= 1 << 0,	// ukuran isi harus diukur ulang
+		Layout	= 1 << 1,	// posisi anak harus disusun ulang
+		Moved	= 1 << 2,	// bound berubah sejak sinkron terakhir ke SpatialIndex
+		Subtree	= 1 << 3	// ada turunan yang Moved
+	} ;
+
+	enum class WindowState : uint8_t {
+		None,
+		Close,
+		Minimize,
+		Maximize,
+		Resize,
+		Paint		// area client yang rusak menurut OS, rect ada di WindowEvent::GetRect
+	} ;
+
+	enum class MouseState : uint8_t {
+		None,
+		Move,
+		Up,
+		Down,
+		Middle,
+		DoubleClick,
+		Hover,
+		Wheel
+	} ;
+
+	enum class MouseButton : uint8_t {
+		None,
+		Left,
+		Right,
+		Middle,
+		Undefined
+	} ;
+
+	enum class KeyState : uint8_t {
+		None,
+		Up,
+		Down
+	} ;
+
+	enum class KeyCode : uint16_t {
+		// CONTROL & NAVIGATION
+		None		= 0,
+		Back		= 8,
+		Tab			= 9,
+		Enter		= 13,
+		Shift		= 16,
+		Control		= 17,
+		Alt			= 18,    // Alt
+		Pause		= 19,
+		CapsLock	= 20,
+		Escape		= 27,
+		Space		= 32,
+		PageUp		= 33,
+		PageDown	= 34,
+		End			= 35,
+		Home		= 36,
+		Left		= 37,
+		Up			= 38,
+		Right		= 39,
+		Down		= 40,
+		Insert		= 45,
+		Delete		= 46,
+
+		// NUMBER KEYS (TOP)
+		Number0 = 48,
+		Number1 = 49,
+		Number2 = 50,
+		Number3 = 51,
+		Number4 = 52,
+		Number5 = 53,
+		Number6 = 54,
+		Number7 = 55,
+		Number8 = 56,
+		Number9 = 57,
+
+		// LETTER KEYS (A–Z)
+		A = 65, B = 66, C = 67, D = 68, E = 69, F = 70, G = 71, H = 72,
+		I = 73, J = 74, K = 75, L = 76, M = 77, N = 78, O = 79, P = 80,
+		Q = 81, R = 82, S = 83, T = 84, U = 85, V = 86, W = 87, X = 88,
+		Y = 89, Z = 90,
+
+		// WINDOWS & MENU
+		LeftWindows  = 91,
+		RightWindows = 92,
+		Application  = 93,
+
+		// NUMPAD SECTION
+		NumPad0 = 96,
+		NumPad1 = 97,
+		NumPad2 = 98,
+		NumPad3 = 99,
+		NumPad4 = 100,
+		NumPad5 = 101,
+		NumPad6 = 102,
+		NumPad7 = 103,
+		NumPad8 = 104,
+		NumPad9 = 105,
+
+		Multiply	= 106,
+		Add			= 107,
+		Separator	= 108, // Enter (numeric)
+		Subtract	= 109,
+		Decimal		= 110,
+		Divide		= 111,
+		NumLock		= 144,
+
+		// FUNCTION KEYS
+		F1 = 112, F2 = 113, F3 = 114, F4 = 115, F5 = 116, F6 = 117,
+		F7 = 118, F8 = 119, F9 = 120, F10 = 121, F11 = 122, F12 = 123,
+		F13 = 124, F14 = 125, F15 = 126, F16 = 127, F17 = 128, F18 = 129,
+		F19 = 130, F20 = 131, F21 = 132, F22 = 133, F23 = 134, F24 = 135,
+
+		// MODIFIER KEYS
+		LeftShift		= 160,
+		RightShift		= 161,
+		LeftControl		= 162,
+		RightControl	= 163,
+		LeftAlt			= 164,
+		RightAlt		= 165,
+
+		// GAMEPAD / CONTROLLER
+		GamepadA						= 195,
+		GamepadB						= 196,
+		GamepadX						= 197,
+		GamepadY						= 198,
+		GamepadRightShoulder			= 199,
+		GamepadLeftShoulder				= 200,
+		GamepadLeftTrigger				= 201,
+		GamepadRightTrigger				= 202,
+		GamepadDPadUp					= 203,
+		GamepadDPadDown					= 204,
+		GamepadDPadLeft					= 205,
+		GamepadDPadRight				= 206,
+		GamepadMenu						= 207,
+		GamepadView						= 208,
+		GamepadLeftThumbstickButton		= 209,
+		GamepadRightThumbstickButton	= 210,
+		GamepadLeftThumbstickUp			= 211,
+		GamepadLeftThumbstickDown		= 212,
+		GamepadLeftThumbstickRight		= 213,
+		GamepadLeftThumbstickLeft		= 214,
+		GamepadRightThumbstickUp		= 215,
+		GamepadRightThumbstickDown		= 216,
+		GamepadRightThumbstickRight		= 217,
+		GamepadRightThumbstickLeft		= 218
+	} ;
 }
\ No newline at end of file
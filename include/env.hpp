@@ -1,23 +1,49 @@
-#pragma once
-
-// windows API
-
-#include <windows.h>
-#include <windowsx.h>
-
-// standard header
-
-#include <cstdint>
-#include <type_traits>
-#include <concepts>
-#include <limits>
-#include <utility>
-#include <string>
-#include <algorithm>
-#include <memory>
-#include <optional>
-#include <variant>
-#include <queue>
-#include <vector>
-#include <unordered_map>
-#include <exception>
\ No newline at end of file
+#pragma once
+
+// windows API
+
+#ifdef _WIN32
+	#include <windows.h>
+	#include <windowsx.h>
+#endif
+
+// posix
+
+#ifndef _WIN32
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+// standard header
+
+#include <cstdint>
+#include <cassert>
+#include <type_traits>
+#include <concepts>
+#include <limits>
+#include <utility>
+#include <string>
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <queue>
+#include <vector>
+#include <unordered_map>
+#include <exception>
+#include <bit>
+#include <cstring>
+#include <new>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <array>
+#include <tuple>
+#include <functional>
+#include <span>
+#include <fstream>
+#include <thread>
+#include <cmath>
\ No newline at end of file
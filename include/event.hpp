@@ -1,115 +1,201 @@
-#pragma once
-
-#include "unit.hpp"
-
-namespace zz {
-
-	class Event {
-	protected :
-		EventType type_ = EventType::None ;
-		HWND handle_ = nullptr ;
-
-		Event(HWND handle, EventType type) noexcept : handle_(handle), type_(type) {}
-
-	public :
-		Event() noexcept = default ;
-		Event(const Event&) noexcept = default ;
-		Event(Event&&) noexcept = default ;
-		Event& operator=(const Event&) noexcept = default ;
-		Event& operator=(Event&&) noexcept = default ;
-		virtual ~Event() noexcept = default ;
-
-		EventType GetType() const noexcept { return type_ ; }
-		HWND GetHandle() const noexcept { return handle_ ; }
-		const Window* GetContext() const noexcept ;
-
-		bool IsWindowEvent() const noexcept { return type_ == EventType::Window ; }
-		bool IsKeyEvent() const noexcept { return type_ == EventType::Key ; }
-		bool IsMouseEvent() const noexcept { return type_ == EventType::Mouse ; }
-	} ;
-
-	class WindowEvent : public Event, public Size<uint16_t> {
-	private :
-		WindowState state_ = WindowState::None ;
-
-		template <Arithmetic type>
-		WindowEvent(HWND handle, WindowState state, const Size<type> size) noexcept : Size(size), state_(state), Event(handle, EventType::Window) {}
-
-	public :
-		WindowEvent() noexcept = default ;
-		WindowEvent(const WindowEvent&) noexcept = default ;
-		WindowEvent& operator=(const WindowEvent&) noexcept = default ;
-		WindowEvent(WindowEvent&&) noexcept = default ;
-		WindowEvent& operator=(WindowEvent&&) noexcept = default ;
-
-		WindowState GetState() const noexcept { return state_ ; }
-		Size<uint16_t> GetValue() const noexcept { return this->GetSize() ; }
-	} ;
-
-	class MouseEvent : public Event, public  Size<uint16_t> {
-	protected :
-		MouseState type_ = MouseState::None ;
-		MouseButton button_ = MouseButton::None ;
-
-	public :
-		virtual ~MouseEvent() noexcept = default ;
-	} ;
-
-	class MouseDelta : public MouseEvent {
-	private :
-		float value_ = 0.0f ;
-
-		template <Arithmetic type>
-		MouseDelta(type value) noexcept : value_(value) {}
-
-	public :
-		MouseDelta() noexcept = default ;
-		MouseDelta(const MouseDelta&) noexcept = default ;
-		MouseDelta& operator=(const MouseDelta&) noexcept = default ;
-		MouseDelta(MouseDelta&&) noexcept = default ;
-		MouseDelta& operator=(MouseDelta&&) noexcept = default ;
-
-		float GetValue() const noexcept { return value_ ; }
-	} ;
-
-	class MousePos : public MouseEvent, public Point<float> {
-	private :
-		template <Arithmetic type>
-		MousePos(const Point<type>& value) noexcept : Point(value) {}
-
-	public :
-		MousePos() noexcept = default ;
-		MousePos(const MousePos&) noexcept = default ;
-		MousePos& operator=(const MousePos&) noexcept = default ;
-		MousePos(MousePos&&) noexcept = default ;
-		MousePos& operator=(MousePos&&) noexcept = default ;
-		
-		Point<float> GetValue() const noexcept { return this->GetPoint() ; }
-	} ;
-
-	class KeyEvent {
-	private :
-		KeyState type_ = KeyState::None ;
-		KeyCode value_ = KeyCode::None ;
-
-		KeyEvent(KeyState type, KeyCode value) noexcept : type_(type), value_(value) {}
-	
-	public :
-		KeyEvent() noexcept = default ;
-		KeyEvent(const KeyEvent&) noexcept = default ;
-		KeyEvent& operator=(const KeyEvent&) noexcept = default ;
-		KeyEvent(KeyEvent&&) noexcept = default ;
-		KeyEvent& operator=(KeyEvent&&) noexcept = default ;
-
-		KeyState GetEvent() const noexcept { return type_ ; }
-		KeyCode GetValue() const noexcept { return value_ ; }
-	} ;
-
-	template <typename> struct is_event_type : std::false_type {} ;
-	template <> struct is_event_type<WindowEvent> : std::true_type {} ;
-	template <> struct is_event_type<MouseEvent> : std::true_type {} ;
-	template <> struct is_event_type<KeyEvent> : std::true_type {} ;
-	
-	template <typename T>
-	concept EventType_t = is_event_type<T>::value ;
+#pragma once
+
+#include "unit.hpp"
+#include "clock.hpp"
+#include "slotmap.hpp"
+
+namespace zz {
+
+	// payload hanya berisi field mentah supaya Event tetap trivially-copyable dan muat di union
+	class WindowEvent {
+	private :
+		WindowState state_ = WindowState::None ;
+		uint16_t w_ = 0 ;
+		uint16_t h_ = 0 ;
+		int16_t x_ = 0 ;
+		int16_t y_ = 0 ;
+
+	public :
+		constexpr WindowEvent() noexcept = default ;
+		constexpr WindowEvent(const WindowEvent&) noexcept = default ;
+		constexpr WindowEvent& operator=(const WindowEvent&) noexcept = default ;
+
+		template <Arithmetic type>
+		constexpr WindowEvent(WindowState state, const Size<type>& size) noexcept : state_(state), w_(static_cast<uint16_t>(size.w)), h_(static_cast<uint16_t>(size.h)) {}
+
+		// untuk WindowState::Paint
+		template <Arithmetic type>
+		constexpr WindowEvent(WindowState state, const Rect<type>& rect) noexcept : state_(state), w_(static_cast<uint16_t>(rect.GetSize().w)), h_(static_cast<uint16_t>(rect.GetSize().h)), x_(static_cast<int16_t>(rect.GetPoint().x)), y_(static_cast<int16_t>(rect.GetPoint().y)) {}
+
+		constexpr WindowState GetState() const noexcept { return state_ ; }
+		constexpr Size<uint16_t> GetValue() const noexcept { return Size<uint16_t>{w_, h_} ; }
+		constexpr Rect<int> GetRect() const noexcept { return Rect<int>(x_, y_, w_, h_) ; }
+	} ;
+
+	class MouseEvent {
+	private :
+		MouseState state_ = MouseState::None ;
+		MouseButton button_ = MouseButton::None ;
+		float x_ = 0.0f ;
+		float y_ = 0.0f ;
+
+	public :
+		constexpr MouseEvent() noexcept = default ;
+		constexpr MouseEvent(const MouseEvent&) noexcept = default ;
+		constexpr MouseEvent& operator=(const MouseEvent&) noexcept = default ;
+
+		// untuk MouseState::Wheel, value adalah delta (x horizontal, y vertikal) dalam satuan notch
+		template <Arithmetic type>
+		constexpr MouseEvent(MouseState state, MouseButton button, const Point<type>& value) noexcept : state_(state), button_(button), x_(static_cast<float>(value.x)), y_(static_cast<float>(value.y)) {}
+
+		constexpr MouseState GetState() const noexcept { return state_ ; }
+		constexpr MouseButton GetButton() const noexcept { return button_ ; }
+		constexpr Point<float> GetPosition() const noexcept { return state_ != MouseState::Wheel ? Point<float>{x_, y_} : Point<float>{} ; }
+		constexpr Point<float> GetDelta() const noexcept { return state_ == MouseState::Wheel ? Point<float>{x_, y_} : Point<float>{} ; }
+	} ;
+
+	class KeyEvent {
+	private :
+		KeyState state_ = KeyState::None ;
+		KeyCode value_ = KeyCode::None ;
+
+	public :
+		constexpr KeyEvent() noexcept = default ;
+		constexpr KeyEvent(const KeyEvent&) noexcept = default ;
+		constexpr KeyEvent& operator=(const KeyEvent&) noexcept = default ;
+
+		constexpr KeyEvent(KeyState state, KeyCode value) noexcept : state_(state), value_(value) {}
+
+		constexpr KeyState GetState() const noexcept { return state_ ; }
+		constexpr KeyCode GetValue() const noexcept { return value_ ; }
+	} ;
+
+	// widget disimpan sebagai index + generation SlotHandle, jadi event untuk widget yang sudah dihapus mudah dikenali
+	class WidgetEvent {
+	private :
+		WidgetState state_ = WidgetState::None ;
+		uint32_t index_ = SlotHandle::invalid_index ;
+		uint32_t generation_ = 0 ;
+
+	public :
+		constexpr WidgetEvent() noexcept = default ;
+		constexpr WidgetEvent(const WidgetEvent&) noexcept = default ;
+		constexpr WidgetEvent& operator=(const WidgetEvent&) noexcept = default ;
+
+		constexpr WidgetEvent(WidgetState state, SlotHandle widget) noexcept : state_(state), index_(widget.index), generation_(widget.generation) {}
+
+		constexpr WidgetState GetState() const noexcept { return state_ ; }
+		constexpr SlotHandle GetWidget() const noexcept { return SlotHandle{index_, generation_} ; }
+	} ;
+
+	// event bebas dari aplikasi, biasanya di-post dari worker thread lewat EventSys::PostEvent
+	class UserEvent {
+	private :
+		uint32_t code_ = 0 ;
+		uint32_t data_[2] = {} ;
+
+	public :
+		constexpr UserEvent() noexcept = default ;
+		constexpr UserEvent(const UserEvent&) noexcept = default ;
+		constexpr UserEvent& operator=(const UserEvent&) noexcept = default ;
+
+		constexpr UserEvent(uint32_t code, uint64_t data = 0) noexcept : code_(code), data_{static_cast<uint32_t>(data), static_cast<uint32_t>(data >> 32)} {}
+
+		template <typename type>
+		UserEvent(uint32_t code, type* pointer) noexcept : UserEvent(code, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer))) {}
+
+		constexpr uint32_t GetCode() const noexcept { return code_ ; }
+		constexpr uint64_t GetData() const noexcept { return (static_cast<uint64_t>(data_[1]) << 32) | data_[0] ; }
+
+		template <typename type>
+		type* GetPointer() const noexcept { return reinterpret_cast<type*>(static_cast<uintptr_t>(GetData())) ; }
+	} ;
+
+	template <typename> struct is_event_type : std::false_type {} ;
+	template <> struct is_event_type<WindowEvent> : std::true_type {} ;
+	template <> struct is_event_type<MouseEvent> : std::true_type {} ;
+	template <> struct is_event_type<KeyEvent> : std::true_type {} ;
+	template <> struct is_event_type<WidgetEvent> : std::true_type {} ;
+	template <> struct is_event_type<UserEvent> : std::true_type {} ;
+
+	template <typename T>
+	concept EventType_t = is_event_type<T>::value ;
+
+	template <EventType_t> struct event_type_of ;
+	template <> struct event_type_of<WindowEvent> : std::integral_constant<EventType, EventType::Window> {} ;
+	template <> struct event_type_of<MouseEvent> : std::integral_constant<EventType, EventType::Mouse> {} ;
+	template <> struct event_type_of<KeyEvent> : std::integral_constant<EventType, EventType::Key> {} ;
+	template <> struct event_type_of<WidgetEvent> : std::integral_constant<EventType, EventType::Widget> {} ;
+	template <> struct event_type_of<UserEvent> : std::integral_constant<EventType, EventType::User> {} ;
+
+	// satu record 32 byte: handle, timestamp (Now() saat dibuat), tag dan payload
+	class Event {
+	private :
+		WindowHandle handle_ = nullptr ;
+		uint64_t time_ = 0 ;
+		EventType type_ = EventType::None ;
+		union {
+			WindowEvent window_ ;
+			MouseEvent mouse_ ;
+			KeyEvent key_ ;
+			WidgetEvent widget_ ;
+			UserEvent user_ ;
+		} ;
+
+	public :
+		Event() noexcept : window_() {}
+		Event(const Event&) noexcept = default ;
+		Event& operator=(const Event&) noexcept = default ;
+
+		Event(WindowHandle handle, const WindowEvent& e, uint64_t time = Now()) noexcept : handle_(handle), time_(time), type_(EventType::Window), window_(e) {}
+		Event(WindowHandle handle, const MouseEvent& e, uint64_t time = Now()) noexcept : handle_(handle), time_(time), type_(EventType::Mouse), mouse_(e) {}
+		Event(WindowHandle handle, const KeyEvent& e, uint64_t time = Now()) noexcept : handle_(handle), time_(time), type_(EventType::Key), key_(e) {}
+		Event(WindowHandle handle, const WidgetEvent& e, uint64_t time = Now()) noexcept : handle_(handle), time_(time), type_(EventType::Widget), widget_(e) {}
+		Event(WindowHandle handle, const UserEvent& e, uint64_t time = Now()) noexcept : handle_(handle), time_(time), type_(EventType::User), user_(e) {}
+
+		EventType GetType() const noexcept { return type_ ; }
+		WindowHandle GetHandle() const noexcept { return handle_ ; }
+		uint64_t GetTime() const noexcept { return time_ ; }
+		void SetTime(uint64_t time) noexcept { time_ = time ; }
+		const Window* GetContext() const noexcept ;
+
+		bool IsWindowEvent() const noexcept { return type_ == EventType::Window ; }
+		bool IsKeyEvent() const noexcept { return type_ == EventType::Key ; }
+		bool IsMouseEvent() const noexcept { return type_ == EventType::Mouse ; }
+		bool IsWidgetEvent() const noexcept { return type_ == EventType::Widget ; }
+		bool IsUserEvent() const noexcept { return type_ == EventType::User ; }
+
+		// tidak dicek, pastikan GetType() cocok dulu
+		const WindowEvent& GetWindowEvent() const noexcept { return window_ ; }
+		const MouseEvent& GetMouseEvent() const noexcept { return mouse_ ; }
+		const KeyEvent& GetKeyEvent() const noexcept { return key_ ; }
+		const WidgetEvent& GetWidgetEvent() const noexcept { return widget_ ; }
+		const UserEvent& GetUserEvent() const noexcept { return user_ ; }
+
+		WindowEvent& GetWindowEvent() noexcept { return window_ ; }
+		MouseEvent& GetMouseEvent() noexcept { return mouse_ ; }
+		KeyEvent& GetKeyEvent() noexcept { return key_ ; }
+		WidgetEvent& GetWidgetEvent() noexcept { return widget_ ; }
+		UserEvent& GetUserEvent() noexcept { return user_ ; }
+
+		template <EventType_t type>
+		const type& Get() const noexcept {
+			if constexpr (std::is_same_v<type, WindowEvent>) {
+				return window_ ;
+			} else if constexpr (std::is_same_v<type, MouseEvent>) {
+				return mouse_ ;
+			} else if constexpr (std::is_same_v<type, KeyEvent>) {
+				return key_ ;
+			} else if constexpr (std::is_same_v<type, WidgetEvent>) {
+				return widget_ ;
+			} else {
+				return user_ ;
+			}
+		}
+
+		template <EventType_t type>
+		bool Is() const noexcept { return type_ == event_type_of<type>::value ; }
+	} ;
+
+	static_assert(std::is_trivially_copyable_v<Event> && sizeof(Event) <= 32) ;
 }
\ No newline at end of file
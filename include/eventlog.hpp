@@ -0,0 +1,288 @@
+#pragma once
+
+#include "event.hpp"
+
+namespace zz {
+
+	// file yang di-map ke memori, mode tulis bisa tumbuh (remap) dan dipotong ke ukuran akhir saat Close
+	class MappedFile {
+	private :
+		uint8_t* data_ = nullptr ;
+		size_t size_ = 0 ;
+		bool writable_ = false ;
+
+		#ifdef _WIN32
+			HANDLE file_ = INVALID_HANDLE_VALUE ;
+			HANDLE mapping_ = nullptr ;
+		#else
+			int file_ = -1 ;
+		#endif
+
+		bool map(size_t size) noexcept {
+			#ifdef _WIN32
+				mapping_ = CreateFileMappingA(file_, nullptr, writable_ ? PAGE_READWRITE : PAGE_READONLY, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), nullptr) ;
+				if (!mapping_) {
+					return false ;
+				}
+
+				data_ = static_cast<uint8_t*>(MapViewOfFile(mapping_, writable_ ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size)) ;
+			#else
+				void* data = mmap(nullptr, size, writable_ ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, file_, 0) ;
+				data_ = data == MAP_FAILED ? nullptr : static_cast<uint8_t*>(data) ;
+			#endif
+
+			size_ = data_ ? size : 0 ;
+			return data_ != nullptr ;
+		}
+
+		void unmap() noexcept {
+			#ifdef _WIN32
+				if (data_) {
+					UnmapViewOfFile(data_) ;
+				}
+				if (mapping_) {
+					CloseHandle(mapping_) ;
+					mapping_ = nullptr ;
+				}
+			#else
+				if (data_) {
+					munmap(data_, size_) ;
+				}
+			#endif
+
+			data_ = nullptr ;
+			size_ = 0 ;
+		}
+
+		bool truncate(size_t size) noexcept {
+			#ifdef _WIN32
+				LARGE_INTEGER offset {} ;
+				offset.QuadPart = static_cast<long long>(size) ;
+				return SetFilePointerEx(file_, offset, nullptr, FILE_BEGIN) && SetEndOfFile(file_) ;
+			#else
+				return ftruncate(file_, static_cast<off_t>(size)) == 0 ;
+			#endif
+		}
+
+	public :
+		MappedFile() noexcept = default ;
+		MappedFile(const MappedFile&) = delete ;
+		MappedFile& operator=(const MappedFile&) = delete ;
+
+		~MappedFile() noexcept {
+			Close() ;
+		}
+
+		// writable: file dibuat ulang dengan ukuran awal size, selain itu di-map seluruhnya read-only
+		bool Open(const char* path, bool writable, size_t size = 0) noexcept {
+			Close() ;
+			writable_ = writable ;
+
+			#ifdef _WIN32
+				file_ = CreateFileA(path, writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ, nullptr, writable ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) ;
+				if (file_ == INVALID_HANDLE_VALUE) {
+					return false ;
+				}
+
+				if (!writable) {
+					LARGE_INTEGER file_size {} ;
+					GetFileSizeEx(file_, &file_size) ;
+					size = static_cast<size_t>(file_size.QuadPart) ;
+				}
+			#else
+				file_ = open(path, writable ? O_RDWR | O_CREAT | O_TRUNC : O_RDONLY, 0644) ;
+				if (file_ < 0) {
+					return false ;
+				}
+
+				if (!writable) {
+					struct stat info {} ;
+					fstat(file_, &info) ;
+					size = static_cast<size_t>(info.st_size) ;
+				}
+			#endif
+
+			if (size == 0 || (writable && !truncate(size)) || !map(size)) {
+				Close() ;
+				return false ;
+			}
+
+			return true ;
+		}
+
+		// hanya mode tulis, isi lama tetap ada
+		bool Resize(size_t size) noexcept {
+			if (!writable_) {
+				return false ;
+			}
+
+			unmap() ;
+			return truncate(size) && map(size) ;
+		}
+
+		// final_size != 0 memotong file ke ukuran data yang benar-benar ditulis
+		void Close(size_t final_size = 0) noexcept {
+			unmap() ;
+
+			#ifdef _WIN32
+				if (file_ != INVALID_HANDLE_VALUE) {
+					if (final_size) {
+						truncate(final_size) ;
+					}
+					CloseHandle(file_) ;
+					file_ = INVALID_HANDLE_VALUE ;
+				}
+			#else
+				if (file_ >= 0) {
+					if (final_size) {
+						truncate(final_size) ;
+					}
+					close(file_) ;
+					file_ = -1 ;
+				}
+			#endif
+		}
+
+		uint8_t* GetData() noexcept { return data_ ; }
+		const uint8_t* GetData() const noexcept { return data_ ; }
+		size_t GetSize() const noexcept { return size_ ; }
+		bool IsOpen() const noexcept { return data_ != nullptr ; }
+	} ;
+
+	struct EventLogHeader {
+		char magic[4] = {'Z', 'Z', 'E', 'V'} ;
+		uint32_t version = 1 ;
+		uint32_t record_size = sizeof(Event) ;
+		uint32_t reserved = 0 ;
+		uint64_t count = 0 ;
+	} ;
+
+	// log biner: header lalu Event mentah berurutan, Event trivially-copyable jadi cukup memcpy
+	class EventRecorder {
+	private :
+		static constexpr size_t initial_size_ = 1 << 20 ;
+
+		MappedFile file_ {} ;
+		uint64_t count_ = 0 ;
+
+		size_t offset_of(uint64_t index) const noexcept {
+			return sizeof(EventLogHeader) + static_cast<size_t>(index) * sizeof(Event) ;
+		}
+
+	public :
+		EventRecorder() noexcept = default ;
+		EventRecorder(const EventRecorder&) = delete ;
+		EventRecorder& operator=(const EventRecorder&) = delete ;
+
+		~EventRecorder() noexcept {
+			Close() ;
+		}
+
+		bool Open(const char* path) noexcept {
+			count_ = 0 ;
+			if (!file_.Open(path, true, initial_size_)) {
+				return false ;
+			}
+
+			const EventLogHeader header {} ;
+			std::memcpy(file_.GetData(), &header, sizeof(header)) ;
+			return true ;
+		}
+
+		bool Append(const Event& event) noexcept {
+			if (!file_.IsOpen()) {
+				return false ;
+			}
+
+			if (offset_of(count_ + 1) > file_.GetSize() && !file_.Resize(file_.GetSize() * 2)) {
+				return false ;
+			}
+
+			std::memcpy(file_.GetData() + offset_of(count_), &event, sizeof(Event)) ;
+			++count_ ;
+			return true ;
+		}
+
+		void Close() noexcept {
+			if (!file_.IsOpen()) {
+				return ;
+			}
+
+			EventLogHeader header {} ;
+			header.count = count_ ;
+			std::memcpy(file_.GetData(), &header, sizeof(header)) ;
+			file_.Close(offset_of(count_)) ;
+		}
+
+		uint64_t GetCount() const noexcept { return count_ ; }
+		bool IsOpen() const noexcept { return file_.IsOpen() ; }
+	} ;
+
+	class EventReplay {
+	private :
+		MappedFile file_ {} ;
+		uint64_t count_ = 0 ;
+		uint64_t cursor_ = 0 ;
+
+	public :
+		EventReplay() noexcept = default ;
+		EventReplay(const EventReplay&) = delete ;
+		EventReplay& operator=(const EventReplay&) = delete ;
+
+		bool Open(const char* path) noexcept {
+			count_ = cursor_ = 0 ;
+			if (!file_.Open(path, false)) {
+				return false ;
+			}
+
+			EventLogHeader header {} ;
+			const EventLogHeader expected {} ;
+			if (file_.GetSize() < sizeof(header)) {
+				file_.Close() ;
+				return false ;
+			}
+
+			std::memcpy(&header, file_.GetData(), sizeof(header)) ;
+			if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.version != expected.version || header.record_size != sizeof(Event)) {
+
+				#ifdef EVENTLOG_DEBUG
+					logger::error("EventReplay::Open - Incompatible event log.") ;
+				#endif
+
+				file_.Close() ;
+				return false ;
+			}
+
+			count_ = std::min<uint64_t>(header.count, (file_.GetSize() - sizeof(header)) / sizeof(Event)) ;
+			return true ;
+		}
+
+		bool Next(Event& event) noexcept {
+			if (cursor_ >= count_) {
+				return false ;
+			}
+
+			std::memcpy(&event, file_.GetData() + sizeof(EventLogHeader) + static_cast<size_t>(cursor_) * sizeof(Event), sizeof(Event)) ;
+			++cursor_ ;
+			return true ;
+		}
+
+		void Rewind() noexcept { cursor_ = 0 ; }
+		void Close() noexcept { file_.Close() ; count_ = cursor_ = 0 ; }
+
+		uint64_t GetCount() const noexcept { return count_ ; }
+		uint64_t GetCursor() const noexcept { return cursor_ ; }
+		bool IsOpen() const noexcept { return file_.IsOpen() ; }
+		bool IsDone() const noexcept { return cursor_ >= count_ ; }
+	} ;
+
+	struct ReplayStats {
+		uint64_t events = 0 ;
+		uint64_t dropped = 0 ;		// tidak masuk queue (penuh), atau menimpa event lain pada DropOldest
+		uint64_t begin = 0 ;
+		uint64_t end = 0 ;
+
+		double Seconds() const noexcept { return static_cast<double>(end - begin) / 1e9 ; }
+		double EventsPerSecond() const noexcept { return end > begin ? static_cast<double>(events) / Seconds() : 0.0 ; }
+	} ;
+}
\ No newline at end of file
@@ -1,108 +1,294 @@
-#pragma once
-
-#include "event.hpp"
-
-namespace zz {
-
-	inline bool PollEvent(Event& e) noexcept ;
-	inline LRESULT CALLBACK WindowProcedure(HWND, uint32_t, uint64_t, int64_t) noexcept ;
-
-	class EventSys {
-		friend inline bool PollEvent(Event& e) noexcept ;
-		friend inline LRESULT CALLBACK WindowProcedure(HWND, uint32_t, uint64_t, int64_t) noexcept ;
-	private :
-		static inline std::queue<std::unique_ptr<Event>> g_events_ {} ;
-
-		static Event CreateEventFromMSG(const MSG& msg) noexcept {
-			switch (msg.message) {
-				case WM_LBUTTONDOWN :
-					PushEvent<MouseEvent>(msg.hwnd, MouseEvent{MouseState::Down, MouseButton::Left, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}) ;
-					break ;
-				case WM_RBUTTONDOWN :
-					return Event{msg.hwnd, MouseEvent{MouseEvent::Down, MouseButton::Right, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_MBUTTONDOWN :
-					return Event{msg.hwnd, MouseEvent{MouseEvent::Down, MouseButton::Middle, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_LBUTTONUP :
-					return Event{msg.hwnd, MouseEvent{MouseEvent::Up, MouseButton::Left, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_RBUTTONUP :
-					return Event{msg.hwnd, MouseEvent{MouseEvent::Up, MouseButton::Right, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_MBUTTONUP :
-					return Event{msg.hwnd, MouseEvent{MouseEvent::Up, MouseButton::Middle, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_MOUSEHWHEEL :
-					return Event{msg.hwnd, MouseEvent{static_cast<float>(GET_WHEEL_DELTA_WPARAM(msg.wParam))}} ;
-				case WM_MOUSEMOVE : 
-					return Event{msg.hwnd, MouseEvent{MouseEvent::Move, MouseButton::None, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_LBUTTONDBLCLK : 
-					return Event{msg.hwnd, MouseEvent{MouseEvent::DoubleClick, MouseButton::Left, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_RBUTTONDBLCLK : 
-					return Event{msg.hwnd, MouseEvent{MouseEvent::DoubleClick, MouseButton::Right, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_MBUTTONDBLCLK : 
-					return Event{msg.hwnd, MouseEvent{MouseEvent::DoubleClick, MouseButton::Middle, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_MOUSEHOVER :
-					return Event{msg.hwnd, MouseEvent{MouseEvent::Hover, MouseButton::None, Point{GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam)}}} ;
-				case WM_KEYDOWN :
-					return Event{msg.hwnd, KeyEvent{KeyEvent::Down, static_cast<KeyCode>(msg.wParam)}} ;
-				case WM_KEYUP :
-					return Event{msg.hwnd, KeyEvent{KeyEvent::Up, static_cast<KeyCode>(msg.wParam)}} ;
-			}
-
-			return Event{} ;
-		}
-
-	public :
-		template <EventType_t event, typename ... Args>
-		static void PushEvent(Args&& ... args) noexcept {
-			if (std::is_same_v<event, MouseEvent>) {
-				g_events_.emplace(std::make_unique<event>(std::make_unique<MouseEvent>(std::forward<Args>(args)...))) ;
-			} else {
-				g_events_.emplace(std::make_unique<event>(std::forward<Args>(args)...)) ;
-			}
-		}
-
-		static bool PollEvent(Event& event) noexcept {
-			if (g_events_.empty()) {
-				return false ;
-			}
-
-			event = *g_events_.front().release() ;
-			g_events_.pop() ;
-			return true ;
-		}
-
-		static bool PeekEvent(Event& event) noexcept {
-			if (g_events_.empty()) {
-				return false ;
-			}
-
-			event = *g_events_.front() ;
-			return true ;			
-		}
-
-		static void ClearEvent() noexcept {
-			while (!g_events_.empty()) {
-				g_events_.pop() ;
-			}
-		}
-	} ;
-
-	inline bool PollEvent(Event& event) noexcept {
-		if (EventSys::PollEvent(event)) {
-			return true ;
-		}
-
-		MSG msg{} ;
-		while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
-			std::make_unique<Event> event = EventSys::CreateEventFromMSG(msg) ;
-
-			if (event.GetType() != EventType::None) {
-				EventSys::PushEvent(event) ;
-			}
-
-			TranslateMessage(&msg) ;
-			DispatchMessage(&msg) ;
-		}
-
-		return EventSys::PollEvent(event) ;
-	}
-
+#pragma once
+
+#include "latency.hpp"
+#include "ringbuffer.hpp"
+#include "mpsc.hpp"
+#include "eventlog.hpp"
+#include "backend_win32.hpp"
+#include "backend_headless.hpp"
+
+namespace zz {
+
+	struct EventStats {
+		uint64_t pushed = 0 ;
+		uint64_t posted = 0 ;
+		uint64_t dropped = 0 ;		// ditolak (DropNewest, Grow mentok) atau ditimpa (DropOldest)
+		uint64_t merged_move = 0 ;
+		uint64_t merged_resize = 0 ;
+		uint64_t merged_wheel = 0 ;
+
+		uint64_t Merged() const noexcept { return merged_move + merged_resize + merged_wheel ; }
+	} ;
+
+	// backend bawaan platform, dipakai kalau SetBackend tidak pernah dipanggil
+	inline Backend& DefaultBackend() noexcept {
+		#ifdef _WIN32
+			static Win32Backend backend {} ;
+		#else
+			static HeadlessBackend backend {} ;
+		#endif
+		return backend ;
+	}
+
+	inline bool PollEvent(Event& e) noexcept ;
+	inline bool WaitEvent(Event& e, uint32_t timeout_ms) noexcept ;
+
+	class EventSys {
+		friend inline bool PollEvent(Event& e) noexcept ;
+		friend inline bool WaitEvent(Event& e, uint32_t timeout_ms) noexcept ;
+	private :
+		static Backend* install(Backend& backend) noexcept {
+			backend.SetSink(&EventSys::PushEvent) ;
+			return &backend ;
+		}
+
+		static inline RingBuffer<Event> g_events_ {} ;
+		static inline Coalesce g_coalesce_ = Coalesce::None ;
+		static inline EventStats g_stats_ {} ;
+		static inline MpscQueue<Event> g_inbox_ {} ;
+		static inline Backend* g_backend_ = install(DefaultBackend()) ;
+		static inline std::atomic<uint64_t> g_posted_ {0} ;
+
+		static inline EventRecorder g_recorder_ {} ;
+		static inline EventReplay g_replay_ {} ;
+		static inline ReplayStats g_replay_stats_ {} ;
+		static inline uint64_t g_replay_shift_ = 0 ;
+
+		static constexpr size_t inbox_batch_ = 64 ;
+		static constexpr size_t replay_batch_ = 64 ;
+
+		// langsung ke queue tanpa coalescing supaya urutan hasil replay sama persis dengan rekaman. jarak waktu antar
+		// event rekaman dipertahankan, digeser supaya event pertama jatuh di awal replay (selisih unsigned, boleh wrap).
+		// log yang habis langsung ditutup, PollEvent berikutnya kembali membaca input backend
+		static size_t feed_replay() noexcept {
+			size_t count = 0 ;
+			uint64_t dropped = 0 ;
+			Event event ;
+			while (count < replay_batch_ && g_replay_.Next(event)) {
+				if (g_replay_.GetCursor() == 1) {
+					g_replay_shift_ = g_replay_stats_.begin - event.GetTime() ;
+				}
+				event.SetTime(event.GetTime() + g_replay_shift_) ;
+
+				const size_t size = g_events_.Size() ;
+				if (!g_events_.Push(event) || g_events_.Size() == size) {
+					++dropped ;
+				}
+				++count ;
+			}
+
+			g_replay_stats_.events += count - dropped ;
+			g_replay_stats_.dropped += dropped ;
+			g_replay_stats_.end = Now() ;
+			if (g_replay_.IsDone()) {
+				g_replay_.Close() ;
+			}
+			return count ;
+		}
+
+		// hanya event terakhir di queue yang dicek, jadi urutan button/key tidak pernah berubah
+		static bool coalesce(const Event& event) noexcept {
+			Event* back = g_events_.Back() ;
+			if (!back || back->GetType() != event.GetType() || back->GetHandle() != event.GetHandle()) {
+				return false ;
+			}
+
+			if (event.IsMouseEvent()) {
+				const MouseEvent& prev = back->GetMouseEvent() ;
+				const MouseEvent& next = event.GetMouseEvent() ;
+				if (prev.GetState() != next.GetState()) {
+					return false ;
+				}
+
+				if (next.GetState() == MouseState::Move && static_cast<bool>(g_coalesce_ & Coalesce::Move)) {
+					*back = Event{event.GetHandle(), next, back->GetTime()} ;
+					++g_stats_.merged_move ;
+					return true ;
+				}
+
+				if (next.GetState() == MouseState::Wheel && static_cast<bool>(g_coalesce_ & Coalesce::Wheel)) {
+					*back = Event{event.GetHandle(), MouseEvent{MouseState::Wheel, MouseButton::None, prev.GetDelta() + next.GetDelta()}, back->GetTime()} ;
+					++g_stats_.merged_wheel ;
+					return true ;
+				}
+			} else if (event.IsWindowEvent()) {
+				const WindowEvent& next = event.GetWindowEvent() ;
+				if (next.GetState() == WindowState::Resize && back->GetWindowEvent().GetState() == WindowState::Resize && static_cast<bool>(g_coalesce_ & Coalesce::Resize)) {
+					*back = Event{event.GetHandle(), next, back->GetTime()} ;
+					++g_stats_.merged_resize ;
+					return true ;
+				}
+			}
+
+			return false ;
+		}
+
+	public :
+		static bool PushEvent(const Event& event) noexcept {
+			++g_stats_.pushed ;
+			if (g_coalesce_ != Coalesce::None && coalesce(event)) {
+				return true ;
+			}
+
+			// DropOldest menimpa event paling lama dan Push tetap true, ukuran queue yang tidak bertambah menandai
+			// ada event yang hilang
+			const size_t size = g_events_.Size() ;
+			if (!g_events_.Push(event)) {
+				++g_stats_.dropped ;
+				return false ;
+			}
+
+			if (g_events_.Size() == size) {
+				++g_stats_.dropped ;
+			}
+			return true ;
+		}
+
+		static bool PollEvent(Event& event) noexcept {
+			if (g_events_.Empty()) {
+				g_inbox_.Drain([](const Event& e) { PushEvent(e) ; }, inbox_batch_) ;
+			}
+
+			if (!g_events_.Pop(event)) {
+				return false ;
+			}
+
+			Latency::RecordPoll(event) ;
+			if (g_recorder_.IsOpen()) {
+				g_recorder_.Append(event) ;
+			}
+			return true ;
+		}
+
+		// aman dari thread manapun. event masuk ke inbox lalu dipindah ke queue utama oleh PollEvent di thread UI.
+		// false kalau inbox penuh
+		static bool PostEvent(const Event& event) noexcept {
+			if (!g_inbox_.TryPush(event)) {
+				return false ;
+			}
+
+			g_posted_.fetch_add(1, std::memory_order_relaxed) ;
+			g_backend_->Wake() ;
+			return true ;
+		}
+
+		static bool PeekEvent(Event& event) noexcept {
+			return g_events_.Peek(event) ;
+		}
+
+		static void ClearEvent() noexcept {
+			g_events_.Clear() ;
+			g_events_.ShrinkToFit() ;
+		}
+
+		static void SetQueuePolicy(QueuePolicy policy, size_t max_capacity) noexcept {
+			g_events_.SetPolicy(policy, max_capacity) ;
+		}
+
+		// opt-in, default Coalesce::None supaya setiap message tetap jadi satu event
+		static void SetCoalesce(Coalesce mode) noexcept {
+			g_coalesce_ = mode ;
+		}
+
+		static Coalesce GetCoalesce() noexcept {
+			return g_coalesce_ ;
+		}
+
+		// merekam semua event yang keluar dari PollEvent ke file log
+		static bool StartRecording(const char* path) noexcept {
+			return g_recorder_.Open(path) ;
+		}
+
+		static void StopRecording() noexcept {
+			g_recorder_.Close() ;
+		}
+
+		// selama replay, PollEvent mengambil event dari log dan tidak membaca message OS sama sekali.
+		// replay berhenti sendiri di akhir log (IsReplaying jadi false), statistiknya tetap bisa dibaca
+		static bool StartReplay(const char* path) noexcept {
+			if (!g_replay_.Open(path)) {
+				return false ;
+			}
+
+			g_replay_stats_ = {} ;
+			g_replay_stats_.begin = g_replay_stats_.end = Now() ;
+			return true ;
+		}
+
+		static void StopReplay() noexcept {
+			g_replay_.Close() ;
+		}
+
+		static bool IsReplaying() noexcept {
+			return g_replay_.IsOpen() ;
+		}
+
+		static const ReplayStats& GetReplayStats() noexcept {
+			return g_replay_stats_ ;
+		}
+
+		// membangunkan WaitEvent yang sedang blocking, aman dari thread manapun
+		static void Wakeup() noexcept {
+			g_backend_->Wake() ;
+		}
+
+		// dipanggil sebelum window pertama dibuat, backend harus hidup selama program berjalan
+		static void SetBackend(Backend& backend) noexcept {
+			g_backend_ = install(backend) ;
+		}
+
+		static Backend& GetBackend() noexcept {
+			return *g_backend_ ;
+		}
+
+		static const EventStats& GetStats() noexcept {
+			g_stats_.posted = g_posted_.load(std::memory_order_relaxed) ;
+			return g_stats_ ;
+		}
+
+		static void ResetStats() noexcept {
+			g_stats_ = {} ;
+			g_posted_.store(0, std::memory_order_relaxed) ;
+		}
+	} ;
+
+	inline bool PollEvent(Event& event) noexcept {
+		if (EventSys::PollEvent(event)) {
+			return true ;
+		}
+
+		if (EventSys::IsReplaying() && EventSys::feed_replay() > 0) {
+			return EventSys::PollEvent(event) ;
+		}
+
+		EventSys::g_backend_->Pump() ;
+		return EventSys::PollEvent(event) ;
+	}
+
+	// blocking sampai ada event, Wakeup(), atau timeout habis. false kalau tidak ada event yang didapat
+	inline bool WaitEvent(Event& event, uint32_t timeout_ms = Waiter::Infinite) noexcept {
+		using clock = std::chrono::steady_clock ;
+		const auto deadline = clock::now() + std::chrono::milliseconds(timeout_ms) ;
+
+		while (!PollEvent(event)) {
+			uint32_t remaining = timeout_ms ;
+			if (timeout_ms != Waiter::Infinite) {
+				const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - clock::now()).count() ;
+				if (left <= 0) {
+					return false ;
+				}
+				remaining = static_cast<uint32_t>(left) ;
+			}
+
+			const WaitResult result = EventSys::g_backend_->Wait(remaining) ;
+			if (result == WaitResult::Notified) {
+				return PollEvent(event) ;
+			} else if (result == WaitResult::Timeout) {
+				return false ;
+			}
+		}
+
+		return true ;
+	}
+
 }
\ No newline at end of file
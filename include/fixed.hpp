@@ -0,0 +1,221 @@
+#pragma once
+
+#include "soa.hpp"
+
+namespace zz {
+
+	// bilangan fixed-point bertanda 32-bit: integer_bits bagian bulat (termasuk tanda), fraction_bits bagian pecahan.
+	// semua operasi murni integer, jadi hasil layout subpixel identik bit per bit di mesin mana pun.
+	// + dan - wrap seperti int32 tanpa UB, * dibulatkan ke bawah (floor), / dipotong ke arah nol
+	template <int integer_bits, int fraction_bits>
+	requires (integer_bits > 0 && fraction_bits > 0 && integer_bits + fraction_bits == 32)
+	class Fixed {
+	private :
+		int32_t raw_ = 0 ;
+
+		static constexpr int32_t wrap(int64_t value) noexcept { return static_cast<int32_t>(value) ; }
+
+		template <FloatingPoint type>
+		static constexpr int32_t from_floating(type value) noexcept {
+			const type scaled = value * static_cast<type>(one) ;
+			if (!(scaled == scaled)) {
+				return 0 ;
+			}
+			if (scaled >= static_cast<type>(std::numeric_limits<int32_t>::max())) {
+				return std::numeric_limits<int32_t>::max() ;
+			}
+			if (scaled <= static_cast<type>(std::numeric_limits<int32_t>::min())) {
+				return std::numeric_limits<int32_t>::min() ;
+			}
+			return static_cast<int32_t>(scaled + (scaled < 0 ? static_cast<type>(-0.5) : static_cast<type>(0.5))) ;
+		}
+
+	public :
+		static constexpr int fraction = fraction_bits ;
+		static constexpr int64_t one = int64_t{1} << fraction_bits ;
+
+		constexpr Fixed() noexcept = default ;
+
+		// integer dikonversi tanpa kehilangan presisi selama masih muat di integer_bits, jadi boleh implisit
+		template <Integral type>
+		constexpr Fixed(type value) noexcept : raw_(wrap(static_cast<int64_t>(static_cast<uint64_t>(value) << fraction_bits))) {}
+
+		// float dibulatkan ke nilai terdekat dan disaturasi, NaN menjadi 0
+		template <FloatingPoint type>
+		constexpr explicit Fixed(type value) noexcept : raw_(from_floating(value)) {}
+
+		static constexpr Fixed FromRaw(int32_t raw) noexcept {
+			Fixed f ;
+			f.raw_ = raw ;
+			return f ;
+		}
+
+		constexpr int32_t Raw() const noexcept { return raw_ ; }
+
+		// ke pixel integer
+		constexpr int32_t Floor() const noexcept { return raw_ >> fraction_bits ; }
+		constexpr int32_t Ceil() const noexcept { return wrap((static_cast<int64_t>(raw_) + one - 1) >> fraction_bits) ; }
+		constexpr int32_t Round() const noexcept { return wrap((static_cast<int64_t>(raw_) + one / 2) >> fraction_bits) ; }
+
+		constexpr float ToFloat() const noexcept { return static_cast<float>(raw_) * (1.0f / static_cast<float>(one)) ; }
+		constexpr double ToDouble() const noexcept { return static_cast<double>(raw_) * (1.0 / static_cast<double>(one)) ; }
+
+		template <Integral type>
+		constexpr explicit operator type() const noexcept { return static_cast<type>(Floor()) ; }
+
+		template <FloatingPoint type>
+		constexpr explicit operator type() const noexcept { return static_cast<type>(raw_) * (type{1} / static_cast<type>(one)) ; }
+
+		constexpr bool operator==(const Fixed&) const noexcept = default ;
+		constexpr auto operator<=>(const Fixed&) const noexcept = default ;
+
+		constexpr Fixed operator+() const noexcept { return *this ; }
+		constexpr Fixed operator-() const noexcept { return FromRaw(wrap(-static_cast<int64_t>(raw_))) ; }
+
+		friend constexpr Fixed operator+(Fixed a, Fixed b) noexcept {
+			return FromRaw(wrap(static_cast<int64_t>(a.raw_) + b.raw_)) ;
+		}
+
+		friend constexpr Fixed operator-(Fixed a, Fixed b) noexcept {
+			return FromRaw(wrap(static_cast<int64_t>(a.raw_) - b.raw_)) ;
+		}
+
+		friend constexpr Fixed operator*(Fixed a, Fixed b) noexcept {
+			return FromRaw(wrap((static_cast<int64_t>(a.raw_) * b.raw_) >> fraction_bits)) ;
+		}
+
+		// pembagi nol adalah UB seperti integer biasa, pakai Div/DivSaturate/DivZero untuk versi yang dicek
+		friend constexpr Fixed operator/(Fixed a, Fixed b) noexcept {
+			assert(b.raw_ != 0 && "Fixed - divide by zero") ;
+			return FromRaw(wrap((static_cast<int64_t>(a.raw_) << fraction_bits) / b.raw_)) ;
+		}
+
+		constexpr Fixed& operator+=(Fixed o) noexcept { return *this = *this + o ; }
+		constexpr Fixed& operator-=(Fixed o) noexcept { return *this = *this - o ; }
+		constexpr Fixed& operator*=(Fixed o) noexcept { return *this = *this * o ; }
+		constexpr Fixed& operator/=(Fixed o) noexcept { return *this = *this / o ; }
+	} ;
+
+	using Fixed16 = Fixed<16, 16> ;
+
+	template <int integer_bits, int fraction_bits>
+	struct is_arithmetic<Fixed<integer_bits, fraction_bits>> : std::true_type {} ;
+
+	// bertanda seperti float, ukuran negatif dianggap kosong oleh geometry.hpp
+	template <int integer_bits, int fraction_bits>
+	struct SizeType<Fixed<integer_bits, fraction_bits>> {
+		using type_ = Fixed<integer_bits, fraction_bits> ;
+	} ;
+}
+
+// Fixed + integer tetap Fixed (deterministik), Fixed + float menjadi float
+template <int integer_bits, int fraction_bits, zz::Integral other>
+struct std::common_type<zz::Fixed<integer_bits, fraction_bits>, other> {
+	using type = zz::Fixed<integer_bits, fraction_bits> ;
+} ;
+
+template <int integer_bits, int fraction_bits, zz::Integral other>
+struct std::common_type<other, zz::Fixed<integer_bits, fraction_bits>> {
+	using type = zz::Fixed<integer_bits, fraction_bits> ;
+} ;
+
+template <int integer_bits, int fraction_bits, zz::FloatingPoint other>
+struct std::common_type<zz::Fixed<integer_bits, fraction_bits>, other> {
+	using type = other ;
+} ;
+
+template <int integer_bits, int fraction_bits, zz::FloatingPoint other>
+struct std::common_type<other, zz::Fixed<integer_bits, fraction_bits>> {
+	using type = other ;
+} ;
+
+// dipakai DivSaturate untuk batas hasil pembagian nol
+template <int integer_bits, int fraction_bits>
+struct std::numeric_limits<zz::Fixed<integer_bits, fraction_bits>> {
+	using fixed = zz::Fixed<integer_bits, fraction_bits> ;
+
+	static constexpr bool is_specialized = true ;
+	static constexpr bool is_signed = true ;
+	static constexpr bool is_integer = false ;
+	static constexpr bool is_exact = true ;
+	static constexpr int digits = 31 ;
+
+	static constexpr fixed min() noexcept { return fixed::FromRaw(1) ; }
+	static constexpr fixed max() noexcept { return fixed::FromRaw(std::numeric_limits<int32_t>::max()) ; }
+	static constexpr fixed lowest() noexcept { return fixed::FromRaw(std::numeric_limits<int32_t>::min()) ; }
+	static constexpr fixed epsilon() noexcept { return fixed::FromRaw(1) ; }
+} ;
+
+namespace zz {
+
+	// Rect<Fixed16>/Point<Fixed16> juga array int32 datar, jadi memakai kernel integer yang sama dengan Rect<int>
+	static_assert(sizeof(Point<Fixed16>) == 2 * sizeof(int32_t) && sizeof(Rect<Fixed16>) == 4 * sizeof(int32_t)) ;
+
+	inline void Translate(std::span<Rect<Fixed16>> rects, const Point<Fixed16>& offset) noexcept {
+		Kernel::Add(utility::Flatten<int32_t>(rects), rects.size() * 4, {offset.x.Raw(), offset.y.Raw(), 0, 0}) ;
+	}
+
+	inline void Translate(std::span<Point<Fixed16>> points, const Point<Fixed16>& offset) noexcept {
+		Kernel::Add(utility::Flatten<int32_t>(points), points.size() * 2, {offset.x.Raw(), offset.y.Raw(), offset.x.Raw(), offset.y.Raw()}) ;
+	}
+
+	// hasilnya sama persis dengan operator * per komponen
+	inline void Scale(std::span<Rect<Fixed16>> rects, const Point<Fixed16>& factor) noexcept {
+		Kernel::MulFixed(utility::Flatten<int32_t>(rects), rects.size() * 4, {factor.x.Raw(), factor.y.Raw(), factor.x.Raw(), factor.y.Raw()}, Fixed16::fraction) ;
+	}
+
+	inline void Scale(std::span<Point<Fixed16>> points, const Point<Fixed16>& factor) noexcept {
+		Kernel::MulFixed(utility::Flatten<int32_t>(points), points.size() * 2, {factor.x.Raw(), factor.y.Raw(), factor.x.Raw(), factor.y.Raw()}, Fixed16::fraction) ;
+	}
+
+	inline void Translate(RectArray<Fixed16>& rects, const Point<Fixed16>& offset) noexcept {
+		Kernel::Add(utility::Flatten<int32_t>(rects.X()), rects.Size(), {offset.x.Raw(), offset.x.Raw(), offset.x.Raw(), offset.x.Raw()}) ;
+		Kernel::Add(utility::Flatten<int32_t>(rects.Y()), rects.Size(), {offset.y.Raw(), offset.y.Raw(), offset.y.Raw(), offset.y.Raw()}) ;
+	}
+
+	inline void Scale(RectArray<Fixed16>& rects, const Point<Fixed16>& factor) noexcept {
+		const Kernel::I32x4 fx {factor.x.Raw(), factor.x.Raw(), factor.x.Raw(), factor.x.Raw()} ;
+		const Kernel::I32x4 fy {factor.y.Raw(), factor.y.Raw(), factor.y.Raw(), factor.y.Raw()} ;
+		Kernel::MulFixed(utility::Flatten<int32_t>(rects.X()), rects.Size(), fx, Fixed16::fraction) ;
+		Kernel::MulFixed(utility::Flatten<int32_t>(rects.Y()), rects.Size(), fy, Fixed16::fraction) ;
+		Kernel::MulFixed(utility::Flatten<int32_t>(rects.W()), rects.Size(), fx, Fixed16::fraction) ;
+		Kernel::MulFixed(utility::Flatten<int32_t>(rects.H()), rects.Size(), fy, Fixed16::fraction) ;
+	}
+
+	// ke pixel: tiap komponen di-floor seperti Fixed::Floor, w/h Rect<int> diperlakukan sebagai int32.
+	// hasilnya jumlah elemen yang dikonversi (yang terkecil dari dua span)
+	inline size_t Convert(std::span<const Rect<Fixed16>> src, std::span<Rect<int>> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		Kernel::ShiftRight(utility::Flatten<int32_t>(src), utility::Flatten<int32_t>(dst), count * 4, Fixed16::fraction) ;
+		return count ;
+	}
+
+	inline size_t Convert(std::span<const Point<Fixed16>> src, std::span<Point<int>> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		Kernel::ShiftRight(utility::Flatten<int32_t>(src), utility::Flatten<int32_t>(dst), count * 2, Fixed16::fraction) ;
+		return count ;
+	}
+
+	// int32 -> float lalu dikali 2^-16, pangkat dua jadi perkaliannya eksak dan sama dengan Fixed::ToFloat
+	inline size_t Convert(std::span<const Rect<Fixed16>> src, std::span<Rect<float>> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		constexpr float scale = 1.0f / static_cast<float>(Fixed16::one) ;
+		Kernel::Convert(utility::Flatten<int32_t>(src), utility::Flatten<float>(dst), count * 4) ;
+		Kernel::Mul(utility::Flatten<float>(dst), count * 4, {scale, scale, scale, scale}) ;
+		return count ;
+	}
+
+	inline size_t Convert(std::span<const Point<Fixed16>> src, std::span<Point<float>> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		constexpr float scale = 1.0f / static_cast<float>(Fixed16::one) ;
+		Kernel::Convert(utility::Flatten<int32_t>(src), utility::Flatten<float>(dst), count * 2) ;
+		Kernel::Mul(utility::Flatten<float>(dst), count * 2, {scale, scale, scale, scale}) ;
+		return count ;
+	}
+
+	static_assert(Arithmetic<Fixed16> && std::is_same_v<MakeSizeType<Fixed16>, Fixed16>) ;
+	static_assert(std::is_same_v<std::common_type_t<Fixed16, int>, Fixed16> && std::is_same_v<std::common_type_t<float, Fixed16>, float>) ;
+	static_assert(Fixed16(3) / Fixed16(2) == Fixed16(1.5f) && (Fixed16(-1.5f) * Fixed16(2)).Floor() == -3) ;
+	static_assert(Fixed16(-0.25f).Floor() == -1 && Fixed16(-0.25f).Ceil() == 0 && Fixed16(2.5f).Round() == 3) ;
+	static_assert(Point<Fixed16>(1, 2) + Point<Fixed16>(Fixed16(0.5f)) == Point<Fixed16>(Fixed16(1.5f), Fixed16(2.5f))) ;
+}
\ No newline at end of file
@@ -0,0 +1,497 @@
+#pragma once
+
+#include "displaylist.hpp"
+
+namespace utility {
+	// satu codepoint dari UTF-8 mulai di text[i], i maju ke codepoint berikutnya. urutan byte rusak menjadi U+FFFD
+	inline uint32_t DecodeUtf8(std::string_view text, size_t& i) noexcept {
+		const uint8_t lead = static_cast<uint8_t>(text[i++]) ;
+		if (lead < 0x80) {
+			return lead ;
+		}
+
+		const size_t length = lead >= 0xF0 && lead < 0xF8 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC2 && lead < 0xE0 ? 2 : 0 ;
+		if (length == 0 || text.size() - (i - 1) < length) {
+			return 0xFFFD ;
+		}
+
+		uint32_t codepoint = lead & (0x7F >> length) ;
+		for (size_t k = 1 ; k < length ; ++k) {
+			const uint8_t next = static_cast<uint8_t>(text[i]) ;
+			if ((next & 0xC0) != 0x80) {
+				return 0xFFFD ;
+			}
+			codepoint = (codepoint << 6) | (next & 0x3F) ;
+			++i ;
+		}
+
+		constexpr uint32_t minimum[] = {0, 0, 0x80, 0x800, 0x10000} ;
+		if (codepoint < minimum[length] || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint < 0xE000)) {
+			return 0xFFFD ;
+		}
+		return codepoint ;
+	}
+}
+
+namespace zz {
+
+	// metrik satu glyph dalam piksel. left/top relatif ke pen di baseline, top negatif berarti di atas baseline
+	struct GlyphMetrics {
+		int16_t left = 0 ;
+		int16_t top = 0 ;
+		uint16_t width = 0 ;
+		uint16_t height = 0 ;
+		int16_t advance = 0 ;
+	} ;
+
+	struct FontMetrics {
+		int ascent = 0 ;
+		int descent = 0 ;
+		int line_height = 0 ;
+	} ;
+
+	// coverage A8 satu glyph, width * height byte tanpa padding
+	struct GlyphBitmap {
+		GlyphMetrics metrics {} ;
+		std::vector<uint8_t> coverage {} ;
+	} ;
+
+	// sumber glyph (rasterizer font). dipanggil hanya saat glyph belum ada di atlas
+	class GlyphSource {
+	public :
+		virtual ~GlyphSource() noexcept = default ;
+		virtual FontMetrics GetMetrics(uint16_t size) const noexcept = 0 ;
+
+		// out.coverage boleh dipakai ulang antar panggilan. false kalau codepoint tidak bisa digambar sama sekali
+		virtual bool Rasterize(uint32_t codepoint, uint16_t size, GlyphBitmap& out) const = 0 ;
+	} ;
+
+	// font bitmap 5x7 ASCII bawaan untuk test dan demo, tidak butuh file font maupun library sistem.
+	// sel 6x8 di-skala ke size piksel per baris dengan supersampling 4x4, codepoint lain digambar sebagai kotak
+	class BitmapFont : public GlyphSource {
+	private :
+		// per kolom kiri ke kanan, bit 0 = baris paling atas, untuk 0x20..0x7E
+		static constexpr uint8_t g_glyphs[95][5] {
+			{0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14},
+			{0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00},
+			{0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x14, 0x08, 0x3E, 0x08, 0x14}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+			{0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02},
+			{0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31},
+			{0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},
+			{0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00},
+			{0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06},
+			{0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+			{0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x49, 0x49, 0x7A},
+			{0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00}, {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41},
+			{0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x0C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+			{0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31},
+			{0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F}, {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F},
+			{0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},
+			{0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40},
+			{0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78}, {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20},
+			{0x38, 0x44, 0x44, 0x48, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E},
+			{0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x44, 0x3D, 0x00}, {0x7F, 0x10, 0x28, 0x44, 0x00},
+			{0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78}, {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38},
+			{0x7C, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7C}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},
+			{0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C},
+			{0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C}, {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00},
+			{0x00, 0x00, 0x7F, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00}, {0x08, 0x04, 0x08, 0x10, 0x08}
+		} ;
+		static constexpr uint8_t g_missing[5] {0x7F, 0x41, 0x41, 0x41, 0x7F} ;
+
+		static float scale_of(uint16_t size) noexcept { return static_cast<float>(std::max<uint16_t>(size, 1)) / 8.0f ; }
+
+	public :
+		FontMetrics GetMetrics(uint16_t size) const noexcept override {
+			const int line_height = std::max<int>(size, 1) ;
+			const int ascent = static_cast<int>(std::ceil(7.0f * scale_of(size))) ;
+			return FontMetrics{ascent, line_height - ascent, line_height} ;
+		}
+
+		bool Rasterize(uint32_t codepoint, uint16_t size, GlyphBitmap& out) const override {
+			const float scale = scale_of(size) ;
+			const uint8_t* columns = codepoint >= 0x20 && codepoint <= 0x7E ? g_glyphs[codepoint - 0x20] : g_missing ;
+			const int width = static_cast<int>(std::ceil(5.0f * scale)) ;
+			const int height = static_cast<int>(std::ceil(7.0f * scale)) ;
+
+			out.metrics = GlyphMetrics{
+				0,
+				static_cast<int16_t>(-height),
+				static_cast<uint16_t>(width),
+				static_cast<uint16_t>(height),
+				static_cast<int16_t>(std::max(1, static_cast<int>(std::lround(6.0f * scale))))
+			} ;
+			out.coverage.assign(static_cast<size_t>(width) * static_cast<size_t>(height), 0) ;
+
+			// spasi tetap punya bitmap (kosong) supaya advance-nya ikut tercatat di atlas, ukurannya kecil
+			constexpr int samples = 4 ;
+			for (int y = 0 ; y < height ; ++y) {
+				for (int x = 0 ; x < width ; ++x) {
+					int hits = 0 ;
+					for (int sy = 0 ; sy < samples ; ++sy) {
+						const int row = static_cast<int>((static_cast<float>(y) + (static_cast<float>(sy) + 0.5f) / samples) / scale) ;
+						for (int sx = 0 ; sx < samples ; ++sx) {
+							const int column = static_cast<int>((static_cast<float>(x) + (static_cast<float>(sx) + 0.5f) / samples) / scale) ;
+							hits += column < 5 && row < 7 && ((columns[column] >> row) & 1) ;
+						}
+					}
+					out.coverage[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)] = static_cast<uint8_t>((hits * 255 + samples * samples / 2) / (samples * samples)) ;
+				}
+			}
+			return true ;
+		}
+	} ;
+
+	// hit/miss cache glyph dan run, dihitung sejak konstruksi atau ResetStats
+	struct FontCacheStats {
+		uint64_t glyph_hits = 0 ;
+		uint64_t glyph_misses = 0 ;
+		uint64_t run_hits = 0 ;
+		uint64_t run_misses = 0 ;
+		uint64_t evictions = 0 ;	// shelf atlas yang dikosongkan
+
+		static double rate(uint64_t hits, uint64_t misses) noexcept {
+			return hits + misses ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0 ;
+		}
+
+		double GetGlyphHitRate() const noexcept { return rate(glyph_hits, glyph_misses) ; }
+		double GetRunHitRate() const noexcept { return rate(run_hits, run_misses) ; }
+
+		void Dump(std::ostream& os, std::string_view label = "font") const {
+			os << label << " - glyph hit: " << GetGlyphHitRate() * 100.0 << " % (" << glyph_hits << '/' << glyph_hits + glyph_misses << ")"
+			   << ", run hit: " << GetRunHitRate() * 100.0 << " % (" << run_hits << '/' << run_hits + run_misses << ")"
+			   << ", evictions: " << evictions << '\n' ;
+		}
+	} ;
+
+	// cache teks dua tingkat. glyph (font, codepoint) dirasterisasi sekali ke atlas A8 yang dipak per shelf,
+	// run (font, string) menyimpan posisi glyph dan letaknya di atlas, jadi label yang tidak berubah cukup satu lookup.
+	// font = sumber + ukuran, didaftarkan lewat AddFont. saat atlas penuh shelf yang paling lama tidak dipakai dikosongkan,
+	// shelf yang dipakai sejak BeginFrame terakhir tidak pernah dikosongkan karena Rasterizer baru membaca atlas saat Render
+	class FontCache : public TextRenderer {
+	private :
+		struct Font {
+			const GlyphSource* source = nullptr ;
+			uint16_t size = 0 ;
+			FontMetrics metrics {} ;
+		} ;
+
+		struct Glyph {
+			GlyphMetrics metrics {} ;
+			Point<int> at {} ;		// pojok kiri atas di atlas
+			uint32_t shelf = 0 ;
+		} ;
+
+		struct Shelf {
+			int y = 0 ;
+			int height = 0 ;
+			int x = 0 ;				// kolom kosong pertama
+			uint64_t last_used = 0 ;
+			std::vector<uint64_t> glyphs {} ;
+		} ;
+
+		struct RunGlyph {
+			Glyph glyph {} ;
+			int x = 0 ;				// pen relatif ke awal run
+		} ;
+
+		struct Run {
+			std::string text {} ;
+			uint32_t font = 0 ;
+			uint64_t epoch = 0 ;	// epoch_ saat posisi atlas terakhir diperiksa
+			uint64_t last_used = 0 ;
+			int advance = 0 ;
+			std::vector<RunGlyph> glyphs {} ;
+		} ;
+
+		int atlas_width_ = 0 ;
+		int atlas_height_ = 0 ;
+		std::vector<uint8_t> atlas_ {} ;
+		std::vector<Font> fonts_ {} ;
+		std::vector<Shelf> shelves_ {} ;
+		std::vector<uint32_t> order_ {} ;		// index shelf urut y, sementara untuk reclaim
+		int shelf_bottom_ = 0 ;
+		std::unordered_map<uint64_t, Glyph> glyphs_ {} ;
+		std::unordered_map<uint64_t, Run> runs_ {} ;
+		size_t run_capacity_ = 0 ;
+		uint64_t frame_ = 1 ;
+		uint64_t epoch_ = 0 ;		// naik setiap ada shelf yang dikosongkan
+		GlyphBitmap scratch_ {} ;
+		FontCacheStats stats_ {} ;
+
+		static uint64_t glyph_key(uint32_t font, uint32_t codepoint) noexcept {
+			return (static_cast<uint64_t>(font) << 32) | codepoint ;
+		}
+
+		static uint64_t run_key(uint32_t font, std::string_view text) noexcept {
+			const uint64_t hash = utility::Fnv1a(reinterpret_cast<const uint8_t*>(&font), sizeof(font)) ;
+			return utility::Fnv1a(reinterpret_cast<const uint8_t*>(text.data()), text.size(), hash) ;
+		}
+
+		void evict(Shelf& shelf) {
+			for (uint64_t key : shelf.glyphs) {
+				glyphs_.erase(key) ;
+			}
+			shelf.glyphs.clear() ;
+			shelf.x = 0 ;
+			++stats_.evictions ;
+		}
+
+		// slot shelf mati (tinggi 0) dipakai ulang supaya index shelf di Glyph tetap stabil
+		uint32_t add_shelf(int y, int height) {
+			const Shelf shelf {.y = y, .height = height} ;
+			for (uint32_t i = 0 ; i < shelves_.size() ; ++i) {
+				if (shelves_[i].height == 0) {
+					shelves_[i] = shelf ;
+					return i ;
+				}
+			}
+			shelves_.push_back(shelf) ;
+			return static_cast<uint32_t>(shelves_.size() - 1) ;
+		}
+
+		// shelf yang bersebelahan (urut y), tidak dipakai frame ini dan paling lama tidak dipakai dikosongkan lalu digabung.
+		// glyph mendapat shelf setinggi dirinya, sisanya menjadi shelf kosong baru, jadi shelf tinggi bisa dipakai glyph
+		// pendek dan sebaliknya. rentang yang sampai shelf paling bawah boleh memakai sisa atlas di bawahnya
+		std::optional<uint32_t> reclaim(int height) {
+			order_.clear() ;
+			for (uint32_t i = 0 ; i < shelves_.size() ; ++i) {
+				if (shelves_[i].height > 0) {
+					order_.push_back(i) ;
+				}
+			}
+			std::sort(order_.begin(), order_.end(), [this](uint32_t a, uint32_t b) { return shelves_[a].y < shelves_[b].y ; }) ;
+
+			std::optional<std::pair<size_t, size_t>> best {} ;
+			uint64_t best_age = 0 ;
+			int best_height = 0 ;
+			for (size_t first = 0 ; first < order_.size() ; ++first) {
+				int total = 0 ;
+				uint64_t age = 0 ;
+				for (size_t last = first ; last < order_.size() && shelves_[order_[last]].last_used < frame_ ; ++last) {
+					total += shelves_[order_[last]].height ;
+					age = std::max(age, shelves_[order_[last]].last_used) ;
+					const int available = last + 1 == order_.size() ? total + atlas_height_ - shelf_bottom_ : total ;
+					if (available >= height) {
+						if (!best || age < best_age || (age == best_age && total < best_height)) {
+							best = std::pair{first, last} ;
+							best_age = age ;
+							best_height = total ;
+						}
+						break ;
+					}
+				}
+			}
+			if (!best) {
+				return std::nullopt ;
+			}
+
+			const auto [first, last] = *best ;
+			const int y = shelves_[order_[first]].y ;
+			for (size_t i = first ; i <= last ; ++i) {
+				evict(shelves_[order_[i]]) ;
+				shelves_[order_[i]].height = 0 ;
+			}
+			++epoch_ ;
+
+			const uint32_t index = add_shelf(y, height) ;
+			if (best_height > height) {
+				add_shelf(y + height, best_height - height) ;
+			} else {
+				shelf_bottom_ = std::max(shelf_bottom_, y + height) ;
+			}
+			return index ;
+		}
+
+		// shelf dengan tinggi paling pas yang masih muat, lalu shelf baru di bawah, lalu reclaim
+		std::optional<uint32_t> allocate(int width, int height) {
+			if (width > atlas_width_ || height > atlas_height_) {
+				return std::nullopt ;
+			}
+
+			std::optional<uint32_t> best {} ;
+			for (uint32_t i = 0 ; i < shelves_.size() ; ++i) {
+				const Shelf& shelf = shelves_[i] ;
+				if (shelf.height >= height && shelf.height <= height + height / 2 + 1 && shelf.x + width <= atlas_width_ && (!best || shelf.height < shelves_[*best].height)) {
+					best = i ;
+				}
+			}
+			if (best) {
+				return best ;
+			}
+
+			if (shelf_bottom_ + height <= atlas_height_) {
+				shelf_bottom_ += height ;
+				return add_shelf(shelf_bottom_ - height, height) ;
+			}
+			return reclaim(height) ;
+		}
+
+		// glyph dari atlas, dirasterisasi dulu kalau belum ada. nullptr kalau tidak bisa digambar atau atlas penuh
+		const Glyph* find_glyph(uint32_t font, uint32_t codepoint) {
+			const uint64_t key = glyph_key(font, codepoint) ;
+			if (const auto it = glyphs_.find(key) ; it != glyphs_.end()) {
+				++stats_.glyph_hits ;
+				shelves_[it->second.shelf].last_used = frame_ ;
+				return &it->second ;
+			}
+
+			++stats_.glyph_misses ;
+			const Font& f = fonts_[font] ;
+			if (!f.source->Rasterize(codepoint, f.size, scratch_)) {
+				return nullptr ;
+			}
+
+			const GlyphMetrics& metrics = scratch_.metrics ;
+			const std::optional<uint32_t> index = allocate(std::max<int>(metrics.width, 1), std::max<int>(metrics.height, 1)) ;
+			if (!index) {
+				return nullptr ;
+			}
+
+			Shelf& shelf = shelves_[*index] ;
+			const Glyph glyph {metrics, Point<int>{shelf.x, shelf.y}, *index} ;
+			for (int y = 0 ; y < metrics.height ; ++y) {
+				std::memcpy(
+					atlas_.data() + static_cast<size_t>(shelf.y + y) * static_cast<size_t>(atlas_width_) + static_cast<size_t>(shelf.x),
+					scratch_.coverage.data() + static_cast<size_t>(y) * metrics.width,
+					metrics.width
+				) ;
+			}
+			shelf.x += std::max<int>(metrics.width, 1) ;
+			shelf.last_used = frame_ ;
+			shelf.glyphs.push_back(key) ;
+			return &glyphs_.emplace(key, glyph).first->second ;
+		}
+
+		// buang paling tidak setengah run, yang paling lama tidak dipakai dulu
+		void trim_runs() {
+			std::vector<uint64_t> ages {} ;
+			ages.reserve(runs_.size()) ;
+			for (const auto& [key, run] : runs_) {
+				ages.push_back(run.last_used) ;
+			}
+			std::nth_element(ages.begin(), ages.begin() + ages.size() / 2, ages.end()) ;
+			const uint64_t cutoff = ages[ages.size() / 2] ;
+			std::erase_if(runs_, [cutoff](const auto& item) { return item.second.last_used <= cutoff ; }) ;
+		}
+
+		void layout(Run& run) {
+			run.glyphs.clear() ;
+			run.advance = 0 ;
+			for (size_t i = 0 ; i < run.text.size() ; ) {
+				const uint32_t codepoint = utility::DecodeUtf8(run.text, i) ;
+				if (const Glyph* glyph = find_glyph(run.font, codepoint)) {
+					run.glyphs.push_back(RunGlyph{*glyph, run.advance}) ;
+					run.advance += glyph->metrics.advance ;
+				}
+			}
+			run.epoch = epoch_ ;
+		}
+
+		// posisi atlas di run tetap valid selama tidak ada shelf yang dikosongkan (epoch sama)
+		const Run* find_run(uint32_t font, std::string_view text) {
+			if (font >= fonts_.size()) {
+				return nullptr ;
+			}
+
+			const uint64_t key = run_key(font, text) ;
+			auto it = runs_.find(key) ;
+			if (it != runs_.end() && (it->second.font != font || it->second.text != text)) {
+				// tabrakan hash, run lama diganti
+				runs_.erase(it) ;
+				it = runs_.end() ;
+			}
+
+			if (it == runs_.end()) {
+				++stats_.run_misses ;
+				if (runs_.size() >= run_capacity_) {
+					trim_runs() ;
+				}
+				it = runs_.emplace(key, Run{.text = std::string(text), .font = font}).first ;
+				layout(it->second) ;
+			} else {
+				++stats_.run_hits ;
+				if (it->second.epoch != epoch_) {
+					layout(it->second) ;
+				} else {
+					for (const RunGlyph& g : it->second.glyphs) {
+						shelves_[g.glyph.shelf].last_used = frame_ ;
+					}
+				}
+			}
+
+			it->second.last_used = frame_ ;
+			return &it->second ;
+		}
+
+	public :
+		explicit FontCache(int atlas_width = 512, int atlas_height = 512, size_t run_capacity = 4096)
+			: atlas_width_(std::max(atlas_width, 1)), atlas_height_(std::max(atlas_height, 1)), run_capacity_(std::max<size_t>(run_capacity, 2)) {
+			atlas_.assign(static_cast<size_t>(atlas_width_) * static_cast<size_t>(atlas_height_), 0) ;
+		}
+
+		FontCache(const FontCache&) = delete ;
+		FontCache& operator=(const FontCache&) = delete ;
+
+		// source harus hidup selama cache dipakai. hasilnya id font untuk DisplayList::DrawText
+		uint32_t AddFont(const GlyphSource& source, uint16_t size) {
+			fonts_.push_back(Font{&source, size, source.GetMetrics(size)}) ;
+			return static_cast<uint32_t>(fonts_.size() - 1) ;
+		}
+
+		const FontMetrics& GetMetrics(uint32_t font) const { return fonts_.at(font).metrics ; }
+
+		// panggil sekali per frame sebelum Replay. glyph yang dipakai sebelum Render frame ini tidak boleh dikosongkan
+		void BeginFrame() noexcept { ++frame_ ; }
+
+		// lebar run dan tinggi baris, memakai (dan mengisi) cache yang sama dengan DrawText
+		Size<int> Measure(uint32_t font, std::string_view text) {
+			const Run* run = find_run(font, text) ;
+			return run ? Size<int>(run->advance, fonts_[font].metrics.line_height) : Size<int>{} ;
+		}
+
+		Size<int> MeasureText(std::string_view text, uint32_t font) override {
+			return Measure(font, text) ;
+		}
+
+		// satu baris mulai dari pojok kiri atas bound, dipotong ke bound supaya diff display list tetap benar
+		void DrawText(Rasterizer& raster, const Rect<int>& bound, std::string_view text, Color color, uint32_t font) override {
+			const Run* run = find_run(font, text) ;
+			if (!run || run->glyphs.empty()) {
+				return ;
+			}
+
+			const int baseline = bound.GetPoint().y + fonts_[font].metrics.ascent ;
+			raster.PushClip(bound) ;
+			for (const RunGlyph& g : run->glyphs) {
+				const GlyphMetrics& metrics = g.glyph.metrics ;
+				raster.FillMask(
+					atlas_.data() + static_cast<size_t>(g.glyph.at.y) * static_cast<size_t>(atlas_width_) + static_cast<size_t>(g.glyph.at.x),
+					static_cast<size_t>(atlas_width_),
+					Rect<int>(bound.GetPoint().x + g.x + metrics.left, baseline + metrics.top, metrics.width, metrics.height),
+					color
+				) ;
+			}
+			raster.PopClip() ;
+		}
+
+		// buang semua glyph dan run, font yang terdaftar tetap
+		void Clear() noexcept {
+			glyphs_.clear() ;
+			runs_.clear() ;
+			shelves_.clear() ;
+			shelf_bottom_ = 0 ;
+			++epoch_ ;
+		}
+
+		size_t GetGlyphCount() const noexcept { return glyphs_.size() ; }
+		size_t GetRunCount() const noexcept { return runs_.size() ; }
+
+		// atlas A8 width * height byte tanpa padding, untuk debug
+		std::span<const uint8_t> GetAtlas() const noexcept { return atlas_ ; }
+		Size<int> GetAtlasSize() const noexcept { return Size<int>(atlas_width_, atlas_height_) ; }
+
+		const FontCacheStats& GetStats() const noexcept { return stats_ ; }
+		void ResetStats() noexcept { stats_ = FontCacheStats{} ; }
+	} ;
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "soa.hpp"
+
+namespace zz {
+
+	// tepi kanan/bawah dihitung dengan tipe yang lebih lebar supaya x + w tidak overflow pada Rect<int>
+	template <Arithmetic type>
+	using EdgeType = std::conditional_t<Integral<type>, int64_t, type> ;
+
+	template <Arithmetic type>
+	constexpr EdgeType<type> Right(const Rect<type>& r) noexcept {
+		return static_cast<EdgeType<type>>(r.GetPoint().x) + static_cast<EdgeType<type>>(r.GetSize().w) ;
+	}
+
+	template <Arithmetic type>
+	constexpr EdgeType<type> Bottom(const Rect<type>& r) noexcept {
+		return static_cast<EdgeType<type>>(r.GetPoint().y) + static_cast<EdgeType<type>>(r.GetSize().h) ;
+	}
+
+	// NaN dan ukuran negatif (float) dianggap kosong
+	template <Arithmetic type>
+	constexpr bool IsEmpty(const Rect<type>& r) noexcept {
+		return !((r.GetSize().w > 0) & (r.GetSize().h > 0)) ;
+	}
+
+	// setengah terbuka: tepi kiri/atas termasuk, kanan/bawah tidak.
+	// integer cukup satu perbandingan unsigned per sumbu, (p - x) yang negatif jadi sangat besar. selisihnya dihitung
+	// 64-bit: di 32-bit rect yang melewati INT_MAX akan berputar dan ikut berisi titik di sisi negatif
+	template <Arithmetic type>
+	constexpr bool Contains(const Rect<type>& r, const Point<type>& p) noexcept {
+		if constexpr (Integral<type>) {
+			using edge_type = EdgeType<type> ;
+			const uint64_t dx = static_cast<uint64_t>(static_cast<edge_type>(p.x) - static_cast<edge_type>(r.GetPoint().x)) ;
+			const uint64_t dy = static_cast<uint64_t>(static_cast<edge_type>(p.y) - static_cast<edge_type>(r.GetPoint().y)) ;
+			return (dx < r.GetSize().w) & (dy < r.GetSize().h) ;
+		} else {
+			return (p.x >= r.GetPoint().x) & (p.x < Right(r)) & (p.y >= r.GetPoint().y) & (p.y < Bottom(r)) ;
+		}
+	}
+
+	// rect kosong tidak pernah berisi dan tidak pernah terisi
+	template <Arithmetic type>
+	constexpr bool Contains(const Rect<type>& outer, const Rect<type>& inner) noexcept {
+		return !IsEmpty(outer) & !IsEmpty(inner)
+			& (inner.GetPoint().x >= outer.GetPoint().x) & (inner.GetPoint().y >= outer.GetPoint().y)
+			& (Right(inner) <= Right(outer)) & (Bottom(inner) <= Bottom(outer)) ;
+	}
+
+	// sengaja && biasa: di bench/geometry.cpp versi & tanpa short-circuit lebih lambat, kebanyakan pasangan sudah
+	// gagal di perbandingan pertama
+	template <Arithmetic type>
+	constexpr bool Intersects(const Rect<type>& a, const Rect<type>& b) noexcept {
+		return !IsEmpty(a) && !IsEmpty(b)
+			&& a.GetPoint().x < Right(b) && b.GetPoint().x < Right(a)
+			&& a.GetPoint().y < Bottom(b) && b.GetPoint().y < Bottom(a) ;
+	}
+
+	// tanpa irisan hasilnya rect berukuran 0 di pojok kiri atas irisan
+	template <Arithmetic type>
+	constexpr Rect<type> Intersect(const Rect<type>& a, const Rect<type>& b) noexcept {
+		using edge_type = EdgeType<type> ;
+		using size_type = MakeSizeType<type> ;
+
+		const edge_type x0 = std::max<edge_type>(a.GetPoint().x, b.GetPoint().x) ;
+		const edge_type y0 = std::max<edge_type>(a.GetPoint().y, b.GetPoint().y) ;
+		const edge_type x1 = std::min(Right(a), Right(b)) ;
+		const edge_type y1 = std::min(Bottom(a), Bottom(b)) ;
+		// sama dengan x1 > x0 & y1 > y0 untuk nilai biasa, tapi posisi NaN juga menghasilkan kosong
+		const bool empty = !Intersects(a, b) ;
+
+		return Rect<type>(
+			static_cast<type>(x0),
+			static_cast<type>(y0),
+			empty ? size_type{} : static_cast<size_type>(x1 - x0),
+			empty ? size_type{} : static_cast<size_type>(y1 - y0)
+		) ;
+	}
+
+	// bounding box, rect kosong diabaikan
+	template <Arithmetic type>
+	constexpr Rect<type> Union(const Rect<type>& a, const Rect<type>& b) noexcept {
+		using edge_type = EdgeType<type> ;
+		using size_type = MakeSizeType<type> ;
+
+		if (IsEmpty(a) | IsEmpty(b)) {
+			return IsEmpty(a) ? b : a ;
+		}
+
+		const edge_type x0 = std::min<edge_type>(a.GetPoint().x, b.GetPoint().x) ;
+		const edge_type y0 = std::min<edge_type>(a.GetPoint().y, b.GetPoint().y) ;
+		edge_type x1 = std::max(Right(a), Right(b)) ;
+		edge_type y1 = std::max(Bottom(a), Bottom(b)) ;
+
+		// dua Rect<int> di ujung range bisa berjarak lebih dari batas size_type, ukurannya disaturasi
+		if constexpr (Integral<type>) {
+			constexpr edge_type limit = static_cast<edge_type>(std::numeric_limits<size_type>::max()) ;
+			x1 = std::min(x1, x0 + limit) ;
+			y1 = std::min(y1, y0 + limit) ;
+		}
+
+		return Rect<type>(static_cast<type>(x0), static_cast<type>(y0), static_cast<size_type>(x1 - x0), static_cast<size_type>(y1 - y0)) ;
+	}
+
+	template <Arithmetic type>
+	constexpr Rect<type> ClipTo(const Rect<type>& r, const Rect<type>& clip) noexcept {
+		return Intersect(r, clip) ;
+	}
+}
+
+namespace utility {
+	template <zz::Arithmetic type>
+	size_t HitTest(std::span<const zz::Rect<type>> rects, const zz::Point<type>& p) noexcept {
+		size_t hit = rects.size() ;
+		for (size_t i = 0 ; i < rects.size() ; ++i) {
+			hit = zz::Contains(rects[i], p) ? i : hit ;
+		}
+		return hit ;
+	}
+
+	template <zz::Arithmetic type>
+	size_t HitTestAll(std::span<const zz::Rect<type>> rects, const zz::Point<type>& p, std::vector<uint32_t>& hits) {
+		hits.resize(rects.size()) ;
+		size_t count = 0 ;
+		for (size_t i = 0 ; i < rects.size() ; ++i) {
+			hits[count] = static_cast<uint32_t>(i) ;
+			count += zz::Contains(rects[i], p) ;
+		}
+		hits.resize(count) ;
+		return count ;
+	}
+
+	template <zz::Arithmetic type>
+	size_t HitTest(const zz::RectArray<type>& rects, const zz::Point<type>& p) noexcept {
+		const auto xs = rects.X() ;
+		const auto ys = rects.Y() ;
+		const auto ws = rects.W() ;
+		const auto hs = rects.H() ;
+
+		size_t hit = rects.Size() ;
+		for (size_t i = 0 ; i < rects.Size() ; ++i) {
+			hit = zz::Contains(zz::Rect<type>(xs[i], ys[i], ws[i], hs[i]), p) ? i : hit ;
+		}
+		return hit ;
+	}
+
+	template <zz::Arithmetic type>
+	void ClipTo(std::span<zz::Rect<type>> rects, const zz::Rect<type>& clip) noexcept {
+		for (zz::Rect<type>& r : rects) {
+			r = zz::Intersect(r, clip) ;
+		}
+	}
+}
+
+namespace zz {
+
+	// index rect paling atas (terakhir) yang berisi p, rects.size() kalau tidak ada
+	inline size_t HitTest(std::span<const Rect<int>> rects, const Point<int>& p) noexcept { return utility::HitTest(rects, p) ; }
+	inline size_t HitTest(std::span<const Rect<float>> rects, const Point<float>& p) noexcept { return utility::HitTest(rects, p) ; }
+	inline size_t HitTest(const RectArray<int>& rects, const Point<int>& p) noexcept { return utility::HitTest(rects, p) ; }
+	inline size_t HitTest(const RectArray<float>& rects, const Point<float>& p) noexcept { return utility::HitTest(rects, p) ; }
+
+	// semua index yang berisi p, urut dari bawah ke atas
+	inline size_t HitTestAll(std::span<const Rect<int>> rects, const Point<int>& p, std::vector<uint32_t>& hits) { return utility::HitTestAll(rects, p, hits) ; }
+	inline size_t HitTestAll(std::span<const Rect<float>> rects, const Point<float>& p, std::vector<uint32_t>& hits) { return utility::HitTestAll(rects, p, hits) ; }
+
+	inline void ClipTo(std::span<Rect<int>> rects, const Rect<int>& clip) noexcept { utility::ClipTo(rects, clip) ; }
+	inline void ClipTo(std::span<Rect<float>> rects, const Rect<float>& clip) noexcept { utility::ClipTo(rects, clip) ; }
+
+	static_assert(IsEmpty(Rect<int>(0, 0, 0, 5)) && !IsEmpty(Rect<int>(-3, -3, 1, 1))) ;
+	static_assert(Contains(Rect<int>(-10, -10, 20, 20), Point<int>{-10, 9}) && !Contains(Rect<int>(-10, -10, 20, 20), Point<int>{10, 0})) ;
+	static_assert(Contains(Rect<float>(0.0f, 0.0f, 1.0f, 1.0f), Point<float>{0.5f, 0.0f}) && !Contains(Rect<float>(0.0f, 0.0f, 1.0f, 1.0f), Point<float>{1.0f, 0.5f})) ;
+	static_assert(Intersect(Rect<int>(0, 0, 10, 10), Rect<int>(5, -5, 10, 10)) == Rect<int>(5, 0, 5, 5)) ;
+	static_assert(IsEmpty(Intersect(Rect<int>(0, 0, 10, 10), Rect<int>(10, 0, 10, 10)))) ;
+	static_assert(Union(Rect<int>(0, 0, 10, 10), Rect<int>(20, -5, 5, 5)) == Rect<int>(0, -5, 25, 15)) ;
+	static_assert(Union(Rect<int>(), Rect<int>(3, 4, 5, 6)) == Rect<int>(3, 4, 5, 6)) ;
+	static_assert(Contains(Rect<int>(0, 0, 10, 10), Rect<int>(2, 2, 8, 8)) && !Contains(Rect<int>(0, 0, 10, 10), Rect<int>(2, 2, 9, 8))) ;
+	static_assert(!Intersects(Rect<int>(0, 0, 10, 10), Rect<int>(5, 5, 0, 3))) ;
+}
\ No newline at end of file
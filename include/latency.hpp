@@ -0,0 +1,161 @@
+#pragma once
+
+#include "event.hpp"
+
+namespace zz {
+
+	// histogram log-linear ala HDR: 32 sub-bucket per pangkat dua, error relatif maksimal ~3%
+	class Histogram {
+	private :
+		static constexpr uint32_t sub_bits_ = 5 ;
+		static constexpr uint32_t sub_count_ = 1 << sub_bits_ ;
+		static constexpr uint32_t bucket_count_ = (64 - sub_bits_ + 1) * sub_count_ ;
+
+		uint64_t buckets_[bucket_count_] {} ;
+		uint64_t count_ = 0 ;
+		uint64_t sum_ = 0 ;
+		uint64_t min_ = std::numeric_limits<uint64_t>::max() ;
+		uint64_t max_ = 0 ;
+
+		static constexpr uint32_t index_of(uint64_t value) noexcept {
+			if (value < 2 * sub_count_) {
+				return static_cast<uint32_t>(value) ;
+			}
+
+			const uint32_t shift = static_cast<uint32_t>(std::bit_width(value)) - (sub_bits_ + 1) ;
+			return (shift + 1) * sub_count_ + static_cast<uint32_t>((value >> shift) - sub_count_) ;
+		}
+
+		static constexpr uint64_t value_of(uint32_t index) noexcept {
+			if (index < 2 * sub_count_) {
+				return index ;
+			}
+
+			const uint32_t shift = index / sub_count_ - 1 ;
+			return static_cast<uint64_t>(sub_count_ + index % sub_count_) << shift ;
+		}
+
+	public :
+		void Record(uint64_t value) noexcept {
+			++buckets_[index_of(value)] ;
+			++count_ ;
+			sum_ += value ;
+			min_ = std::min(min_, value) ;
+			max_ = std::max(max_, value) ;
+		}
+
+		// batas bawah bucket tempat persentil p (0..100) jatuh
+		uint64_t Percentile(double p) const noexcept {
+			if (count_ == 0) {
+				return 0 ;
+			}
+
+			const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(p / 100.0 * static_cast<double>(count_) + 0.5)) ;
+			uint64_t seen = 0 ;
+			for (uint32_t i = 0 ; i < bucket_count_ ; ++i) {
+				seen += buckets_[i] ;
+				if (seen >= target) {
+					return std::clamp(value_of(i), min_, max_) ;
+				}
+			}
+
+			return max_ ;
+		}
+
+		void Reset() noexcept {
+			*this = Histogram{} ;
+		}
+
+		uint64_t Count() const noexcept { return count_ ; }
+		uint64_t Min() const noexcept { return count_ ? min_ : 0 ; }
+		uint64_t Max() const noexcept { return max_ ; }
+		double Mean() const noexcept { return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0 ; }
+
+		// dalam mikrodetik, nilai yang direkam diasumsikan nanodetik
+		void Dump(std::ostream& os, std::string_view label) const {
+			os << label << " - count: " << count_
+			   << ", min: " << Min() / 1000.0
+			   << ", p50: " << Percentile(50) / 1000.0
+			   << ", p90: " << Percentile(90) / 1000.0
+			   << ", p99: " << Percentile(99) / 1000.0
+			   << ", max: " << Max() / 1000.0 << " us\n" ;
+		}
+	} ;
+
+	// instrumentasi input-lag, default mati. semua dipanggil dari thread UI
+	class Latency {
+	private :
+		static inline bool g_enabled_ = false ;
+		static inline Histogram g_dwell_ {} ;
+		static inline Histogram g_dispatch_ {} ;
+		static inline Histogram g_present_ {} ;
+		static inline uint64_t g_oldest_input_ = 0 ;
+
+	public :
+		static void Enable(bool enabled = true) noexcept { g_enabled_ = enabled ; }
+		static bool IsEnabled() noexcept { return g_enabled_ ; }
+
+		// dipanggil EventSys saat event keluar dari queue
+		static void RecordPoll(const Event& event) noexcept {
+			if (!g_enabled_ || event.GetTime() == 0) {
+				return ;
+			}
+
+			const uint64_t now = Now() ;
+			g_dwell_.Record(now - std::min(now, event.GetTime())) ;
+			if (g_oldest_input_ == 0 || event.GetTime() < g_oldest_input_) {
+				g_oldest_input_ = event.GetTime() ;
+			}
+		}
+
+		static void RecordDispatch(uint64_t begin) noexcept {
+			if (g_enabled_) {
+				g_dispatch_.Record(Now() - begin) ;
+			}
+		}
+
+		// panggil setelah frame tampil, mencatat umur input paling lama yang sudah di-poll sejak present sebelumnya
+		static void MarkPresent() noexcept {
+			if (!g_enabled_ || g_oldest_input_ == 0) {
+				return ;
+			}
+
+			g_present_.Record(Now() - g_oldest_input_) ;
+			g_oldest_input_ = 0 ;
+		}
+
+		static const Histogram& GetDwell() noexcept { return g_dwell_ ; }
+		static const Histogram& GetDispatch() noexcept { return g_dispatch_ ; }
+		static const Histogram& GetPresent() noexcept { return g_present_ ; }
+
+		static void Reset() noexcept {
+			g_dwell_.Reset() ;
+			g_dispatch_.Reset() ;
+			g_present_.Reset() ;
+			g_oldest_input_ = 0 ;
+		}
+
+		static void Dump(std::ostream& os = std::cout) {
+			g_dwell_.Dump(os, "queue dwell") ;
+			g_dispatch_.Dump(os, "dispatch") ;
+			g_present_.Dump(os, "input to present") ;
+		}
+	} ;
+
+	// mengukur waktu handler untuk satu event
+	class DispatchTimer {
+	private :
+		uint64_t begin_ = Latency::IsEnabled() ? Now() : 0 ;
+
+	public :
+		DispatchTimer() noexcept = default ;
+		DispatchTimer(const DispatchTimer&) = delete ;
+		DispatchTimer& operator=(const DispatchTimer&) = delete ;
+
+		~DispatchTimer() noexcept {
+			if (begin_) {
+				Latency::RecordDispatch(begin_) ;
+			}
+		}
+	} ;
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "enum.hpp"
+
+namespace zz {
+
+	// queue bounded multi-producer single-consumer tanpa lock (sequence per cell, model Vyukov).
+	// TryPush boleh dari thread manapun, TryPop/Drain hanya dari satu thread konsumen
+	template <typename type, size_t capacity = 1024>
+	requires (std::is_trivially_copyable_v<type> && std::has_single_bit(capacity))
+	class MpscQueue {
+	private :
+		struct Cell {
+			std::atomic<size_t> sequence {} ;
+			type value {} ;
+		} ;
+
+		static constexpr size_t mask_ = capacity - 1 ;
+
+		Cell cells_[capacity] ;
+		alignas(64) std::atomic<size_t> tail_ {0} ;
+		alignas(64) size_t head_ = 0 ;
+
+	public :
+		MpscQueue() noexcept {
+			for (size_t i = 0 ; i < capacity ; ++i) {
+				cells_[i].sequence.store(i, std::memory_order_relaxed) ;
+			}
+		}
+
+		MpscQueue(const MpscQueue&) = delete ;
+		MpscQueue& operator=(const MpscQueue&) = delete ;
+
+		// false kalau penuh
+		bool TryPush(const type& value) noexcept {
+			size_t pos = tail_.load(std::memory_order_relaxed) ;
+			Cell* cell ;
+
+			while (true) {
+				cell = &cells_[pos & mask_] ;
+				const size_t seq = cell->sequence.load(std::memory_order_acquire) ;
+				const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) ;
+
+				if (diff == 0) {
+					if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						break ;
+					}
+				} else if (diff < 0) {
+					return false ;
+				} else {
+					pos = tail_.load(std::memory_order_relaxed) ;
+				}
+			}
+
+			cell->value = value ;
+			cell->sequence.store(pos + 1, std::memory_order_release) ;
+			return true ;
+		}
+
+		bool TryPop(type& value) noexcept {
+			Cell& cell = cells_[head_ & mask_] ;
+			const size_t seq = cell.sequence.load(std::memory_order_acquire) ;
+			if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(head_ + 1) < 0) {
+				return false ;
+			}
+
+			value = cell.value ;
+			cell.sequence.store(head_ + capacity, std::memory_order_release) ;
+			++head_ ;
+			return true ;
+		}
+
+		// ambil sampai max_count item sekaligus, return jumlah yang diambil
+		template <typename fn>
+		size_t Drain(fn&& consume, size_t max_count = capacity) noexcept {
+			size_t count = 0 ;
+			type value ;
+			while (count < max_count && TryPop(value)) {
+				consume(value) ;
+				++count ;
+			}
+			return count ;
+		}
+
+		static constexpr size_t Capacity() noexcept { return capacity ; }
+	} ;
+}
\ No newline at end of file
@@ -1,77 +1,142 @@
-#pragma once
-
-#include "enum.hpp"
-
-namespace zz {
-	struct XNOR {
-		template <bool State1, bool State2> 
-		constexpr bool operator()() const noexcept {
-			return (State1 == State2) ? true : false ;
-		}
-	} ;
-
-	struct Add {
-		template <typename Type1, typename Type2> requires (Convertible<Type1, Type2> && Convertible<Type2, Type1>)
-		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
-			using type = std::common_type_t<Type1, Type2> ;
-			return static_cast<type>(a) + static_cast<type>(b) ;
-		}
-	} ;
-
-	struct Sub {
-		template <typename Type1, typename Type2> requires (Convertible<Type1, Type2> && Convertible<Type2, Type1>)
-		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
-			using type = std::common_type_t<Type1, Type2> ;
-			return static_cast<type>(a) - static_cast<type>(b) ;
-		}
-	} ;
-
-	struct Mul {
-		template <typename Type1, typename Type2> requires (Convertible<Type1, Type2> && Convertible<Type2, Type1>)
-		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
-			using type = std::common_type_t<Type1, Type2> ;
-			return static_cast<type>(a) * static_cast<type>(b) ;
-		}
-	} ;
-
-	struct Div {
-		template <typename Type1, typename Type2> requires (Convertible<Type1, Type2> && Convertible<Type2, Type1>)
-		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const {
-			using type = std::common_type_t<Type1, Type2> ;
-			if (b == 0) {
-				throw Ex::error_logic("can't divide by zero!") ;
-			}
-			return static_cast<type>(a) / static_cast<type>(b) ;
-		}
-	} ;
-
-	template <EnumType type>
-	type operator|(type a, type b) noexcept {
-		using return_type = std::underlying_type_t<type> ;
-		return static_cast<type>(static_cast<return_type>(a) | static_cast<return_type>(b)) ;
-	}
-
-	template <EnumType type>
-	type operator&(type a, type b) noexcept {
-		using return_type = std::underlying_type_t<type> ;
-		return static_cast<type>(static_cast<return_type>(a) & static_cast<return_type>(b)) ;
-	}
-
-	template <EnumType type>
-	type operator~(type value) noexcept {
-		using return_type = std::underlying_type_t<type> ;
-		return static_cast<type>(~static_cast<return_type>(value)) ;
-	}
-
-	template <EnumType type>
-	type operator|=(type& a, type b) noexcept {
-		a = a | b ;
-		return a ;
-	}
-
-	template <EnumType type>
-	type operator&=(type a, type b) noexcept {
-		a = a & b ;
-		return a ;
-	}
+#pragma once
+
+#include "enum.hpp"
+
+namespace zz {
+	struct XNOR {
+		template <bool State1, bool State2> 
+		constexpr bool operator()() const noexcept {
+			return (State1 == State2) ? true : false ;
+		}
+	} ;
+
+	struct Add {
+		template <typename Type1, typename Type2> requires CommonWith<Type1, Type2>
+		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
+			using type = std::common_type_t<Type1, Type2> ;
+			return static_cast<type>(a) + static_cast<type>(b) ;
+		}
+	} ;
+
+	struct Sub {
+		template <typename Type1, typename Type2> requires CommonWith<Type1, Type2>
+		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
+			using type = std::common_type_t<Type1, Type2> ;
+			return static_cast<type>(a) - static_cast<type>(b) ;
+		}
+	} ;
+
+	struct Mul {
+		template <typename Type1, typename Type2> requires CommonWith<Type1, Type2>
+		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
+			using type = std::common_type_t<Type1, Type2> ;
+			return static_cast<type>(a) * static_cast<type>(b) ;
+		}
+	} ;
+
+	struct Div {
+		template <typename Type1, typename Type2> requires CommonWith<Type1, Type2>
+		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const {
+			using type = std::common_type_t<Type1, Type2> ;
+			if (b == 0) {
+				throw Ex::error_logic("can't divide by zero!") ;
+			}
+			return static_cast<type>(a) / static_cast<type>(b) ;
+		}
+	} ;
+
+	// kebijakan pembagian untuk Divide<policy>, Div (melempar Ex::error_logic) tetap jadi default operator /
+	using DivChecked = Div ;
+
+	// pembagi nol menghasilkan batas tipe sesuai tanda pembilang (0 / 0 = 0), integer juga aman dari MIN / -1
+	struct DivSaturate {
+		template <typename type>
+		static constexpr type saturate(type x) noexcept {
+			using limit = std::numeric_limits<type> ;
+			return x > 0 ? limit::max() : x < 0 ? limit::lowest() : type{} ;
+		}
+
+		template <typename Type1, typename Type2> requires CommonWith<Type1, Type2>
+		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
+			using type = std::common_type_t<Type1, Type2> ;
+			const type x = static_cast<type>(a) ;
+			const type y = static_cast<type>(b) ;
+
+			// float: cabang yang hampir tidak pernah diambil lebih murah daripada select per komponen, pembagi skalar
+			// yang sama untuk keempat komponen Rect cukup dicek sekali
+			if constexpr (!Integral<type>) {
+				if (y == 0) [[unlikely]] {
+					return saturate(x) ;
+				}
+				return x / y ;
+			} else {
+				// integer: pembaginya diganti 1 lalu hasilnya dipilih seperti DivZero, tanpa trap
+				const bool zero = y == 0 ;
+				bool overflow = false ;
+				if constexpr (std::is_signed_v<type>) {
+					overflow = (x == std::numeric_limits<type>::min()) & (y == -1) ;
+				}
+				const type quotient = x / (zero | overflow ? type{1} : y) ;
+				return zero ? saturate(x) : overflow ? std::numeric_limits<type>::max() : quotient ;
+			}
+		}
+	} ;
+
+	// pembagi nol menghasilkan 0. pembaginya diganti 1 dulu supaya compiler cukup memakai cmov, tanpa cabang.
+	// MIN / -1 juga dibagi 1, hasilnya MIN (wrap) dan tidak memicu trap
+	struct DivZero {
+		template <typename Type1, typename Type2> requires CommonWith<Type1, Type2>
+		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
+			using type = std::common_type_t<Type1, Type2> ;
+			const type x = static_cast<type>(a) ;
+			const type y = static_cast<type>(b) ;
+			const bool zero = y == 0 ;
+			bool overflow = false ;
+			if constexpr (std::is_signed_v<type> && Integral<type>) {
+				overflow = (x == std::numeric_limits<type>::min()) & (y == -1) ;
+			}
+			const type quotient = x / (zero | overflow ? type{1} : y) ;
+			return zero ? type{} : quotient ;
+		}
+	} ;
+
+	// pemanggil menjamin pembagi tidak nol, hanya dicek assert di build debug
+	struct DivUnchecked {
+		template <typename Type1, typename Type2> requires CommonWith<Type1, Type2>
+		constexpr std::common_type_t<Type1, Type2> operator()(Type1 a, Type2 b) const noexcept {
+			using type = std::common_type_t<Type1, Type2> ;
+			assert(b != 0 && "DivUnchecked - divide by zero") ;
+			return static_cast<type>(a) / static_cast<type>(b) ;
+		}
+	} ;
+
+	template <EnumType type>
+	type operator|(type a, type b) noexcept {
+		using return_type = std::underlying_type_t<type> ;
+		return static_cast<type>(static_cast<return_type>(a) | static_cast<return_type>(b)) ;
+	}
+
+	template <EnumType type>
+	type operator&(type a, type b) noexcept {
+		using return_type = std::underlying_type_t<type> ;
+		return static_cast<type>(static_cast<return_type>(a) & static_cast<return_type>(b)) ;
+	}
+
+	template <EnumType type>
+	type operator~(type value) noexcept {
+		using return_type = std::underlying_type_t<type> ;
+		return static_cast<type>(~static_cast<return_type>(value)) ;
+	}
+
+	template <EnumType type>
+	type operator|=(type& a, type b) noexcept {
+		a = a | b ;
+		return a ;
+	}
+
+	template <EnumType type>
+	type operator&=(type a, type b) noexcept {
+		a = a & b ;
+		return a ;
+	}
 }
\ No newline at end of file
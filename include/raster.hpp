@@ -0,0 +1,580 @@
+#pragma once
+
+#include "surface.hpp"
+#include "threadpool.hpp"
+
+namespace zz {
+
+	// rasterizer software berbasis tile. perintah gambar dikumpulkan dulu, saat Render tiap perintah dimasukkan ke bin
+	// tile 64x64 yang disentuhnya, lalu tile digambar paralel. satu tile hanya ditulis oleh satu thread dan perintah
+	// di dalamnya tetap urut, coverage dihitung dari koordinat absolut piksel, jadi hasilnya sama persis untuk jumlah
+	// thread berapapun. semua warna premultiplied, shape selain FillRect memakai anti-aliasing coverage jarak
+	class Rasterizer {
+	public :
+		static constexpr int tile_size = 64 ;
+
+	private :
+		enum class Shape : uint8_t {
+			Rect,
+			RoundedRect,
+			Polygon,
+			Image,
+			Mask
+		} ;
+
+		// e(p) = nx * x + ny * y + c, jarak bertanda ke tepi (negatif di dalam)
+		struct Edge {
+			float nx = 0.0f ;
+			float ny = 0.0f ;
+			float c = 0.0f ;
+
+			float operator()(float x, float y) const noexcept { return nx * x + ny * y + c ; }
+		} ;
+
+		struct Command {
+			Rect<int> bound {} ;
+			Color color {} ;
+			Shape shape = Shape::Rect ;
+			BlendMode mode = BlendMode::SourceOver ;
+			uint32_t first = 0 ;	// edge pertama (Polygon), index images_ (Image) atau index masks_ (Mask)
+			uint32_t count = 0 ;
+			float cx = 0.0f ;		// pusat, setengah ukuran dan radius, RoundedRect
+			float cy = 0.0f ;
+			float hx = 0.0f ;
+			float hy = 0.0f ;
+			float radius = 0.0f ;
+		} ;
+
+		// coverage A8 untuk FillMask, data menunjuk piksel mask di posisi at pada target
+		struct MaskSource {
+			const uint8_t* data = nullptr ;
+			size_t stride = 0 ;
+			Point<int> at {} ;
+		} ;
+
+		std::vector<Command> commands_ {} ;
+		std::vector<Edge> edges_ {} ;
+		std::vector<std::pair<SurfaceView, Point<int>>> images_ {} ;	// sumber Blit dan posisinya di target
+		std::vector<MaskSource> masks_ {} ;
+		std::vector<Rect<int>> clips_ {} ;									// stack PushClip, puncaknya sudah irisan semua level
+		BlendMode mode_ = BlendMode::SourceOver ;							// mode untuk perintah berikutnya
+		std::vector<std::vector<uint32_t>> bins_ {} ;
+		std::vector<Rect<int>> clip_ {} ;			// area yang boleh ditulis pada Render yang sedang berjalan
+		std::vector<uint8_t> tile_clipped_ {} ;		// 1 kalau tile beririsan dengan clip_
+		std::vector<uint32_t> active_ {} ;			// index tile yang beririsan dengan clip_
+
+		static int to_pixel(float v) noexcept {
+			constexpr float limit = 1 << 30 ;
+			return static_cast<int>(std::clamp(v, -limit, limit)) ;
+		}
+
+		// piksel yang disentuh (coverage > 0) shape dengan bounding box kontinu [x0, x1) x [y0, y1)
+		static Rect<int> pixel_bound(float x0, float y0, float x1, float y1) noexcept {
+			const int left = to_pixel(std::floor(x0)) ;
+			const int top = to_pixel(std::floor(y0)) ;
+			const int64_t width = static_cast<int64_t>(to_pixel(std::ceil(x1))) - left ;
+			const int64_t height = static_cast<int64_t>(to_pixel(std::ceil(y1))) - top ;
+			return Rect<int>(left, top, static_cast<uint32_t>(std::max<int64_t>(width, 0)), static_cast<uint32_t>(std::max<int64_t>(height, 0))) ;
+		}
+
+		// coverage 0..255 dari jarak bertanda pusat piksel ke tepi shape, lebar transisi satu piksel
+		static uint8_t coverage(float distance) noexcept {
+			return static_cast<uint8_t>(std::clamp(0.5f - distance, 0.0f, 1.0f) * 255.0f + 0.5f) ;
+		}
+
+		static Color fade(Color color, uint8_t alpha) noexcept {
+			return Color(
+				static_cast<uint8_t>(utility::Mul255(color.r, alpha)),
+				static_cast<uint8_t>(utility::Mul255(color.g, alpha)),
+				static_cast<uint8_t>(utility::Mul255(color.b, alpha)),
+				static_cast<uint8_t>(utility::Mul255(color.a, alpha))
+			) ;
+		}
+
+		// piksel x dengan pusat x + 0.5 di [lo, hi], dipotong ke [x0, x1). hasilnya [begin, end)
+		static std::pair<int, int> center_span(float lo, float hi, int x0, int x1) noexcept {
+			const int begin = static_cast<int>(std::ceil(std::clamp(lo - 0.5f, static_cast<float>(x0), static_cast<float>(x1)))) ;
+			const int end = static_cast<int>(std::floor(std::clamp(hi - 0.5f, static_cast<float>(x0 - 1), static_cast<float>(x1 - 1)))) + 1 ;
+			return {begin, std::max(begin, end)} ;
+		}
+
+		// warna opaque dengan mode source-over (linear maupun tidak) cukup menimpa dst
+		static bool replaces(Color color, BlendMode mode) noexcept {
+			return color.a == 255 && (mode == BlendMode::SourceOver || mode == BlendMode::SourceOverGamma) ;
+		}
+
+		static void solid_span(Color* row, int begin, int end, Color color, BlendMode mode) noexcept {
+			if (begin >= end) {
+				return ;
+			}
+			if (replaces(color, mode)) {
+				PixelKernel::Fill(reinterpret_cast<uint32_t*>(row + begin), static_cast<size_t>(end - begin), color) ;
+			} else {
+				PixelKernel::BlendSolid(reinterpret_cast<uint32_t*>(row + begin), color, static_cast<size_t>(end - begin), mode) ;
+			}
+		}
+
+		// outer = piksel dengan coverage > 0, inner = piksel yang pasti penuh. di luar inner coverage dihitung per piksel
+		template <typename distance_fn>
+		static void edge_span(Color* row, std::pair<int, int> outer, std::pair<int, int> inner, Color color, BlendMode mode, float yc, distance_fn&& distance) noexcept {
+			inner.first = std::clamp(inner.first, outer.first, outer.second) ;
+			inner.second = std::clamp(inner.second, inner.first, outer.second) ;
+
+			const auto partial = [&](int begin, int end) {
+				for (int x = begin ; x < end ; ++x) {
+					const uint8_t alpha = coverage(distance(static_cast<float>(x) + 0.5f, yc)) ;
+					if (alpha != 0) {
+						row[x] = Blend(row[x], fade(color, alpha), mode) ;
+					}
+				}
+			} ;
+
+			partial(outer.first, inner.first) ;
+			solid_span(row, inner.first, inner.second, color, mode) ;
+			partial(inner.second, outer.second) ;
+		}
+
+		// setengah lebar baris rounded rect di jarak qy dari sisi lurus, untuk piksel dengan sdf <= margin.
+		// negatif kalau baris tidak punya piksel seperti itu
+		static float rounded_extent(float qy, float radius, float margin) noexcept {
+			const float k = radius + margin ;
+			if (qy > k) {
+				return -1.0f ;
+			}
+			return qy > 0.0f ? std::sqrt(k * k - qy * qy) : k ;
+		}
+
+		static float rounded_distance(const Command& cmd, float x, float y) noexcept {
+			const float qx = std::abs(x - cmd.cx) - (cmd.hx - cmd.radius) ;
+			const float qy = std::abs(y - cmd.cy) - (cmd.hy - cmd.radius) ;
+			return std::hypot(std::max(qx, 0.0f), std::max(qy, 0.0f)) + std::min(std::max(qx, qy), 0.0f) - cmd.radius ;
+		}
+
+		void draw_rounded(const SurfaceView& target, const Command& cmd, const Rect<int>& area) const noexcept {
+			const int x0 = area.GetPoint().x ;
+			const int x1 = x0 + static_cast<int>(area.GetSize().w) ;
+			const auto distance = [&cmd](float x, float y) { return rounded_distance(cmd, x, y) ; } ;
+
+			for (int y = area.GetPoint().y ; y < area.GetPoint().y + static_cast<int>(area.GetSize().h) ; ++y) {
+				const float yc = static_cast<float>(y) + 0.5f ;
+				const float qy = std::abs(yc - cmd.cy) - (cmd.hy - cmd.radius) ;
+				const float outer = rounded_extent(qy, cmd.radius, 0.5f) ;
+				if (outer < 0.0f) {
+					continue ;
+				}
+
+				const float inner = rounded_extent(qy, cmd.radius, -0.5f) ;
+				const float side = cmd.hx - cmd.radius ;
+				edge_span(
+					target.Row(y),
+					center_span(cmd.cx - side - outer, cmd.cx + side + outer, x0, x1),
+					inner < 0.0f ? std::pair<int, int>{x0, x0} : center_span(cmd.cx - side - inner, cmd.cx + side + inner, x0, x1),
+					cmd.color,
+					cmd.mode,
+					yc,
+					distance
+				) ;
+			}
+		}
+
+		// rentang pusat piksel pada baris yc yang memenuhi e(p) <= margin untuk semua edge
+		std::pair<float, float> polygon_range(const Command& cmd, float yc, float margin) const noexcept {
+			float lo = -std::numeric_limits<float>::infinity() ;
+			float hi = std::numeric_limits<float>::infinity() ;
+			for (uint32_t i = cmd.first ; i < cmd.first + cmd.count ; ++i) {
+				const Edge& e = edges_[i] ;
+				const float t = margin - e.ny * yc - e.c ;
+				if (e.nx > 0.0f) {
+					hi = std::min(hi, t / e.nx) ;
+				} else if (e.nx < 0.0f) {
+					lo = std::max(lo, t / e.nx) ;
+				} else if (t < 0.0f) {
+					return {1.0f, 0.0f} ;
+				}
+			}
+			return {lo, hi} ;
+		}
+
+		float polygon_distance(const Command& cmd, float x, float y) const noexcept {
+			float distance = -std::numeric_limits<float>::infinity() ;
+			for (uint32_t i = cmd.first ; i < cmd.first + cmd.count ; ++i) {
+				distance = std::max(distance, edges_[i](x, y)) ;
+			}
+			return distance ;
+		}
+
+		void draw_polygon(const SurfaceView& target, const Command& cmd, const Rect<int>& area) const noexcept {
+			const int x0 = area.GetPoint().x ;
+			const int x1 = x0 + static_cast<int>(area.GetSize().w) ;
+			const auto distance = [this, &cmd](float x, float y) { return polygon_distance(cmd, x, y) ; } ;
+
+			for (int y = area.GetPoint().y ; y < area.GetPoint().y + static_cast<int>(area.GetSize().h) ; ++y) {
+				const float yc = static_cast<float>(y) + 0.5f ;
+				const auto [outer_lo, outer_hi] = polygon_range(cmd, yc, 0.5f) ;
+				if (!(outer_lo <= outer_hi)) {
+					continue ;
+				}
+
+				const auto [inner_lo, inner_hi] = polygon_range(cmd, yc, -0.5f) ;
+				edge_span(
+					target.Row(y),
+					center_span(outer_lo, outer_hi, x0, x1),
+					inner_lo <= inner_hi ? center_span(inner_lo, inner_hi, x0, x1) : std::pair<int, int>{x0, x0},
+					cmd.color,
+					cmd.mode,
+					yc,
+					distance
+				) ;
+			}
+		}
+
+		void draw_image(const SurfaceView& target, const Command& cmd, const Rect<int>& area) const noexcept {
+			const auto& [source, at] = images_[cmd.first] ;
+			const int x = area.GetPoint().x ;
+			for (int y = area.GetPoint().y ; y < area.GetPoint().y + static_cast<int>(area.GetSize().h) ; ++y) {
+				PixelKernel::Blend(
+					reinterpret_cast<uint32_t*>(target.Row(y) + x),
+					reinterpret_cast<const uint32_t*>(source.Row(y - at.y) + (x - at.x)),
+					static_cast<size_t>(area.GetSize().w),
+					cmd.mode
+				) ;
+			}
+		}
+
+		void draw_mask(const SurfaceView& target, const Command& cmd, const Rect<int>& area) const noexcept {
+			const MaskSource& mask = masks_[cmd.first] ;
+			const int x0 = area.GetPoint().x ;
+			const int x1 = x0 + static_cast<int>(area.GetSize().w) ;
+			for (int y = area.GetPoint().y ; y < area.GetPoint().y + static_cast<int>(area.GetSize().h) ; ++y) {
+				const uint8_t* source = mask.data + static_cast<size_t>(y - mask.at.y) * mask.stride ;
+				Color* row = target.Row(y) ;
+				for (int x = x0 ; x < x1 ; ++x) {
+					const uint8_t alpha = source[x - mask.at.x] ;
+					if (alpha == 255 && replaces(cmd.color, cmd.mode)) {
+						row[x] = cmd.color ;
+					} else if (alpha != 0) {
+						row[x] = Blend(row[x], fade(cmd.color, alpha), cmd.mode) ;
+					}
+				}
+			}
+		}
+
+		// bound dipotong ke clip yang aktif, perintah yang jatuh di luar clip tidak disimpan
+		bool push(Command cmd) {
+			if (!clips_.empty()) {
+				cmd.bound = Intersect(cmd.bound, clips_.back()) ;
+			}
+			if (IsEmpty(cmd.bound)) {
+				return false ;
+			}
+			cmd.mode = mode_ ;
+			commands_.push_back(cmd) ;
+			return true ;
+		}
+
+		// tile dilewati kalau semua pusat piksel di dalamnya ada di luar salah satu edge (coverage 0)
+		bool polygon_misses(const Command& cmd, const Rect<int>& tile) const noexcept {
+			const float x0 = static_cast<float>(tile.GetPoint().x) + 0.5f ;
+			const float y0 = static_cast<float>(tile.GetPoint().y) + 0.5f ;
+			const float x1 = x0 + static_cast<float>(tile.GetSize().w) - 1.0f ;
+			const float y1 = y0 + static_cast<float>(tile.GetSize().h) - 1.0f ;
+			for (uint32_t i = cmd.first ; i < cmd.first + cmd.count ; ++i) {
+				const Edge& e = edges_[i] ;
+				if (std::min({e(x0, y0), e(x1, y0), e(x0, y1), e(x1, y1)}) >= 0.5f) {
+					return true ;
+				}
+			}
+			return false ;
+		}
+
+		Rect<int> tile_rect(const SurfaceView& target, size_t tile) const noexcept {
+			const int columns = (target.Width() + tile_size - 1) / tile_size ;
+			const int x = static_cast<int>(tile % static_cast<size_t>(columns)) * tile_size ;
+			const int y = static_cast<int>(tile / static_cast<size_t>(columns)) * tile_size ;
+			return Rect<int>(x, y, std::min(tile_size, target.Width() - x), std::min(tile_size, target.Height() - y)) ;
+		}
+
+		void render_tile(const SurfaceView& target, size_t tile) const noexcept {
+			const std::vector<uint32_t>& bin = bins_[tile] ;
+			const Rect<int> bound = tile_rect(target, tile) ;
+
+			// rect opaque terakhir yang menutupi seluruh tile membuat perintah sebelumnya tidak terlihat
+			size_t start = 0 ;
+			for (size_t i = bin.size() ; i > 0 ; --i) {
+				const Command& cmd = commands_[bin[i - 1]] ;
+				if (cmd.shape == Shape::Rect && replaces(cmd.color, cmd.mode) && Contains(cmd.bound, bound)) {
+					start = i - 1 ;
+					break ;
+				}
+			}
+
+			// clip tidak tumpang tindih, jadi tiap piksel tetap digambar paling banyak sekali per perintah
+			for (size_t i = start ; i < bin.size() ; ++i) {
+				const Command& cmd = commands_[bin[i]] ;
+				for (const Rect<int>& clip : clip_) {
+					const Rect<int> area = Intersect(Intersect(cmd.bound, bound), clip) ;
+					if (IsEmpty(area)) {
+						continue ;
+					}
+
+					switch (cmd.shape) {
+						case Shape::Rect :
+							for (int y = area.GetPoint().y ; y < area.GetPoint().y + static_cast<int>(area.GetSize().h) ; ++y) {
+								solid_span(target.Row(y), area.GetPoint().x, area.GetPoint().x + static_cast<int>(area.GetSize().w), cmd.color, cmd.mode) ;
+							}
+							break ;
+						case Shape::RoundedRect :
+							draw_rounded(target, cmd, area) ;
+							break ;
+						case Shape::Polygon :
+							draw_polygon(target, cmd, area) ;
+							break ;
+						case Shape::Image :
+							draw_image(target, cmd, area) ;
+							break ;
+						case Shape::Mask :
+							draw_mask(target, cmd, area) ;
+							break ;
+					}
+				}
+			}
+		}
+
+	public :
+		Rasterizer() noexcept = default ;
+
+		size_t GetCommandCount() const noexcept { return commands_.size() ; }
+
+		// buang semua perintah, kapasitas buffer tetap dipakai ulang frame berikutnya
+		void Clear() noexcept {
+			commands_.clear() ;
+			edges_.clear() ;
+			images_.clear() ;
+			masks_.clear() ;
+			clips_.clear() ;
+			mode_ = BlendMode::SourceOver ;
+		}
+
+		// mode blend untuk perintah berikutnya sampai diganti atau Clear. SourceOverGamma mencampur warna dan tepi
+		// anti-aliasing di ruang linear, lebih lambat karena tanpa jalur SIMD
+		void SetBlendMode(BlendMode mode) noexcept { mode_ = mode ; }
+		BlendMode GetBlendMode() const noexcept { return mode_ ; }
+
+		// perintah berikutnya hanya menggambar di dalam r (dan di dalam clip sebelumnya) sampai PopClip
+		void PushClip(const Rect<int>& r) {
+			clips_.push_back(clips_.empty() ? r : Intersect(r, clips_.back())) ;
+		}
+
+		// PopClip tanpa PushClip diabaikan
+		void PopClip() noexcept {
+			if (!clips_.empty()) {
+				clips_.pop_back() ;
+			}
+		}
+
+		// tepi integer, tanpa anti-aliasing
+		void FillRect(const Rect<int>& r, Color color) {
+			if (IsEmpty(r) || color.a == 0) {
+				return ;
+			}
+			push(Command{.bound = r, .color = color, .shape = Shape::Rect}) ;
+		}
+
+		void FillRoundedRect(const Rect<float>& r, float radius, Color color) {
+			if (IsEmpty(r) || color.a == 0 || !std::isfinite(radius)) {
+				return ;
+			}
+
+			const float x = r.GetPoint().x ;
+			const float y = r.GetPoint().y ;
+			const float w = r.GetSize().w ;
+			const float h = r.GetSize().h ;
+			if (!std::isfinite(x + y + w + h)) {
+				return ;
+			}
+
+			Command cmd {.bound = pixel_bound(x, y, x + w, y + h), .color = color, .shape = Shape::RoundedRect} ;
+			cmd.cx = x + w * 0.5f ;
+			cmd.cy = y + h * 0.5f ;
+			cmd.hx = w * 0.5f ;
+			cmd.hy = h * 0.5f ;
+			cmd.radius = std::clamp(radius, 0.0f, std::min(cmd.hx, cmd.hy)) ;
+			push(cmd) ;
+		}
+
+		// polygon convex, urutan titik boleh searah maupun berlawanan jarum jam. polygon degenerate diabaikan
+		void FillPolygon(std::span<const Point<float>> points, Color color) {
+			if (points.size() < 3 || color.a == 0) {
+				return ;
+			}
+
+			float area = 0.0f ;
+			float x0 = std::numeric_limits<float>::infinity() ;
+			float y0 = std::numeric_limits<float>::infinity() ;
+			float x1 = -std::numeric_limits<float>::infinity() ;
+			float y1 = -std::numeric_limits<float>::infinity() ;
+			for (size_t i = 0 ; i < points.size() ; ++i) {
+				const Point<float>& p = points[i] ;
+				const Point<float>& q = points[(i + 1) % points.size()] ;
+				if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+					return ;
+				}
+				area += p.x * q.y - q.x * p.y ;
+				x0 = std::min(x0, p.x) ;
+				y0 = std::min(y0, p.y) ;
+				x1 = std::max(x1, p.x) ;
+				y1 = std::max(y1, p.y) ;
+			}
+			if (area == 0.0f) {
+				return ;
+			}
+
+			const float orientation = area > 0.0f ? 1.0f : -1.0f ;
+			const size_t first = edges_.size() ;
+			for (size_t i = 0 ; i < points.size() ; ++i) {
+				const Point<float>& p = points[i] ;
+				const Point<float>& q = points[(i + 1) % points.size()] ;
+				const float dx = q.x - p.x ;
+				const float dy = q.y - p.y ;
+				const float length = std::hypot(dx, dy) ;
+				if (length == 0.0f) {
+					continue ;
+				}
+
+				const float nx = orientation * dy / length ;
+				const float ny = -orientation * dx / length ;
+				edges_.push_back(Edge{nx, ny, -(nx * p.x + ny * p.y)}) ;
+			}
+
+			Command cmd {.bound = pixel_bound(x0, y0, x1, y1), .color = color, .shape = Shape::Polygon} ;
+			cmd.first = static_cast<uint32_t>(first) ;
+			cmd.count = static_cast<uint32_t>(edges_.size() - first) ;
+			if (!push(cmd)) {
+				edges_.resize(first) ;
+			}
+		}
+
+		// garis dengan ujung rata (butt), digambar sebagai quad
+		void DrawLine(const Point<float>& a, const Point<float>& b, float width, Color color) {
+			const float dx = b.x - a.x ;
+			const float dy = b.y - a.y ;
+			const float length = std::hypot(dx, dy) ;
+			if (!(length > 0.0f) || !(width > 0.0f)) {
+				return ;
+			}
+
+			const float ox = -dy / length * width * 0.5f ;
+			const float oy = dx / length * width * 0.5f ;
+			const std::array<Point<float>, 4> quad {
+				Point<float>(a.x + ox, a.y + oy),
+				Point<float>(b.x + ox, b.y + oy),
+				Point<float>(b.x - ox, b.y - oy),
+				Point<float>(a.x - ox, a.y - oy)
+			} ;
+			FillPolygon(quad, color) ;
+		}
+
+		// src digambar dengan pojok kiri atas di at (premultiplied, mode dari SetBlendMode). piksel src dibaca saat Render,
+		// jadi buffernya harus tetap hidup sampai Render selesai. sebagian src cukup lewat src.Sub(rect)
+		void Blit(const SurfaceView& src, const Point<int>& at) {
+			if (src.Empty()) {
+				return ;
+			}
+
+			Command cmd {.bound = Rect<int>(at.x, at.y, src.Width(), src.Height()), .shape = Shape::Image} ;
+			cmd.first = static_cast<uint32_t>(images_.size()) ;
+			if (push(cmd)) {
+				images_.emplace_back(src, at) ;
+			}
+		}
+
+		// color diwarnai coverage A8 (mis. glyph dari atlas). mask menunjuk coverage piksel kiri atas r dengan stride
+		// dalam byte, dibaca saat Render seperti Blit jadi buffernya harus tetap hidup dan tidak berubah sampai Render selesai
+		void FillMask(const uint8_t* mask, size_t stride, const Rect<int>& r, Color color) {
+			if (!mask || IsEmpty(r) || color.a == 0) {
+				return ;
+			}
+
+			Command cmd {.bound = r, .color = color, .shape = Shape::Mask} ;
+			cmd.first = static_cast<uint32_t>(masks_.size()) ;
+			if (push(cmd)) {
+				masks_.push_back(MaskSource{mask, stride, r.GetPoint()}) ;
+			}
+		}
+
+		// gambar semua perintah di atas isi target. pool nullptr berarti serial di thread pemanggil
+		void Render(const SurfaceView& target, ThreadPool* pool = nullptr) {
+			const Rect<int> bound = target.GetBound() ;
+			Render(target, std::span<const Rect<int>>(&bound, 1), pool) ;
+		}
+
+		// hanya piksel di dalam clip yang ditulis (rect tidak boleh tumpang tindih, mis. DamageRegion::GetRects),
+		// tile di luar clip tidak disentuh sama sekali. hasil di dalam clip sama dengan Render tanpa clip
+		void Render(const SurfaceView& target, std::span<const Rect<int>> clip, ThreadPool* pool = nullptr) {
+			if (target.Empty()) {
+				return ;
+			}
+
+			const int columns = (target.Width() + tile_size - 1) / tile_size ;
+			const int rows = (target.Height() + tile_size - 1) / tile_size ;
+			const size_t tile_count = static_cast<size_t>(columns) * static_cast<size_t>(rows) ;
+			if (bins_.size() < tile_count) {
+				bins_.resize(tile_count) ;
+			}
+
+			clip_.clear() ;
+			active_.clear() ;
+			tile_clipped_.assign(tile_count, 0) ;
+			for (const Rect<int>& r : clip) {
+				const Rect<int> area = Intersect(r, target.GetBound()) ;
+				if (IsEmpty(area)) {
+					continue ;
+				}
+
+				clip_.push_back(area) ;
+				for (int ty = area.GetPoint().y / tile_size ; ty <= (static_cast<int>(Bottom(area)) - 1) / tile_size ; ++ty) {
+					for (int tx = area.GetPoint().x / tile_size ; tx <= (static_cast<int>(Right(area)) - 1) / tile_size ; ++tx) {
+						tile_clipped_[static_cast<size_t>(ty) * static_cast<size_t>(columns) + static_cast<size_t>(tx)] = 1 ;
+					}
+				}
+			}
+			for (size_t i = 0 ; i < tile_count ; ++i) {
+				bins_[i].clear() ;
+				if (tile_clipped_[i]) {
+					active_.push_back(static_cast<uint32_t>(i)) ;
+				}
+			}
+
+			for (size_t i = 0 ; i < commands_.size() ; ++i) {
+				const Command& cmd = commands_[i] ;
+				const Rect<int> area = Intersect(cmd.bound, target.GetBound()) ;
+				if (IsEmpty(area)) {
+					continue ;
+				}
+
+				const int tx0 = area.GetPoint().x / tile_size ;
+				const int ty0 = area.GetPoint().y / tile_size ;
+				const int tx1 = (area.GetPoint().x + static_cast<int>(area.GetSize().w) - 1) / tile_size ;
+				const int ty1 = (area.GetPoint().y + static_cast<int>(area.GetSize().h) - 1) / tile_size ;
+				for (int ty = ty0 ; ty <= ty1 ; ++ty) {
+					for (int tx = tx0 ; tx <= tx1 ; ++tx) {
+						const size_t tile = static_cast<size_t>(ty) * static_cast<size_t>(columns) + static_cast<size_t>(tx) ;
+						if (!tile_clipped_[tile] || (cmd.shape == Shape::Polygon && polygon_misses(cmd, tile_rect(target, tile)))) {
+							continue ;
+						}
+						bins_[tile].push_back(static_cast<uint32_t>(i)) ;
+					}
+				}
+			}
+
+			const auto job = [this, &target](size_t i) noexcept { render_tile(target, active_[i]) ; } ;
+			if (pool) {
+				pool->Run(active_.size(), job) ;
+			} else {
+				for (size_t i = 0 ; i < active_.size() ; ++i) {
+					job(i) ;
+				}
+			}
+		}
+	} ;
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "enum.hpp"
+
+namespace zz {
+
+	// ring buffer untuk record trivially-copyable, N slot pertama ada di dalam objek (tanpa alokasi)
+	// dan baru pindah ke heap kalau policy-nya Grow dan buffer inline sudah penuh
+	template <typename type, size_t inline_capacity = 256>
+	requires (std::is_trivially_copyable_v<type> && std::has_single_bit(inline_capacity))
+	class RingBuffer {
+	private :
+		type inline_[inline_capacity] {} ;
+		std::unique_ptr<type[]> heap_ {} ;
+		type* data_ = inline_ ;
+		size_t mask_ = inline_capacity - 1 ;
+		size_t head_ = 0 ;
+		size_t tail_ = 0 ;
+		size_t max_capacity_ = inline_capacity * 64 ;
+		QueuePolicy policy_ = QueuePolicy::Grow ;
+
+		bool grow() noexcept {
+			const size_t capacity = mask_ + 1 ;
+			if (capacity >= max_capacity_) {
+				return false ;
+			}
+
+			std::unique_ptr<type[]> buffer(new (std::nothrow) type[capacity * 2]) ;
+			if (!buffer) {
+				return false ;
+			}
+
+			const size_t count = Size() ;
+			const size_t first = std::min(count, capacity - (head_ & mask_)) ;
+			std::memcpy(buffer.get(), data_ + (head_ & mask_), first * sizeof(type)) ;
+			std::memcpy(buffer.get() + first, data_, (count - first) * sizeof(type)) ;
+
+			heap_ = std::move(buffer) ;
+			data_ = heap_.get() ;
+			mask_ = capacity * 2 - 1 ;
+			head_ = 0 ;
+			tail_ = count ;
+
+			#ifdef RINGBUFFER_DEBUG
+				logger::info("RingBuffer::grow - Capacity grown to ", mask_ + 1) ;
+			#endif
+
+			return true ;
+		}
+
+	public :
+		RingBuffer() noexcept = default ;
+		RingBuffer(const RingBuffer&) = delete ;
+		RingBuffer& operator=(const RingBuffer&) = delete ;
+
+		explicit RingBuffer(QueuePolicy policy, size_t max_capacity = inline_capacity * 64) noexcept {
+			SetPolicy(policy, max_capacity) ;
+		}
+
+		void SetPolicy(QueuePolicy policy, size_t max_capacity = inline_capacity * 64) noexcept {
+			policy_ = policy ;
+			max_capacity_ = std::bit_ceil(std::max(max_capacity, inline_capacity)) ;
+		}
+
+		// false hanya kalau value dibuang (DropNewest, atau Grow yang sudah mentok max_capacity_). DropOldest yang
+		// menimpa elemen paling lama tetap true, Size tidak bertambah
+		bool Push(const type& value) noexcept {
+			if (Size() > mask_) {
+				if (policy_ == QueuePolicy::DropOldest) {
+					++head_ ;
+				} else if (policy_ == QueuePolicy::DropNewest || !grow()) {
+					return false ;
+				}
+			}
+
+			data_[tail_++ & mask_] = value ;
+			return true ;
+		}
+
+		bool Pop(type& value) noexcept {
+			if (head_ == tail_) {
+				return false ;
+			}
+
+			value = data_[head_++ & mask_] ;
+			return true ;
+		}
+
+		bool Peek(type& value) const noexcept {
+			if (head_ == tail_) {
+				return false ;
+			}
+
+			value = data_[head_ & mask_] ;
+			return true ;
+		}
+
+		// elemen terakhir yang di-Push, nullptr kalau kosong
+		type* Back() noexcept {
+			return head_ == tail_ ? nullptr : &data_[(tail_ - 1) & mask_] ;
+		}
+
+		void Clear() noexcept {
+			head_ = tail_ = 0 ;
+		}
+
+		// balik ke buffer inline, hanya bisa kalau isi masih muat
+		void ShrinkToFit() noexcept {
+			if (!heap_ || Size() > inline_capacity) {
+				return ;
+			}
+
+			const size_t count = Size() ;
+			for (size_t i = 0 ; i < count ; ++i) {
+				inline_[i] = data_[(head_ + i) & mask_] ;
+			}
+
+			heap_.reset() ;
+			data_ = inline_ ;
+			mask_ = inline_capacity - 1 ;
+			head_ = 0 ;
+			tail_ = count ;
+		}
+
+		size_t Size() const noexcept { return tail_ - head_ ; }
+		size_t Capacity() const noexcept { return mask_ + 1 ; }
+		bool Empty() const noexcept { return head_ == tail_ ; }
+		bool IsInline() const noexcept { return data_ == inline_ ; }
+	} ;
+}
\ No newline at end of file
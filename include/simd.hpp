@@ -0,0 +1,81 @@
+#pragma once
+
+#include "enum.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define ZZ_SIMD_X86
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#define ZZ_TARGET_AVX2
+	#else
+		#define ZZ_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#define ZZ_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace zz {
+
+	// SSE2 selalu ada di x86-64, AVX2 juga butuh dukungan OS untuk register ymm (XSAVE)
+	inline SimdLevel DetectSimd() noexcept {
+		#if defined(ZZ_SIMD_X86)
+			#ifdef _MSC_VER
+				int info[4] {} ;
+				__cpuid(info, 0) ;
+				if (info[0] < 7) {
+					return SimdLevel::SSE2 ;
+				}
+
+				__cpuid(info, 1) ;
+				const bool osxsave = (info[2] & (1 << 27)) != 0 ;
+				const bool avx = (info[2] & (1 << 28)) != 0 ;
+				if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+					return SimdLevel::SSE2 ;
+				}
+
+				__cpuidex(info, 7, 0) ;
+				return (info[1] & (1 << 5)) ? SimdLevel::AVX2 : SimdLevel::SSE2 ;
+			#else
+				__builtin_cpu_init() ;
+				return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2 ;
+			#endif
+		#elif defined(ZZ_SIMD_NEON)
+			return SimdLevel::NEON ;
+		#else
+			return SimdLevel::Scalar ;
+		#endif
+	}
+
+	class Simd {
+	private :
+		static inline SimdLevel g_detected_ = DetectSimd() ;
+		static inline SimdLevel g_level_ = g_detected_ ;
+
+	public :
+		static bool IsSupported(SimdLevel level) noexcept {
+			switch (level) {
+				case SimdLevel::Scalar :
+					return true ;
+				case SimdLevel::SSE2 :
+					return g_detected_ == SimdLevel::SSE2 || g_detected_ == SimdLevel::AVX2 ;
+				default :
+					return level == g_detected_ ;
+			}
+		}
+
+		// untuk membandingkan kernel dengan jalur scalar, level yang tidak didukung CPU ditolak
+		static bool SetLevel(SimdLevel level) noexcept {
+			if (!IsSupported(level)) {
+				return false ;
+			}
+
+			g_level_ = level ;
+			return true ;
+		}
+
+		static SimdLevel GetLevel() noexcept { return g_level_ ; }
+		static SimdLevel GetDetected() noexcept { return g_detected_ ; }
+	} ;
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "enum.hpp"
+
+namespace zz {
+
+	// index + generation, handle lama otomatis invalid setelah slot-nya dihapus/dipakai ulang
+	struct SlotHandle {
+		static constexpr uint32_t invalid_index = 0xFFFFFFFF ;
+
+		uint32_t index = invalid_index ;
+		uint32_t generation = 0 ;
+
+		constexpr bool IsValid() const noexcept { return index != invalid_index ; }
+		constexpr bool operator==(const SlotHandle&) const noexcept = default ;
+
+		// generation selalu >= 1 untuk handle valid, jadi hasil Pack tidak pernah 0
+		constexpr uint64_t Pack() const noexcept {
+			return IsValid() ? (static_cast<uint64_t>(generation) << 32) | index : 0 ;
+		}
+
+		static constexpr SlotHandle Unpack(uint64_t packed) noexcept {
+			return packed ? SlotHandle{static_cast<uint32_t>(packed), static_cast<uint32_t>(packed >> 32)} : SlotHandle{} ;
+		}
+	} ;
+
+	template <typename type>
+	class SlotMap {
+	private :
+		struct Slot {
+			type value {} ;
+			uint32_t generation = 1 ;
+			uint32_t next_free = SlotHandle::invalid_index ;
+			bool used = false ;
+		} ;
+
+		std::vector<Slot> slots_ {} ;
+		uint32_t free_head_ = SlotHandle::invalid_index ;
+		size_t size_ = 0 ;
+
+	public :
+		SlotHandle Insert(const type& value) {
+			uint32_t index = free_head_ ;
+			if (index != SlotHandle::invalid_index) {
+				free_head_ = slots_[index].next_free ;
+			} else {
+				index = static_cast<uint32_t>(slots_.size()) ;
+				slots_.emplace_back() ;
+			}
+
+			Slot& slot = slots_[index] ;
+			slot.value = value ;
+			slot.used = true ;
+			++size_ ;
+			return SlotHandle{index, slot.generation} ;
+		}
+
+		bool Erase(SlotHandle handle) noexcept {
+			if (!Contains(handle)) {
+				return false ;
+			}
+
+			Slot& slot = slots_[handle.index] ;
+			slot.value = type{} ;
+			slot.used = false ;
+			slot.generation = slot.generation == 0xFFFFFFFF ? 1 : slot.generation + 1 ;
+			slot.next_free = free_head_ ;
+			free_head_ = handle.index ;
+			--size_ ;
+			return true ;
+		}
+
+		bool Contains(SlotHandle handle) const noexcept {
+			return handle.index < slots_.size() && slots_[handle.index].used && slots_[handle.index].generation == handle.generation ;
+		}
+
+		// handle slot yang sedang dipakai di index ini, invalid kalau slot kosong. untuk id yang disimpan tanpa generation
+		SlotHandle HandleAt(uint32_t index) const noexcept {
+			return index < slots_.size() && slots_[index].used ? SlotHandle{index, slots_[index].generation} : SlotHandle{} ;
+		}
+
+		// nullptr kalau handle sudah basi
+		type* Get(SlotHandle handle) noexcept {
+			return Contains(handle) ? &slots_[handle.index].value : nullptr ;
+		}
+
+		const type* Get(SlotHandle handle) const noexcept {
+			return Contains(handle) ? &slots_[handle.index].value : nullptr ;
+		}
+
+		template <typename fn>
+		void ForEach(fn&& visit) const {
+			for (uint32_t i = 0 ; i < slots_.size() ; ++i) {
+				if (slots_[i].used) {
+					visit(SlotHandle{i, slots_[i].generation}, slots_[i].value) ;
+				}
+			}
+		}
+
+		void Clear() noexcept {
+			for (uint32_t i = 0 ; i < slots_.size() ; ++i) {
+				if (slots_[i].used) {
+					Erase(SlotHandle{i, slots_[i].generation}) ;
+				}
+			}
+		}
+
+		size_t Size() const noexcept { return size_ ; }
+		bool Empty() const noexcept { return size_ == 0 ; }
+		size_t Capacity() const noexcept { return slots_.size() ; }
+	} ;
+}
\ No newline at end of file
@@ -0,0 +1,298 @@
+#pragma once
+
+#include "batch.hpp"
+#include "aligned.hpp"
+
+namespace zz {
+
+	// view ke satu elemen container SoA, baca/tulis langsung ke array komponennya
+	template <Arithmetic type>
+	struct PointRef {
+		type& x ;
+		type& y ;
+
+		PointRef& operator=(const Point<type>& p) noexcept {
+			x = p.x ;
+			y = p.y ;
+			return *this ;
+		}
+
+		PointRef& operator=(const PointRef& o) noexcept {
+			return *this = static_cast<Point<type>>(o) ;
+		}
+
+		operator Point<type>() const noexcept { return Point<type>{x, y} ; }
+
+		// proxy dikembalikan by value, jadi std::swap biasa tidak bisa dipakai (mis. oleh std::sort)
+		friend void swap(PointRef a, PointRef b) noexcept {
+			const Point<type> t = a ;
+			a = b ;
+			b = t ;
+		}
+	} ;
+
+	template <Arithmetic type>
+	struct RectRef {
+		type& x ;
+		type& y ;
+		MakeSizeType<type>& w ;
+		MakeSizeType<type>& h ;
+
+		RectRef& operator=(const Rect<type>& r) noexcept {
+			x = r.GetPoint().x ;
+			y = r.GetPoint().y ;
+			w = r.GetSize().w ;
+			h = r.GetSize().h ;
+			return *this ;
+		}
+
+		RectRef& operator=(const RectRef& o) noexcept {
+			return *this = static_cast<Rect<type>>(o) ;
+		}
+
+		operator Rect<type>() const noexcept { return Rect<type>(x, y, w, h) ; }
+
+		Point<type> GetPoint() const noexcept { return Point<type>{x, y} ; }
+		Size<type> GetSize() const noexcept { return Size<type>(w, h) ; }
+
+		friend void swap(RectRef a, RectRef b) noexcept {
+			const Rect<type> t = a ;
+			a = b ;
+			b = t ;
+		}
+	} ;
+
+	// iterator index-based, operator* menghasilkan proxy (atau nilai untuk container const)
+	template <typename owner>
+	class SoAIterator {
+	private :
+		owner* array_ = nullptr ;
+		size_t index_ = 0 ;
+
+	public :
+		using value_type = typename std::remove_const_t<owner>::value_type ;
+		using difference_type = std::ptrdiff_t ;
+
+		SoAIterator() noexcept = default ;
+		SoAIterator(owner* array, size_t index) noexcept : array_(array), index_(index) {}
+
+		auto operator*() const noexcept { return (*array_)[index_] ; }
+		auto operator[](difference_type n) const noexcept { return (*array_)[index_ + n] ; }
+
+		SoAIterator& operator++() noexcept { ++index_ ; return *this ; }
+		SoAIterator& operator--() noexcept { --index_ ; return *this ; }
+		SoAIterator operator++(int) noexcept { SoAIterator it = *this ; ++index_ ; return it ; }
+		SoAIterator operator--(int) noexcept { SoAIterator it = *this ; --index_ ; return it ; }
+		SoAIterator& operator+=(difference_type n) noexcept { index_ += n ; return *this ; }
+		SoAIterator& operator-=(difference_type n) noexcept { index_ -= n ; return *this ; }
+
+		friend SoAIterator operator+(SoAIterator it, difference_type n) noexcept { return it += n ; }
+		friend SoAIterator operator+(difference_type n, SoAIterator it) noexcept { return it += n ; }
+		friend SoAIterator operator-(SoAIterator it, difference_type n) noexcept { return it -= n ; }
+		friend difference_type operator-(const SoAIterator& a, const SoAIterator& b) noexcept {
+			return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_) ;
+		}
+
+		bool operator==(const SoAIterator& o) const noexcept { return index_ == o.index_ ; }
+		auto operator<=>(const SoAIterator& o) const noexcept { return index_ <=> o.index_ ; }
+
+		size_t GetIndex() const noexcept { return index_ ; }
+	} ;
+
+	// x dan y disimpan di array terpisah yang rata ke cache line
+	template <Arithmetic type>
+	class PointArray {
+	private :
+		AlignedVector<type> xs_ {} ;
+		AlignedVector<type> ys_ {} ;
+
+	public :
+		using value_type = Point<type> ;
+		using iterator = SoAIterator<PointArray> ;
+		using const_iterator = SoAIterator<const PointArray> ;
+
+		PointArray() noexcept = default ;
+
+		explicit PointArray(size_t count) : xs_(count), ys_(count) {}
+
+		explicit PointArray(std::span<const Point<type>> points) {
+			Assign(points) ;
+		}
+
+		void Assign(std::span<const Point<type>> points) {
+			Resize(points.size()) ;
+			for (size_t i = 0 ; i < points.size() ; ++i) {
+				xs_[i] = points[i].x ;
+				ys_[i] = points[i].y ;
+			}
+		}
+
+		std::vector<Point<type>> ToVector() const {
+			std::vector<Point<type>> points(Size()) ;
+			for (size_t i = 0 ; i < points.size() ; ++i) {
+				points[i] = Point<type>{xs_[i], ys_[i]} ;
+			}
+			return points ;
+		}
+
+		void PushBack(const Point<type>& p) {
+			xs_.push_back(p.x) ;
+			ys_.push_back(p.y) ;
+		}
+
+		void PopBack() noexcept {
+			xs_.pop_back() ;
+			ys_.pop_back() ;
+		}
+
+		void Resize(size_t count) {
+			xs_.resize(count) ;
+			ys_.resize(count) ;
+		}
+
+		void Reserve(size_t count) {
+			xs_.reserve(count) ;
+			ys_.reserve(count) ;
+		}
+
+		void Clear() noexcept {
+			xs_.clear() ;
+			ys_.clear() ;
+		}
+
+		PointRef<type> operator[](size_t i) noexcept { return PointRef<type>{xs_[i], ys_[i]} ; }
+		Point<type> operator[](size_t i) const noexcept { return Point<type>{xs_[i], ys_[i]} ; }
+
+		iterator begin() noexcept { return iterator{this, 0} ; }
+		iterator end() noexcept { return iterator{this, Size()} ; }
+		const_iterator begin() const noexcept { return const_iterator{this, 0} ; }
+		const_iterator end() const noexcept { return const_iterator{this, Size()} ; }
+
+		// akses langsung per komponen untuk pass yang di-vectorize
+		std::span<type> X() noexcept { return xs_ ; }
+		std::span<type> Y() noexcept { return ys_ ; }
+		std::span<const type> X() const noexcept { return xs_ ; }
+		std::span<const type> Y() const noexcept { return ys_ ; }
+
+		size_t Size() const noexcept { return xs_.size() ; }
+		bool Empty() const noexcept { return xs_.empty() ; }
+	} ;
+
+	// x, y, w, h masing-masing di array sendiri, w/h memakai MakeSizeType seperti Rect
+	template <Arithmetic type>
+	class RectArray {
+	private :
+		using size_type = MakeSizeType<type> ;
+
+		AlignedVector<type> xs_ {} ;
+		AlignedVector<type> ys_ {} ;
+		AlignedVector<size_type> ws_ {} ;
+		AlignedVector<size_type> hs_ {} ;
+
+	public :
+		using value_type = Rect<type> ;
+		using iterator = SoAIterator<RectArray> ;
+		using const_iterator = SoAIterator<const RectArray> ;
+
+		RectArray() noexcept = default ;
+
+		explicit RectArray(size_t count) : xs_(count), ys_(count), ws_(count), hs_(count) {}
+
+		explicit RectArray(std::span<const Rect<type>> rects) {
+			Assign(rects) ;
+		}
+
+		void Assign(std::span<const Rect<type>> rects) {
+			Resize(rects.size()) ;
+			for (size_t i = 0 ; i < rects.size() ; ++i) {
+				(*this)[i] = rects[i] ;
+			}
+		}
+
+		std::vector<Rect<type>> ToVector() const {
+			std::vector<Rect<type>> rects(Size()) ;
+			for (size_t i = 0 ; i < rects.size() ; ++i) {
+				rects[i] = (*this)[i] ;
+			}
+			return rects ;
+		}
+
+		void PushBack(const Rect<type>& r) {
+			xs_.push_back(r.GetPoint().x) ;
+			ys_.push_back(r.GetPoint().y) ;
+			ws_.push_back(r.GetSize().w) ;
+			hs_.push_back(r.GetSize().h) ;
+		}
+
+		void PopBack() noexcept {
+			xs_.pop_back() ;
+			ys_.pop_back() ;
+			ws_.pop_back() ;
+			hs_.pop_back() ;
+		}
+
+		void Resize(size_t count) {
+			xs_.resize(count) ;
+			ys_.resize(count) ;
+			ws_.resize(count) ;
+			hs_.resize(count) ;
+		}
+
+		void Reserve(size_t count) {
+			xs_.reserve(count) ;
+			ys_.reserve(count) ;
+			ws_.reserve(count) ;
+			hs_.reserve(count) ;
+		}
+
+		void Clear() noexcept {
+			xs_.clear() ;
+			ys_.clear() ;
+			ws_.clear() ;
+			hs_.clear() ;
+		}
+
+		RectRef<type> operator[](size_t i) noexcept { return RectRef<type>{xs_[i], ys_[i], ws_[i], hs_[i]} ; }
+		Rect<type> operator[](size_t i) const noexcept { return Rect<type>(xs_[i], ys_[i], ws_[i], hs_[i]) ; }
+
+		iterator begin() noexcept { return iterator{this, 0} ; }
+		iterator end() noexcept { return iterator{this, Size()} ; }
+		const_iterator begin() const noexcept { return const_iterator{this, 0} ; }
+		const_iterator end() const noexcept { return const_iterator{this, Size()} ; }
+
+		std::span<type> X() noexcept { return xs_ ; }
+		std::span<type> Y() noexcept { return ys_ ; }
+		std::span<size_type> W() noexcept { return ws_ ; }
+		std::span<size_type> H() noexcept { return hs_ ; }
+		std::span<const type> X() const noexcept { return xs_ ; }
+		std::span<const type> Y() const noexcept { return ys_ ; }
+		std::span<const size_type> W() const noexcept { return ws_ ; }
+		std::span<const size_type> H() const noexcept { return hs_ ; }
+
+		size_t Size() const noexcept { return xs_.size() ; }
+		bool Empty() const noexcept { return xs_.empty() ; }
+	} ;
+
+	// versi SoA dari batch kernel, tiap komponen diproses sebagai satu array kontigu
+	inline void Translate(PointArray<float>& points, const Point<float>& offset) noexcept {
+		Kernel::Add(points.X().data(), points.Size(), {offset.x, offset.x, offset.x, offset.x}) ;
+		Kernel::Add(points.Y().data(), points.Size(), {offset.y, offset.y, offset.y, offset.y}) ;
+	}
+
+	inline void Translate(RectArray<float>& rects, const Point<float>& offset) noexcept {
+		Kernel::Add(rects.X().data(), rects.Size(), {offset.x, offset.x, offset.x, offset.x}) ;
+		Kernel::Add(rects.Y().data(), rects.Size(), {offset.y, offset.y, offset.y, offset.y}) ;
+	}
+
+	inline void Translate(RectArray<int>& rects, const Point<int>& offset) noexcept {
+		Kernel::Add(rects.X().data(), rects.Size(), {offset.x, offset.x, offset.x, offset.x}) ;
+		Kernel::Add(rects.Y().data(), rects.Size(), {offset.y, offset.y, offset.y, offset.y}) ;
+	}
+
+	inline void Scale(RectArray<float>& rects, const Point<float>& factor) noexcept {
+		Kernel::Mul(rects.X().data(), rects.Size(), {factor.x, factor.x, factor.x, factor.x}) ;
+		Kernel::Mul(rects.Y().data(), rects.Size(), {factor.y, factor.y, factor.y, factor.y}) ;
+		Kernel::Mul(rects.W().data(), rects.Size(), {factor.x, factor.x, factor.x, factor.x}) ;
+		Kernel::Mul(rects.H().data(), rects.Size(), {factor.y, factor.y, factor.y, factor.y}) ;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,546 @@
+#pragma once
+
+#include "geometry.hpp"
+
+namespace zz {
+
+	// index ruang untuk rect yang diberi id (biasanya index slot), dipakai untuk hit test tanpa menelusuri semua elemen.
+	// id dipilih pemanggil dan sebaiknya rapat (index SlotMap), karena tabel item di-index langsung dengan id.
+	// semantik sama dengan geometry.hpp: titik setengah terbuka, rect kosong tidak pernah kena
+	class SpatialIndex {
+	protected :
+		// bentuk min/max, lebih murah untuk query daripada x/y/w/h
+		struct Box {
+			float x0 = std::numeric_limits<float>::infinity() ;
+			float y0 = std::numeric_limits<float>::infinity() ;
+			float x1 = -std::numeric_limits<float>::infinity() ;
+			float y1 = -std::numeric_limits<float>::infinity() ;
+
+			// rect kosong menjadi box terbalik yang tidak memuat apa-apa
+			static Box From(const Rect<float>& r) noexcept {
+				if (IsEmpty(r)) {
+					return Box{} ;
+				}
+				return Box{r.GetPoint().x, r.GetPoint().y, Right(r), Bottom(r)} ;
+			}
+
+			bool Contains(const Point<float>& p) const noexcept {
+				return (p.x >= x0) & (p.x < x1) & (p.y >= y0) & (p.y < y1) ;
+			}
+
+			bool Intersects(const Box& o) const noexcept {
+				return (x0 < o.x1) & (o.x0 < x1) & (y0 < o.y1) & (o.y0 < y1) ;
+			}
+
+			void Expand(const Box& o) noexcept {
+				x0 = std::min(x0, o.x0) ;
+				y0 = std::min(y0, o.y0) ;
+				x1 = std::max(x1, o.x1) ;
+				y1 = std::max(y1, o.y1) ;
+			}
+
+			bool Valid() const noexcept { return x0 < x1 && y0 < y1 ; }
+		} ;
+
+		// z lebih besar di atas, z sama dimenangkan id lebih besar
+		static bool above(uint32_t z, uint32_t id, uint32_t best_z, uint32_t best_id) noexcept {
+			return z > best_z || (z == best_z && id > best_id) ;
+		}
+
+	public :
+		virtual ~SpatialIndex() noexcept = default ;
+
+		// id yang sudah ada dipindah (update), bukan diduplikasi
+		virtual void Insert(uint32_t id, const Rect<float>& r, uint32_t z = 0) = 0 ;
+		virtual void Erase(uint32_t id) noexcept = 0 ;
+		virtual void Clear() noexcept = 0 ;
+		virtual size_t Size() const noexcept = 0 ;
+
+		// out dikosongkan dulu, urutan hasil tidak ditentukan
+		virtual void QueryPoint(const Point<float>& p, std::vector<uint32_t>& out) = 0 ;
+		virtual void QueryRect(const Rect<float>& r, std::vector<uint32_t>& out) = 0 ;
+
+		// id paling atas (z terbesar) yang memuat p
+		virtual std::optional<uint32_t> TopAt(const Point<float>& p) = 0 ;
+	} ;
+
+	// grid seragam dengan cell di hash map, jadi koordinat tidak dibatasi. update yang tidak pindah cell O(1),
+	// pindah cell menyentuh cell lama dan baru saja. rect yang menutupi lebih dari max_cells cell disimpan di daftar
+	// terpisah yang dicek setiap query, supaya satu background besar tidak masuk ke ratusan cell.
+	// cocok untuk elemen yang sering bergerak dan ukurannya mirip cell
+	class SpatialGrid : public SpatialIndex {
+	public :
+		static constexpr int64_t max_cells = 64 ;
+
+	private :
+		struct Item {
+			Box box {} ;
+			uint32_t z = 0 ;
+			uint32_t stamp = 0 ;		// query_ terakhir yang sudah melaporkan item ini, untuk QueryRect
+			int32_t cx0 = 0 ;
+			int32_t cy0 = 0 ;
+			int32_t cx1 = -1 ;			// inklusif, cx1 < cx0 berarti tidak ada di cell manapun
+			int32_t cy1 = -1 ;
+			bool used = false ;
+			bool oversize = false ;
+		} ;
+
+		float cell_size_ = 64.0f ;
+		float inverse_ = 1.0f / 64.0f ;
+		std::vector<Item> items_ {} ;
+		std::unordered_map<uint64_t, std::vector<uint32_t>> cells_ {} ;
+		std::vector<uint32_t> oversize_ {} ;
+		size_t size_ = 0 ;
+		uint32_t query_ = 0 ;
+
+		static uint64_t key(int32_t cx, int32_t cy) noexcept {
+			return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy) ;
+		}
+
+		int32_t cell_of(float v) const noexcept {
+			constexpr float limit = 1 << 30 ;
+			return static_cast<int32_t>(std::floor(std::clamp(v * inverse_, -limit, limit))) ;
+		}
+
+		static void remove_id(std::vector<uint32_t>& ids, uint32_t id) noexcept {
+			const auto it = std::find(ids.begin(), ids.end(), id) ;
+			if (it != ids.end()) {
+				*it = ids.back() ;
+				ids.pop_back() ;
+			}
+		}
+
+		// tepi kanan/bawah setengah terbuka, jadi cell terakhir diambil dari titik tepat sebelum x1/y1
+		void place(Item& item) const noexcept {
+			if (!item.box.Valid()) {
+				item.cx0 = item.cy0 = 0 ;
+				item.cx1 = item.cy1 = -1 ;
+				item.oversize = false ;
+				return ;
+			}
+
+			item.cx0 = cell_of(item.box.x0) ;
+			item.cy0 = cell_of(item.box.y0) ;
+			item.cx1 = std::max(item.cx0, cell_of(std::nextafter(item.box.x1, item.box.x0))) ;
+			item.cy1 = std::max(item.cy0, cell_of(std::nextafter(item.box.y1, item.box.y0))) ;
+			const int64_t cells = (static_cast<int64_t>(item.cx1) - item.cx0 + 1) * (static_cast<int64_t>(item.cy1) - item.cy0 + 1) ;
+			item.oversize = cells > max_cells ;
+		}
+
+		void link(uint32_t id) {
+			const Item& item = items_[id] ;
+			if (item.oversize) {
+				oversize_.push_back(id) ;
+				return ;
+			}
+			for (int32_t cy = item.cy0 ; cy <= item.cy1 ; ++cy) {
+				for (int32_t cx = item.cx0 ; cx <= item.cx1 ; ++cx) {
+					cells_[key(cx, cy)].push_back(id) ;
+				}
+			}
+		}
+
+		void unlink(uint32_t id) noexcept {
+			const Item& item = items_[id] ;
+			if (item.oversize) {
+				remove_id(oversize_, id) ;
+				return ;
+			}
+			for (int32_t cy = item.cy0 ; cy <= item.cy1 ; ++cy) {
+				for (int32_t cx = item.cx0 ; cx <= item.cx1 ; ++cx) {
+					if (const auto it = cells_.find(key(cx, cy)) ; it != cells_.end()) {
+						remove_id(it->second, id) ;
+					}
+				}
+			}
+		}
+
+		// semua id di cell p dan di daftar oversize
+		template <typename fn>
+		void visit_point(const Point<float>& p, fn&& visit) const {
+			if (const auto it = cells_.find(key(cell_of(p.x), cell_of(p.y))) ; it != cells_.end()) {
+				for (uint32_t id : it->second) {
+					visit(id) ;
+				}
+			}
+			for (uint32_t id : oversize_) {
+				visit(id) ;
+			}
+		}
+
+	public :
+		explicit SpatialGrid(float cell_size = 64.0f) noexcept : cell_size_(cell_size > 0.0f ? cell_size : 64.0f), inverse_(1.0f / cell_size_) {}
+
+		float GetCellSize() const noexcept { return cell_size_ ; }
+
+		void Insert(uint32_t id, const Rect<float>& r, uint32_t z = 0) override {
+			if (id >= items_.size()) {
+				items_.resize(static_cast<size_t>(id) + 1) ;
+			}
+
+			Item next = items_[id] ;
+			next.box = Box::From(r) ;
+			next.z = z ;
+			place(next) ;
+
+			Item& item = items_[id] ;
+			if (item.used && item.oversize == next.oversize && item.cx0 == next.cx0 && item.cy0 == next.cy0 && item.cx1 == next.cx1 && item.cy1 == next.cy1) {
+				item = next ;
+				return ;
+			}
+
+			if (item.used) {
+				unlink(id) ;
+			} else {
+				++size_ ;
+			}
+			item = next ;
+			item.used = true ;
+			link(id) ;
+		}
+
+		void Erase(uint32_t id) noexcept override {
+			if (id < items_.size() && items_[id].used) {
+				unlink(id) ;
+				items_[id] = Item{} ;
+				--size_ ;
+			}
+		}
+
+		// kapasitas cell tetap dipakai ulang
+		void Clear() noexcept override {
+			for (auto& [k, ids] : cells_) {
+				ids.clear() ;
+			}
+			oversize_.clear() ;
+			items_.clear() ;
+			size_ = 0 ;
+		}
+
+		size_t Size() const noexcept override { return size_ ; }
+
+		void QueryPoint(const Point<float>& p, std::vector<uint32_t>& out) override {
+			out.clear() ;
+			visit_point(p, [this, &p, &out](uint32_t id) {
+				if (items_[id].box.Contains(p)) {
+					out.push_back(id) ;
+				}
+			}) ;
+		}
+
+		// rect yang menutupi lebih banyak cell daripada yang terisi cukup menelusuri map sekali
+		void QueryRect(const Rect<float>& r, std::vector<uint32_t>& out) override {
+			out.clear() ;
+			const Box box = Box::From(r) ;
+			if (!box.Valid()) {
+				return ;
+			}
+
+			if (++query_ == 0) {
+				for (Item& item : items_) {
+					item.stamp = 0 ;
+				}
+				query_ = 1 ;
+			}
+
+			const auto report = [this, &box, &out](uint32_t id) {
+				Item& item = items_[id] ;
+				if (item.stamp != query_ && item.box.Intersects(box)) {
+					item.stamp = query_ ;
+					out.push_back(id) ;
+				}
+			} ;
+
+			const int32_t cx0 = cell_of(box.x0) ;
+			const int32_t cy0 = cell_of(box.y0) ;
+			const int32_t cx1 = std::max(cx0, cell_of(std::nextafter(box.x1, box.x0))) ;
+			const int32_t cy1 = std::max(cy0, cell_of(std::nextafter(box.y1, box.y0))) ;
+			const int64_t cells = (static_cast<int64_t>(cx1) - cx0 + 1) * (static_cast<int64_t>(cy1) - cy0 + 1) ;
+			if (cells > static_cast<int64_t>(cells_.size())) {
+				for (const auto& [k, ids] : cells_) {
+					for (uint32_t id : ids) {
+						report(id) ;
+					}
+				}
+			} else {
+				for (int32_t cy = cy0 ; cy <= cy1 ; ++cy) {
+					for (int32_t cx = cx0 ; cx <= cx1 ; ++cx) {
+						if (const auto it = cells_.find(key(cx, cy)) ; it != cells_.end()) {
+							for (uint32_t id : it->second) {
+								report(id) ;
+							}
+						}
+					}
+				}
+			}
+			for (uint32_t id : oversize_) {
+				report(id) ;
+			}
+		}
+
+		std::optional<uint32_t> TopAt(const Point<float>& p) override {
+			std::optional<uint32_t> best {} ;
+			visit_point(p, [this, &p, &best](uint32_t id) {
+				const Item& item = items_[id] ;
+				if (item.box.Contains(p) && (!best || above(item.z, id, items_[*best].z, *best))) {
+					best = id ;
+				}
+			}) ;
+			return best ;
+		}
+	} ;
+
+	// R-tree statis yang dipak (urut kurva Hilbert, fanout node_size, semua level di array yang sama), query cepat dan
+	// tanpa alokasi per node. update ukuran/posisi memperbarui box leaf lalu bound ancestor-nya (refit, O(log n)),
+	// item baru ditampung di daftar pending yang dicek linear. tree dibangun ulang otomatis pada query berikutnya kalau
+	// pending, hapus atau refit sudah terlalu banyak. cocok untuk banyak elemen yang jarang bergerak
+	class PackedRTree : public SpatialIndex {
+	public :
+		static constexpr size_t node_size = 16 ;
+
+	private :
+		static constexpr uint32_t no_slot = 0xFFFFFFFF ;
+
+		struct Item {
+			Box box {} ;
+			uint32_t z = 0 ;
+			uint32_t slot = no_slot ;	// posisi leaf di boxes_, no_slot = pending
+			bool used = false ;
+		} ;
+
+		std::vector<Item> items_ {} ;
+		std::vector<Box> boxes_ {} ;		// level 0 (leaf) dulu, root paling akhir
+		std::vector<uint32_t> first_ {} ;	// leaf: id item, node: index box anak pertama
+		std::vector<uint32_t> last_ {} ;	// node: index box setelah anak terakhir
+		std::vector<size_t> levels_ {} ;	// awal tiap level, ditambah boxes_.size() di akhir
+		std::vector<uint32_t> pending_ {} ;
+		std::vector<uint32_t> stack_ {} ;
+		std::vector<std::pair<uint32_t, uint32_t>> order_ {} ;	// (hilbert, id) sementara untuk Rebuild
+		size_t size_ = 0 ;
+		size_t stale_ = 0 ;			// leaf yang sudah dihapus atau di-refit sejak Rebuild
+		bool dirty_ = false ;
+
+		// posisi pada kurva Hilbert 65536 x 65536
+		static uint32_t hilbert(uint32_t x, uint32_t y) noexcept {
+			uint32_t d = 0 ;
+			for (uint32_t s = 1u << 15 ; s > 0 ; s >>= 1) {
+				const uint32_t rx = (x & s) ? 1 : 0 ;
+				const uint32_t ry = (y & s) ? 1 : 0 ;
+				d += s * s * ((3 * rx) ^ ry) ;
+				if (ry == 0) {
+					if (rx == 1) {
+						x = 0xFFFF - x ;
+						y = 0xFFFF - y ;
+					}
+					std::swap(x, y) ;
+				}
+			}
+			return d ;
+		}
+
+		bool is_leaf(size_t i) const noexcept { return i < levels_[1] ; }
+
+		// rebuild ditunda sampai query, jadi banyak update berturut-turut hanya membayar sekali
+		void check_rebuild() noexcept {
+			if (!dirty_ && (pending_.size() > std::max<size_t>(64, size_ / 8) || stale_ > std::max<size_t>(64, size_ / 4))) {
+				dirty_ = true ;
+			}
+		}
+
+		void refit(size_t i) noexcept {
+			for (size_t level = 0 ; level + 2 < levels_.size() ; ++level) {
+				const size_t parent = levels_[level + 1] + (i - levels_[level]) / node_size ;
+				Box box {} ;
+				for (uint32_t child = first_[parent] ; child < last_[parent] ; ++child) {
+					box.Expand(boxes_[child]) ;
+				}
+				boxes_[parent] = box ;
+				i = parent ;
+			}
+		}
+
+		void prepare() {
+			if (dirty_) {
+				Rebuild() ;
+			}
+		}
+
+		template <typename hit_fn, typename fn>
+		void traverse(hit_fn&& hit, fn&& visit) {
+			prepare() ;
+			if (!boxes_.empty()) {
+				stack_.clear() ;
+				stack_.push_back(static_cast<uint32_t>(boxes_.size() - 1)) ;
+				while (!stack_.empty()) {
+					const uint32_t i = stack_.back() ;
+					stack_.pop_back() ;
+					if (!hit(boxes_[i])) {
+						continue ;
+					}
+					if (is_leaf(i)) {
+						visit(first_[i]) ;
+					} else {
+						for (uint32_t child = first_[i] ; child < last_[i] ; ++child) {
+							stack_.push_back(child) ;
+						}
+					}
+				}
+			}
+			for (uint32_t id : pending_) {
+				if (hit(items_[id].box)) {
+					visit(id) ;
+				}
+			}
+		}
+
+	public :
+		PackedRTree() noexcept = default ;
+
+		void Insert(uint32_t id, const Rect<float>& r, uint32_t z = 0) override {
+			if (id >= items_.size()) {
+				items_.resize(static_cast<size_t>(id) + 1) ;
+			}
+
+			Item& item = items_[id] ;
+			item.box = Box::From(r) ;
+			item.z = z ;
+			if (!item.used) {
+				item.used = true ;
+				item.slot = no_slot ;
+				pending_.push_back(id) ;
+				++size_ ;
+			} else if (item.slot != no_slot) {
+				boxes_[item.slot] = item.box ;
+				refit(item.slot) ;
+				++stale_ ;
+			}
+			check_rebuild() ;
+		}
+
+		void Erase(uint32_t id) noexcept override {
+			if (id >= items_.size() || !items_[id].used) {
+				return ;
+			}
+
+			Item& item = items_[id] ;
+			if (item.slot != no_slot) {
+				boxes_[item.slot] = Box{} ;
+				first_[item.slot] = no_slot ;
+				refit(item.slot) ;
+				++stale_ ;
+			} else {
+				const auto it = std::find(pending_.begin(), pending_.end(), id) ;
+				*it = pending_.back() ;
+				pending_.pop_back() ;
+			}
+			item = Item{} ;
+			--size_ ;
+			check_rebuild() ;
+		}
+
+		void Clear() noexcept override {
+			items_.clear() ;
+			boxes_.clear() ;
+			first_.clear() ;
+			last_.clear() ;
+			levels_.clear() ;
+			pending_.clear() ;
+			size_ = 0 ;
+			stale_ = 0 ;
+			dirty_ = false ;
+		}
+
+		size_t Size() const noexcept override { return size_ ; }
+
+		// bangun ulang dari semua item, biasanya dipanggil otomatis oleh query. O(n log n)
+		void Rebuild() {
+			dirty_ = false ;
+			stale_ = 0 ;
+			pending_.clear() ;
+			boxes_.clear() ;
+			first_.clear() ;
+			last_.clear() ;
+			levels_.clear() ;
+
+			Box bound {} ;
+			order_.clear() ;
+			for (uint32_t id = 0 ; id < items_.size() ; ++id) {
+				if (items_[id].used) {
+					items_[id].slot = no_slot ;
+					if (items_[id].box.Valid()) {
+						bound.Expand(items_[id].box) ;
+						order_.emplace_back(0, id) ;
+					} else {
+						// rect kosong tidak pernah kena query, cukup ditampung di pending
+						pending_.push_back(id) ;
+					}
+				}
+			}
+			if (order_.empty()) {
+				return ;
+			}
+
+			const float sx = bound.x1 > bound.x0 ? 65535.0f / (bound.x1 - bound.x0) : 0.0f ;
+			const float sy = bound.y1 > bound.y0 ? 65535.0f / (bound.y1 - bound.y0) : 0.0f ;
+			for (auto& [h, id] : order_) {
+				const Box& box = items_[id].box ;
+				const float cx = ((box.x0 + box.x1) * 0.5f - bound.x0) * sx ;
+				const float cy = ((box.y0 + box.y1) * 0.5f - bound.y0) * sy ;
+				h = hilbert(static_cast<uint32_t>(std::clamp(cx, 0.0f, 65535.0f)), static_cast<uint32_t>(std::clamp(cy, 0.0f, 65535.0f))) ;
+			}
+			std::sort(order_.begin(), order_.end()) ;
+
+			levels_.push_back(0) ;
+			for (const auto& [h, id] : order_) {
+				items_[id].slot = static_cast<uint32_t>(boxes_.size()) ;
+				boxes_.push_back(items_[id].box) ;
+				first_.push_back(id) ;
+				last_.push_back(0) ;
+			}
+
+			// level di atasnya sampai tersisa satu root
+			size_t begin = 0 ;
+			size_t end = boxes_.size() ;
+			do {
+				levels_.push_back(end) ;
+				for (size_t i = begin ; i < end ; i += node_size) {
+					const size_t stop = std::min(i + node_size, end) ;
+					Box box {} ;
+					for (size_t child = i ; child < stop ; ++child) {
+						box.Expand(boxes_[child]) ;
+					}
+					boxes_.push_back(box) ;
+					first_.push_back(static_cast<uint32_t>(i)) ;
+					last_.push_back(static_cast<uint32_t>(stop)) ;
+				}
+				begin = end ;
+				end = boxes_.size() ;
+			} while (end - begin > 1) ;
+			levels_.push_back(end) ;
+		}
+
+		void QueryPoint(const Point<float>& p, std::vector<uint32_t>& out) override {
+			out.clear() ;
+			traverse([&p](const Box& box) { return box.Contains(p) ; }, [&out](uint32_t id) { out.push_back(id) ; }) ;
+		}
+
+		void QueryRect(const Rect<float>& r, std::vector<uint32_t>& out) override {
+			out.clear() ;
+			const Box query = Box::From(r) ;
+			if (!query.Valid()) {
+				return ;
+			}
+			traverse([&query](const Box& box) { return box.Intersects(query) ; }, [&out](uint32_t id) { out.push_back(id) ; }) ;
+		}
+
+		std::optional<uint32_t> TopAt(const Point<float>& p) override {
+			std::optional<uint32_t> best {} ;
+			traverse([&p](const Box& box) { return box.Contains(p) ; }, [this, &best](uint32_t id) {
+				if (!best || above(items_[id].z, id, items_[*best].z, *best)) {
+					best = id ;
+				}
+			}) ;
+			return best ;
+		}
+	} ;
+}
\ No newline at end of file
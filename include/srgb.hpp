@@ -0,0 +1,166 @@
+#pragma once
+
+#include "unit.hpp"
+
+namespace utility {
+	// std::pow/exp/log belum constexpr di C++20, cukup akurat (~1e-15) untuk membangun tabel saat kompilasi
+	constexpr double ConstLog(double x) noexcept {
+		constexpr double ln2 = 0.693147180559945309417 ;
+		int exponent = 0 ;
+		for ( ; x >= 2.0 ; x *= 0.5) {
+			++exponent ;
+		}
+		for ( ; x < 1.0 ; x *= 2.0) {
+			--exponent ;
+		}
+
+		// ln(x) = 2 atanh((x - 1) / (x + 1)), z <= 1/3 jadi deretnya cepat konvergen
+		const double z = (x - 1.0) / (x + 1.0) ;
+		double term = z ;
+		double sum = 0.0 ;
+		for (int k = 1 ; k < 40 ; k += 2) {
+			sum += term / k ;
+			term *= z * z ;
+		}
+		return 2.0 * sum + exponent * ln2 ;
+	}
+
+	constexpr double ConstExp(double x) noexcept {
+		constexpr double ln2 = 0.693147180559945309417 ;
+		const int k = static_cast<int>(x / ln2 + (x < 0 ? -0.5 : 0.5)) ;
+		const double r = x - k * ln2 ;
+
+		double term = 1.0 ;
+		double sum = 1.0 ;
+		for (int i = 1 ; i < 20 ; ++i) {
+			term *= r / i ;
+			sum += term ;
+		}
+		for (int i = 0 ; i < k ; ++i) {
+			sum *= 2.0 ;
+		}
+		for (int i = 0 ; i > k ; --i) {
+			sum *= 0.5 ;
+		}
+		return sum ;
+	}
+
+	constexpr double ConstPow(double base, double exponent) noexcept {
+		return base <= 0.0 ? 0.0 : ConstExp(exponent * ConstLog(base)) ;
+	}
+
+	// kurva standar IEC 61966-2-1, nilai 0..1
+	constexpr double SrgbToLinear(double v) noexcept {
+		return v <= 0.04045 ? v / 12.92 : ConstPow((v + 0.055) / 1.055, 2.4) ;
+	}
+
+	constexpr double LinearToSrgb(double v) noexcept {
+		return v <= 0.0031308 ? v * 12.92 : 1.055 * ConstPow(v, 1.0 / 2.4) - 0.055 ;
+	}
+
+	constexpr std::array<uint16_t, 256> MakeDecodeTable() noexcept {
+		std::array<uint16_t, 256> table {} ;
+		for (size_t i = 0 ; i < table.size() ; ++i) {
+			table[i] = static_cast<uint16_t>(SrgbToLinear(i / 255.0) * 65535.0 + 0.5) ;
+		}
+		return table ;
+	}
+
+	// indeks = linear 16-bit >> 4, tiap entri dihitung di tengah rentangnya. 4 entri terakhir hanya cadangan supaya
+	// gather 32-bit di indeks 4095 tidak membaca di luar tabel
+	constexpr std::array<uint8_t, 4096 + 4> MakeEncodeTable() noexcept {
+		std::array<uint8_t, 4096 + 4> table {} ;
+		for (size_t i = 0 ; i < 4096 ; ++i) {
+			table[i] = static_cast<uint8_t>(LinearToSrgb((i * 16 + 8) / 65535.0) * 255.0 + 0.5) ;
+		}
+		return table ;
+	}
+
+	// channel premultiplied (c, a) -> linear premultiplied 16-bit, round(linear(round(c * 255 / a)) * a / 255).
+	// segitiga c <= a dengan indeks a * (a + 1) / 2 + c, baris a = 255 sama dengan tabel decode. satu entri cadangan
+	// untuk gather 32-bit
+	constexpr std::array<uint16_t, 256 * 257 / 2 + 1> MakePremultipliedTable(const std::array<uint16_t, 256>& decode) noexcept {
+		std::array<uint16_t, 256 * 257 / 2 + 1> table {} ;
+		size_t i = 1 ;
+		for (uint32_t a = 1 ; a < 256 ; ++a) {
+			for (uint32_t c = 0 ; c <= a ; ++c) {
+				table[i++] = static_cast<uint16_t>((decode[(c * 255 + a / 2) / a] * a + 127) / 255) ;
+			}
+		}
+		return table ;
+	}
+}
+
+namespace zz {
+
+	// channel linear 16-bit, alpha ikut dilebarkan (a * 257) tanpa kurva
+	struct LinearColor {
+		uint16_t r = 0 ;
+		uint16_t g = 0 ;
+		uint16_t b = 0 ;
+		uint16_t a = 0 ;
+
+		constexpr bool operator==(const LinearColor&) const noexcept = default ;
+	} ;
+
+	// Color dan rgba() menyimpan channel ter-encode sRGB. konversi cukup satu lookup per channel:
+	// 256 entri sRGB -> linear 16-bit dan 4096 entri linear (12 bit teratas) -> sRGB
+	class Srgb {
+	private :
+		static constexpr std::array<uint16_t, 256> g_decode_ = utility::MakeDecodeTable() ;
+		static constexpr std::array<uint8_t, 4096 + 4> g_encode_ = utility::MakeEncodeTable() ;
+		static constexpr std::array<uint16_t, 256 * 257 / 2 + 1> g_premultiplied_ = utility::MakePremultipliedTable(g_decode_) ;
+
+	public :
+		static constexpr uint16_t ToLinear(uint8_t v) noexcept { return g_decode_[v] ; }
+		static constexpr uint8_t ToSrgb(uint16_t v) noexcept { return g_encode_[v >> 4] ; }
+
+		// channel premultiplied langsung ke linear premultiplied tanpa unpremultiply. c > a (bukan premultiplied
+		// yang sah) dibatasi ke a
+		static constexpr uint16_t ToLinear(uint8_t c, uint8_t a) noexcept { return g_premultiplied_[GetPremultipliedIndex(std::min(c, a), a)] ; }
+		static constexpr uint32_t GetPremultipliedIndex(uint32_t c, uint32_t a) noexcept { return a * (a + 1) / 2 + c ; }
+
+		// tabel mentah untuk jalur gather SIMD
+		static const uint16_t* GetPremultipliedTable() noexcept { return g_premultiplied_.data() ; }
+		static const uint8_t* GetEncodeTable() noexcept { return g_encode_.data() ; }
+
+		static constexpr LinearColor ToLinear(Color c) noexcept {
+			return LinearColor{ToLinear(c.r), ToLinear(c.g), ToLinear(c.b), static_cast<uint16_t>(c.a * 257)} ;
+		}
+
+		static constexpr Color ToSrgb(const LinearColor& c) noexcept {
+			return Color(ToSrgb(c.r), ToSrgb(c.g), ToSrgb(c.b), static_cast<uint8_t>((c.a + 128) / 257)) ;
+		}
+
+		// round trip 8-bit -> linear -> 8-bit harus identitas untuk semua nilai
+		static constexpr bool IsRoundTrip() noexcept {
+			for (size_t i = 0 ; i < g_decode_.size() ; ++i) {
+				if (ToSrgb(g_decode_[i]) != i) {
+					return false ;
+				}
+			}
+			return true ;
+		}
+	} ;
+
+	static_assert(Srgb::IsRoundTrip()) ;
+	static_assert(Srgb::ToLinear(uint8_t{0}) == 0 && Srgb::ToLinear(uint8_t{255}) == 65535) ;
+	static_assert(Srgb::ToLinear(uint8_t{200}, uint8_t{255}) == Srgb::ToLinear(uint8_t{200}) && Srgb::ToLinear(uint8_t{0}, uint8_t{0}) == 0) ;
+
+	// konversi batch, hasilnya jumlah elemen yang dikonversi (yang terkecil dari dua span)
+	inline size_t ToLinear(std::span<const Color> src, std::span<LinearColor> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			dst[i] = Srgb::ToLinear(src[i]) ;
+		}
+		return count ;
+	}
+
+	inline size_t ToSrgb(std::span<const LinearColor> src, std::span<Color> dst) noexcept {
+		const size_t count = std::min(src.size(), dst.size()) ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			dst[i] = Srgb::ToSrgb(src[i]) ;
+		}
+		return count ;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "pixel.hpp"
+#include "geometry.hpp"
+
+namespace zz {
+
+	// view non-owning ke piksel Color (premultiplied) dengan stride dalam satuan piksel, seperti std::span:
+	// murah disalin dan tidak menjaga umur buffer. sub-view berbagi piksel dengan induknya
+	class SurfaceView {
+	protected :
+		Color* data_ = nullptr ;
+		int width_ = 0 ;
+		int height_ = 0 ;
+		size_t stride_ = 0 ;
+
+		// area tujuan di this dan titik awal yang sesuai di src, keduanya sudah diklip
+		struct BlitArea {
+			Rect<int> dst {} ;
+			Point<int> src {} ;
+		} ;
+
+		BlitArea clip_blit(const SurfaceView& src, const Point<int>& at) const noexcept {
+			const Rect<int> dst = Intersect(Rect<int>(at.x, at.y, src.width_, src.height_), GetBound()) ;
+			return BlitArea{dst, Point<int>{dst.GetPoint().x - at.x, dst.GetPoint().y - at.y}} ;
+		}
+
+	public :
+		SurfaceView() noexcept = default ;
+		SurfaceView(Color* data, int width, int height, size_t stride) noexcept : data_(data), width_(width), height_(height), stride_(stride) {}
+
+		int Width() const noexcept { return width_ ; }
+		int Height() const noexcept { return height_ ; }
+		size_t Stride() const noexcept { return stride_ ; }
+		bool Empty() const noexcept { return width_ <= 0 || height_ <= 0 ; }
+
+		Size<int> GetSize() const noexcept { return Size<int>(width_, height_) ; }
+		Rect<int> GetBound() const noexcept { return Rect<int>(0, 0, width_, height_) ; }
+
+		Color* Data() const noexcept { return data_ ; }
+		Color* Row(int y) const noexcept { return data_ + static_cast<size_t>(y) * stride_ ; }
+		std::span<Color> RowSpan(int y) const noexcept { return std::span<Color>(Row(y), static_cast<size_t>(width_)) ; }
+		Color& At(int x, int y) const noexcept { return Row(y)[x] ; }
+
+		// diklip ke bound, rect di luar menghasilkan view kosong
+		SurfaceView Sub(const Rect<int>& r) const noexcept {
+			const Rect<int> area = Intersect(r, GetBound()) ;
+			if (IsEmpty(area)) {
+				return SurfaceView{} ;
+			}
+			return SurfaceView(&At(area.GetPoint().x, area.GetPoint().y), static_cast<int>(area.GetSize().w), static_cast<int>(area.GetSize().h), stride_) ;
+		}
+
+		void Fill(Color color) noexcept {
+			for (int y = 0 ; y < height_ ; ++y) {
+				PixelKernel::Fill(utility::Flatten<uint32_t>(RowSpan(y)), static_cast<size_t>(width_), color) ;
+			}
+		}
+
+		void Fill(const Rect<int>& r, Color color) noexcept {
+			Sub(r).Fill(color) ;
+		}
+
+		// fill semi transparan, color premultiplied
+		void FillBlend(const Rect<int>& r, Color color, BlendMode mode = BlendMode::SourceOver) noexcept {
+			const SurfaceView area = Sub(r) ;
+			for (int y = 0 ; y < area.height_ ; ++y) {
+				PixelKernel::BlendSolid(utility::Flatten<uint32_t>(area.RowSpan(y)), color, static_cast<size_t>(area.width_), mode) ;
+			}
+		}
+
+		// salin apa adanya (termasuk alpha). memmove per baris dan urutan baris dibalik bila perlu,
+		// jadi src boleh view yang tumpang tindih dari surface yang sama
+		void Copy(const SurfaceView& src, const Point<int>& at) noexcept {
+			const BlitArea area = clip_blit(src, at) ;
+			const int w = static_cast<int>(area.dst.GetSize().w) ;
+			const int h = static_cast<int>(area.dst.GetSize().h) ;
+			if (w <= 0 || h <= 0) {
+				return ;
+			}
+
+			const bool backward = std::less<const Color*>{}(src.Row(area.src.y), Row(area.dst.GetPoint().y)) ;
+			for (int i = 0 ; i < h ; ++i) {
+				const int y = backward ? h - 1 - i : i ;
+				std::memmove(&At(area.dst.GetPoint().x, area.dst.GetPoint().y + y), &src.At(area.src.x, area.src.y + y), static_cast<size_t>(w) * sizeof(Color)) ;
+			}
+		}
+
+		// src digambar di atas this dengan blend premultiplied per baris, src dan this tidak boleh tumpang tindih
+		void Blit(const SurfaceView& src, const Point<int>& at, BlendMode mode = BlendMode::SourceOver) noexcept {
+			const BlitArea area = clip_blit(src, at) ;
+			const int w = static_cast<int>(area.dst.GetSize().w) ;
+			for (int y = 0 ; y < static_cast<int>(area.dst.GetSize().h) ; ++y) {
+				PixelKernel::Blend(
+					reinterpret_cast<uint32_t*>(&At(area.dst.GetPoint().x, area.dst.GetPoint().y + y)),
+					reinterpret_cast<const uint32_t*>(&src.At(area.src.x, area.src.y + y)),
+					static_cast<size_t>(w),
+					mode
+				) ;
+			}
+		}
+
+		// PPM biner (P6) tanpa alpha, untuk memeriksa hasil render di test tanpa display
+		bool SavePPM(const char* path) const {
+			std::ofstream file(path, std::ios::binary) ;
+			if (!file) {
+				return false ;
+			}
+
+			file << "P6\n" << width_ << ' ' << height_ << "\n255\n" ;
+			std::vector<char> line(static_cast<size_t>(std::max(width_, 0)) * 3) ;
+			for (int y = 0 ; y < height_ ; ++y) {
+				const Color* row = Row(y) ;
+				for (int x = 0 ; x < width_ ; ++x) {
+					line[x * 3 + 0] = static_cast<char>(row[x].r) ;
+					line[x * 3 + 1] = static_cast<char>(row[x].g) ;
+					line[x * 3 + 2] = static_cast<char>(row[x].b) ;
+				}
+				file.write(line.data(), static_cast<std::streamsize>(line.size())) ;
+			}
+			return static_cast<bool>(file) ;
+		}
+	} ;
+
+	// pemilik buffer piksel. tiap baris mulai di batas cache line (stride dibulatkan ke 16 piksel),
+	// jadi load/store SIMD per baris tidak pernah memotong cache line di awal baris
+	class Surface : public SurfaceView {
+	private :
+		AlignedVector<Color> pixels_ {} ;
+
+	public :
+		static constexpr size_t row_alignment = cache_line / sizeof(Color) ;
+
+		Surface() noexcept = default ;
+		Surface(const Surface&) = delete ;
+		Surface& operator=(const Surface&) = delete ;
+
+		Surface(int width, int height) {
+			Resize(width, height) ;
+		}
+
+		Surface(Surface&& o) noexcept : SurfaceView(std::exchange(static_cast<SurfaceView&>(o), SurfaceView{})), pixels_(std::move(o.pixels_)) {}
+
+		Surface& operator=(Surface&& o) noexcept {
+			if (this != &o) {
+				pixels_ = std::move(o.pixels_) ;
+				static_cast<SurfaceView&>(*this) = std::exchange(static_cast<SurfaceView&>(o), SurfaceView{}) ;
+			}
+			return *this ;
+		}
+
+		// isi lama tidak dipertahankan, semua piksel menjadi transparan. ukuran yang sama tidak mengubah apa-apa
+		void Resize(int width, int height) {
+			width = std::max(width, 0) ;
+			height = std::max(height, 0) ;
+			if (width == width_ && height == height_ && data_) {
+				return ;
+			}
+			const size_t stride = (static_cast<size_t>(width) + row_alignment - 1) / row_alignment * row_alignment ;
+
+			pixels_.assign(stride * static_cast<size_t>(height), Color{}) ;
+			static_cast<SurfaceView&>(*this) = SurfaceView(pixels_.data(), width, height, stride) ;
+		}
+
+		SurfaceView GetView() const noexcept { return *this ; }
+	} ;
+}
\ No newline at end of file
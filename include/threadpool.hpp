@@ -0,0 +1,113 @@
+#pragma once
+
+#include "aligned.hpp"
+
+namespace zz {
+
+	// worker tetap untuk pekerjaan paralel-for yang pendek (satu frame). Run memblok sampai semua index selesai,
+	// thread pemanggil ikut mengerjakan jadi pool dengan 0 worker tetap jalan (serial).
+	// index dibagikan lewat satu counter atomic, urutan eksekusi tidak tentu jadi hasil tiap index harus independen
+	class ThreadPool {
+	private :
+		std::vector<std::thread> threads_ {} ;
+		std::mutex mutex_ {} ;
+		std::condition_variable start_cv_ {} ;
+		std::condition_variable done_cv_ {} ;
+
+		void (*invoke_)(void*, size_t) noexcept = nullptr ;
+		void* context_ = nullptr ;
+		size_t count_ = 0 ;
+		size_t generation_ = 0 ;
+		size_t active_ = 0 ;
+		bool stop_ = false ;
+
+		alignas(cache_line) std::atomic<size_t> next_ {0} ;
+
+		void work(void (*invoke)(void*, size_t) noexcept, void* context, size_t count) noexcept {
+			for (size_t i = next_.fetch_add(1, std::memory_order_relaxed) ; i < count ; i = next_.fetch_add(1, std::memory_order_relaxed)) {
+				invoke(context, i) ;
+			}
+		}
+
+		void worker_loop() noexcept {
+			size_t seen = 0 ;
+			while (true) {
+				std::unique_lock lock(mutex_) ;
+				start_cv_.wait(lock, [this, seen] { return stop_ || generation_ != seen ; }) ;
+				if (stop_) {
+					return ;
+				}
+
+				seen = generation_ ;
+				const auto invoke = invoke_ ;
+				void* const context = context_ ;
+				const size_t count = count_ ;
+				lock.unlock() ;
+
+				work(invoke, context, count) ;
+
+				lock.lock() ;
+				if (--active_ == 0) {
+					done_cv_.notify_one() ;
+				}
+			}
+		}
+
+	public :
+		// default satu worker lebih sedikit dari jumlah core, karena thread pemanggil ikut bekerja
+		explicit ThreadPool(size_t worker_count = std::max(std::thread::hardware_concurrency(), 1u) - 1) {
+			threads_.reserve(worker_count) ;
+			for (size_t i = 0 ; i < worker_count ; ++i) {
+				threads_.emplace_back([this] { worker_loop() ; }) ;
+			}
+		}
+
+		ThreadPool(const ThreadPool&) = delete ;
+		ThreadPool& operator=(const ThreadPool&) = delete ;
+
+		~ThreadPool() noexcept {
+			{
+				std::lock_guard lock(mutex_) ;
+				stop_ = true ;
+			}
+			start_cv_.notify_all() ;
+			for (std::thread& thread : threads_) {
+				thread.join() ;
+			}
+		}
+
+		// jumlah thread yang bekerja saat Run, termasuk pemanggil
+		size_t GetThreadCount() const noexcept { return threads_.size() + 1 ; }
+
+		// fn(index) untuk index 0..count-1. fn tidak boleh melempar exception dan tidak boleh memanggil Run lagi
+		template <typename fn>
+		requires std::is_nothrow_invocable_v<fn&, size_t>
+		void Run(size_t count, fn&& job) noexcept {
+			const auto invoke = [](void* context, size_t i) noexcept { (*static_cast<std::remove_reference_t<fn>*>(context))(i) ; } ;
+			void* const context = const_cast<void*>(static_cast<const void*>(std::addressof(job))) ;
+
+			if (threads_.empty() || count <= 1) {
+				for (size_t i = 0 ; i < count ; ++i) {
+					invoke(context, i) ;
+				}
+				return ;
+			}
+
+			{
+				std::lock_guard lock(mutex_) ;
+				invoke_ = invoke ;
+				context_ = context ;
+				count_ = count ;
+				active_ = threads_.size() ;
+				next_.store(0, std::memory_order_relaxed) ;
+				++generation_ ;
+			}
+			start_cv_.notify_all() ;
+
+			work(invoke, context, count) ;
+
+			std::unique_lock lock(mutex_) ;
+			done_cv_.wait(lock, [this] { return active_ == 0 ; }) ;
+		}
+	} ;
+}
\ No newline at end of file
@@ -1,11 +1,18 @@
-#pragma once
-
-#include "conceptual.hpp"
-
-namespace zz {
-
-	template <Arithmetic Type> class Point ;
-	template <Arithmetic Type> class Size ;
-	class Event ;
-	class Window ;
+#pragma once
+
+#include "conceptual.hpp"
+
+namespace zz {
+
+	template <Arithmetic Type> class Point ;
+	template <Arithmetic Type> class Size ;
+	class Event ;
+	class Window ;
+
+	// handle window native milik backend, HWND di Win32 dan pointer opaque di backend lain
+	#ifdef _WIN32
+		using WindowHandle = HWND ;
+	#else
+		using WindowHandle = struct NativeWindow* ;
+	#endif
 }
\ No newline at end of file
@@ -0,0 +1,267 @@
+#pragma once
+
+#include "clock.hpp"
+#include "widget.hpp"
+
+namespace zz {
+
+	// isi satu sel, text sudah dikosongkan sebelum dipanggil dan boleh diisi ulang tanpa alokasi baru
+	using RowProvider = std::function<void(uint64_t row, uint32_t column, std::string& text)> ;
+
+	struct VirtualListStyle {
+		float row_height = 20.0f ;
+		float cell_padding = 2.0f ;
+		float wheel_rows = 3.0f ;		// baris per notch wheel
+		uint32_t font = 0 ;
+		Color text_color {} ;
+		Color row_background {} ;
+		bool interactive = false ;		// baris menerima WidgetEvent, GetRow mengubah handle jadi nomor baris
+	} ;
+
+	// list/tabel dengan jumlah baris besar di atas WidgetTree. hanya baris yang memotong client area window yang
+	// punya widget, widget baris dipakai ulang saat scroll (baris yang keluar pindah ke sisi lain dan diisi ulang
+	// lewat RowProvider), jadi memori dan biaya per frame bergantung pada tinggi window, bukan jumlah baris.
+	// tinggi baris tetap, posisi scroll langsung menentukan baris pertama. view butuh tinggi dari style (height
+	// atau grow), bukan dari isi
+	class VirtualList {
+	public :
+		static constexpr double scroll_rate = 18.0 ;		// per detik, makin besar makin cepat mengejar target
+
+	private :
+		static constexpr uint64_t no_row = std::numeric_limits<uint64_t>::max() ;
+
+		struct Row {
+			SlotHandle node {} ;
+			std::vector<SlotHandle> cells {} ;
+			uint64_t index = no_row ;
+		} ;
+
+		WidgetTree* tree_ = nullptr ;
+		SlotHandle view_ {} ;
+		VirtualListStyle style_ {} ;
+		std::vector<float> columns_ {} ;
+		RowProvider provider_ {} ;
+		uint64_t count_ = 0 ;
+
+		std::vector<Row> rows_ {} ;		// urutan sama dengan urutan anak view
+		uint64_t first_ = no_row ;
+		std::string scratch_ {} ;
+
+		double offset_ = 0.0 ;		// double, float sudah tidak presisi per pixel di atas ~16 juta pixel
+		double target_ = 0.0 ;
+		double shown_ = 0.0 ;		// offset saat Tick terakhir
+		uint64_t last_tick_ = 0 ;
+		Point<float> pointer_ {} ;
+
+		double max_offset() const noexcept {
+			const WidgetStyle* view = tree_->GetStyle(view_) ;
+			const float height = tree_->GetBound(view_).GetSize().h - (view ? view->padding * 2.0f : 0.0f) ;
+			return std::max(static_cast<double>(count_) * style_.row_height - std::max(height, 0.0f), 0.0) ;
+		}
+
+		Row create_row() {
+			Row row {} ;
+			row.node = tree_->Create(view_, WidgetStyle{.layout = WidgetLayout::Row, .height = style_.row_height, .background = style_.row_background, .interactive = style_.interactive}) ;
+			row.cells.reserve(columns_.size()) ;
+			for (float width : columns_) {
+				row.cells.push_back(tree_->CreateLabel(row.node, {}, style_.text_color, style_.font, WidgetStyle{
+					.width = width,
+					.height = style_.row_height,
+					.padding = style_.cell_padding,
+					.grow = width < 0.0f ? 1.0f : 0.0f,
+					.clip = true
+				})) ;
+			}
+			return row ;
+		}
+
+		void bind(Row& row, uint64_t index) {
+			for (uint32_t column = 0 ; column < row.cells.size() ; ++column) {
+				scratch_.clear() ;
+				if (provider_) {
+					provider_(index, column, scratch_) ;
+				}
+				tree_->SetText(row.cells[column], scratch_) ;
+			}
+			row.index = index ;
+		}
+
+		// baris yang masih terlihat tetap di widget-nya, sisanya dipindah ke ujung lain supaya hanya baris baru
+		// yang diisi ulang
+		void recycle(uint64_t first) noexcept {
+			const size_t n = rows_.size() ;
+			if (n == 0 || first_ == no_row || first == first_) {
+				return ;
+			}
+
+			if (first > first_ && first - first_ < n) {
+				const size_t shift = static_cast<size_t>(first - first_) ;
+				for (size_t i = 0 ; i < shift ; ++i) {
+					tree_->Move(rows_[i].node) ;
+				}
+				std::rotate(rows_.begin(), rows_.begin() + shift, rows_.end()) ;
+			} else if (first < first_ && first_ - first < n) {
+				const size_t shift = static_cast<size_t>(first_ - first) ;
+				SlotHandle front = rows_.front().node ;
+				for (size_t i = n ; i-- > n - shift ; ) {
+					tree_->Move(rows_[i].node, front) ;
+					front = rows_[i].node ;
+				}
+				std::rotate(rows_.begin(), rows_.end() - shift, rows_.end()) ;
+			}
+		}
+
+	public :
+		// columns berisi lebar tiap kolom, negatif berarti berbagi sisa lebar. view dibuat sebagai anak parent
+		VirtualList(WidgetTree& tree, SlotHandle parent, const WidgetStyle& view, const VirtualListStyle& style, std::vector<float> columns, RowProvider provider, uint64_t count = 0) :
+			tree_(&tree), style_(style), columns_(std::move(columns)), provider_(std::move(provider)), count_(count) {
+			WidgetStyle view_style = view ;
+			view_style.layout = WidgetLayout::Column ;
+			view_style.gap = 0.0f ;
+			view_style.clip = true ;
+			view_ = tree_->Create(parent, view_style) ;
+		}
+
+		VirtualList(const VirtualList&) = delete ;
+		VirtualList& operator=(const VirtualList&) = delete ;
+
+		// WidgetTree harus hidup lebih lama dari list
+		~VirtualList() noexcept {
+			tree_->Remove(view_) ;
+		}
+
+		SlotHandle GetView() const noexcept { return view_ ; }
+		uint64_t GetCount() const noexcept { return count_ ; }
+		uint64_t GetFirstRow() const noexcept { return first_ == no_row ? 0 : first_ ; }
+		size_t GetPoolSize() const noexcept { return rows_.size() ; }
+		double GetOffset() const noexcept { return offset_ ; }
+		bool IsAnimating() const noexcept { return offset_ != target_ ; }
+
+		// data berubah panjang, baris yang terlihat diisi ulang pada Update berikutnya
+		void SetCount(uint64_t count) noexcept {
+			count_ = count ;
+			Refresh() ;
+		}
+
+		// isi baris berubah tanpa jumlahnya berubah
+		void Refresh() noexcept {
+			for (Row& row : rows_) {
+				row.index = no_row ;
+			}
+		}
+
+		// nomor baris yang sedang ditampilkan widget h (baris atau salah satu selnya)
+		std::optional<uint64_t> GetRow(SlotHandle h) const noexcept {
+			for (const Row& row : rows_) {
+				if (row.index != no_row && (row.node == h || std::find(row.cells.begin(), row.cells.end(), h) != row.cells.end())) {
+					return row.index ;
+				}
+			}
+			return std::nullopt ;
+		}
+
+		// animated false langsung lompat, dipakai juga untuk scrollbar / keyboard
+		void ScrollTo(double offset, bool animated = true) noexcept {
+			target_ = std::clamp(offset, 0.0, max_offset()) ;
+			if (!animated) {
+				offset_ = target_ ;
+			} else if (last_tick_ == 0) {
+				last_tick_ = Now() ;
+			}
+		}
+
+		void ScrollBy(double delta, bool animated = true) noexcept {
+			ScrollTo(target_ + delta, animated) ;
+		}
+
+		void ScrollToRow(uint64_t row, bool animated = true) noexcept {
+			ScrollTo(static_cast<double>(row) * style_.row_height, animated) ;
+		}
+
+		// wheel hanya menggulung kalau pointer terakhir ada di atas view, event wheel tidak membawa posisi
+		bool HandleMouse(const MouseEvent& e) noexcept {
+			if (e.GetState() != MouseState::Wheel) {
+				pointer_ = e.GetPosition() ;
+				return false ;
+			}
+			if (!zz::Contains(tree_->GetBound(view_), pointer_)) {
+				return false ;
+			}
+			ScrollBy(-e.GetDelta().y * style_.wheel_rows * style_.row_height) ;
+			return true ;
+		}
+
+		// maju menuju target secara eksponensial, true kalau offset berubah (perlu Update, Layout dan digambar ulang).
+		// ScrollTo tanpa animasi juga dilaporkan di sini, IsAnimating menandai apakah frame berikutnya masih perlu Tick
+		bool Tick(uint64_t now = Now()) noexcept {
+			if (!IsAnimating()) {
+				last_tick_ = 0 ;
+				const bool moved = offset_ != shown_ ;
+				shown_ = offset_ ;
+				return moved ;
+			}
+
+			const double dt = last_tick_ != 0 && now > last_tick_ ? std::min(static_cast<double>(now - last_tick_) * 1e-9, 0.1) : 0.0 ;
+			last_tick_ = now ;
+			offset_ += (target_ - offset_) * (1.0 - std::exp(-scroll_rate * dt)) ;
+			if (std::abs(target_ - offset_) < 0.5) {
+				offset_ = target_ ;
+				last_tick_ = 0 ;
+			}
+			const bool moved = offset_ != shown_ ;
+			shown_ = offset_ ;
+			return moved ;
+		}
+
+		// sesuaikan widget baris dengan offset sekarang, dipanggil sebelum WidgetTree::Layout dengan
+		// Window::GetClientBound. bound view diambil dari Layout sebelumnya, jadi panggil sekali lagi setelah Layout:
+		// true berarti view berubah ukuran (mis. resize) dan Layout perlu diulang
+		bool Update(const Rect<int>& client) {
+			const double max = max_offset() ;
+			target_ = std::min(target_, max) ;
+			offset_ = std::min(offset_, max) ;
+
+			const Rect<float> view = tree_->GetBound(view_) ;
+			const float client_top = static_cast<float>(client.GetPoint().y) ;
+			const float client_bottom = client_top + static_cast<float>(client.GetSize().h) ;
+			const float top = std::max(view.GetPoint().y, client_top) ;
+			float bottom = client_bottom ;
+			if (view.GetSize().h > 0.0f) {
+				bottom = std::min(bottom, view.GetPoint().y + view.GetSize().h) ;
+			}
+			const float span = std::max(bottom - top, 0.0f) ;
+
+			// jumlah widget hanya bergantung pada span, bukan offset. di ujung data baris pertama ditarik mundur
+			// (terpotong di atas) supaya pool tidak mengecil dan membesar saat scroll
+			const size_t needed = static_cast<size_t>(std::min<uint64_t>(count_, static_cast<uint64_t>(std::ceil(span / style_.row_height)) + 1)) ;
+			const uint64_t first = std::min(static_cast<uint64_t>(offset_ / style_.row_height), count_ - needed) ;
+			const float fraction = static_cast<float>(offset_ - static_cast<double>(first) * style_.row_height) ;
+
+			bool changed = false ;
+			recycle(first) ;
+			while (rows_.size() > needed) {
+				tree_->Remove(rows_.back().node) ;
+				rows_.pop_back() ;
+				changed = true ;
+			}
+			while (rows_.size() < needed) {
+				rows_.push_back(create_row()) ;
+			}
+			first_ = first ;
+
+			for (size_t k = 0 ; k < rows_.size() ; ++k) {
+				if (rows_[k].index != first + k) {
+					bind(rows_[k], first + k) ;
+					changed = true ;
+				}
+			}
+
+			const Point<float> scroll(0.0f, fraction) ;
+			if (tree_->GetScroll(view_) != scroll) {
+				tree_->SetScroll(view_, scroll) ;
+				changed = true ;
+			}
+			return changed ;
+		}
+	} ;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "enum.hpp"
+
+namespace zz {
+
+	enum class WaitResult : uint8_t {
+		Timeout,
+		Notified,	// Notify() dari thread lain
+		Input		// ada message OS yang masuk (hanya backend Win32)
+	} ;
+
+	// backend portable, dipakai juga untuk test di Linux
+	class CondWaiter {
+	private :
+		std::mutex mutex_ {} ;
+		std::condition_variable cv_ {} ;
+		bool signaled_ = false ;
+
+	public :
+		static constexpr uint32_t Infinite = 0xFFFFFFFF ;
+
+		CondWaiter() noexcept = default ;
+		CondWaiter(const CondWaiter&) = delete ;
+		CondWaiter& operator=(const CondWaiter&) = delete ;
+
+		WaitResult Wait(uint32_t timeout_ms = Infinite) noexcept {
+			std::unique_lock lock(mutex_) ;
+			if (timeout_ms == Infinite) {
+				cv_.wait(lock, [this] { return signaled_ ; }) ;
+			} else if (!cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this] { return signaled_ ; })) {
+				return WaitResult::Timeout ;
+			}
+
+			signaled_ = false ;
+			return WaitResult::Notified ;
+		}
+
+		// aman dipanggil dari thread manapun, beberapa Notify sebelum Wait digabung jadi satu
+		void Notify() noexcept {
+			{
+				std::lock_guard lock(mutex_) ;
+				signaled_ = true ;
+			}
+			cv_.notify_one() ;
+		}
+	} ;
+
+	#ifdef _WIN32
+		// menunggu event handle sekaligus message queue thread UI
+		class Win32Waiter {
+		private :
+			HANDLE event_ = CreateEvent(nullptr, FALSE, FALSE, nullptr) ;
+
+		public :
+			static constexpr uint32_t Infinite = INFINITE ;
+
+			Win32Waiter() noexcept = default ;
+			Win32Waiter(const Win32Waiter&) = delete ;
+			Win32Waiter& operator=(const Win32Waiter&) = delete ;
+
+			~Win32Waiter() noexcept {
+				if (event_) {
+					CloseHandle(event_) ;
+				}
+			}
+
+			WaitResult Wait(uint32_t timeout_ms = Infinite) noexcept {
+				switch (MsgWaitForMultipleObjectsEx(1, &event_, timeout_ms, QS_ALLINPUT, MWMO_INPUTAVAILABLE)) {
+					case WAIT_OBJECT_0 :
+						return WaitResult::Notified ;
+					case WAIT_OBJECT_0 + 1 :
+						return WaitResult::Input ;
+				}
+
+				return WaitResult::Timeout ;
+			}
+
+			void Notify() noexcept {
+				SetEvent(event_) ;
+			}
+		} ;
+
+		using Waiter = Win32Waiter ;
+	#else
+		using Waiter = CondWaiter ;
+	#endif
+}
\ No newline at end of file
@@ -0,0 +1,614 @@
+#pragma once
+
+#include "displaylist.hpp"
+#include "eventsystem.hpp"
+#include "slotmap.hpp"
+#include "spatial.hpp"
+
+namespace zz {
+
+	// ukuran negatif berarti diambil dari isi (text atau anak). grow membagi sisa ruang sumbu utama parent Row/Column
+	struct WidgetStyle {
+		WidgetLayout layout = WidgetLayout::Column ;
+		WidgetAlign align = WidgetAlign::Stretch ;	// posisi anak di sumbu silang
+		float width = -1.0f ;
+		float height = -1.0f ;
+		float padding = 0.0f ;
+		float gap = 0.0f ;							// jarak antar anak di sumbu utama
+		float grow = 0.0f ;
+		float radius = 0.0f ;
+		Color background {} ;
+		bool interactive = false ;					// hanya widget interaktif yang kena hit test dan menerima WidgetEvent
+		bool clip = false ;							// anak tidak digambar di luar bound widget ini
+	} ;
+
+	// jumlah node yang benar-benar diukur / disusun ulang oleh Layout terakhir
+	struct LayoutStats {
+		size_t measured = 0 ;
+		size_t arranged = 0 ;
+	} ;
+
+	// pohon widget satu window. ukuran hasil measure di-cache per node dan hanya dihitung ulang kalau node ditandai
+	// WidgetDirty::Measure, tanda itu naik ke semua ancestor. bound disimpan relatif ke parent, jadi anak yang hanya
+	// bergeser tidak perlu disusun ulang dan subtree yang ukurannya tetap dilewati. mengubah satu label menyentuh
+	// node di jalur ke root dan saudara langsungnya saja, O(depth x fanout) bukan O(n)
+	class WidgetTree {
+	private :
+		struct Node {
+			SlotHandle parent {} ;
+			SlotHandle first_child {} ;
+			SlotHandle last_child {} ;
+			SlotHandle prev {} ;
+			SlotHandle next {} ;
+			WidgetStyle style {} ;
+			std::string text {} ;
+			Color text_color {} ;
+			uint32_t font = 0 ;
+			WidgetDirty dirty = WidgetDirty::Measure | WidgetDirty::Layout ;
+			Size<float> measured {} ;
+			Rect<float> bound {} ;		// relatif ke pojok kiri atas parent
+			Point<float> scroll {} ;	// geser semua anak ke kiri/atas, tidak mengubah ukuran
+		} ;
+
+		SlotMap<Node> nodes_ {} ;
+		SlotHandle root_ {} ;
+		WindowHandle window_ = nullptr ;
+		TextRenderer* text_ = nullptr ;
+		Size<float> viewport_ {} ;
+		SlotHandle hover_ {} ;
+		SlotHandle pressed_ {} ;
+		LayoutStats stats_ {} ;
+		SpatialIndex* index_ = nullptr ;
+		std::vector<uint32_t> candidates_ {} ;
+		std::vector<SlotHandle> chain_ {} ;
+		std::vector<SlotHandle> other_chain_ {} ;
+
+		static bool has(WidgetDirty flags, WidgetDirty flag) noexcept {
+			return static_cast<bool>(flags & flag) ;
+		}
+
+		// ancestor yang sudah Measure pasti sudah menandai semua ancestor-nya, jadi naik berhenti di sana
+		void mark_measure(SlotHandle h) noexcept {
+			for (Node* node = nodes_.Get(h) ; node && !has(node->dirty, WidgetDirty::Measure) ; node = nodes_.Get(node->parent)) {
+				node->dirty |= WidgetDirty::Measure | WidgetDirty::Layout ;
+			}
+		}
+
+		// posisi anak berubah tanpa ukuran berubah, measure tidak perlu diulang
+		void mark_layout(SlotHandle h) noexcept {
+			for (Node* node = nodes_.Get(h) ; node ; node = nodes_.Get(node->parent)) {
+				node->dirty |= WidgetDirty::Layout ;
+			}
+		}
+
+		// bound node berubah di luar arrange (mis. interactive berubah), seluruh jalur ke root ikut disinkron
+		void mark_moved(SlotHandle h) noexcept {
+			Node* node = nodes_.Get(h) ;
+			if (!node) {
+				return ;
+			}
+			node->dirty |= WidgetDirty::Moved ;
+			for (Node* parent = nodes_.Get(node->parent) ; parent ; parent = nodes_.Get(parent->parent)) {
+				parent->dirty |= WidgetDirty::Subtree ;
+			}
+		}
+
+		void emit(WidgetState state, SlotHandle widget) noexcept {
+			EventSys::PushEvent(Event(window_, WidgetEvent(state, widget))) ;
+		}
+
+		Size<float> measure(Node& node) {
+			if (!has(node.dirty, WidgetDirty::Measure)) {
+				return node.measured ;
+			}
+			++stats_.measured ;
+
+			const bool row = node.style.layout == WidgetLayout::Row ;
+			const bool stack = node.style.layout == WidgetLayout::Stack ;
+			float main = 0.0f ;
+			float cross = 0.0f ;
+			size_t count = 0 ;
+			for (Node* child = nodes_.Get(node.first_child) ; child ; child = nodes_.Get(child->next)) {
+				const Size<float> size = measure(*child) ;
+				const float child_main = row ? size.w : size.h ;
+				const float child_cross = row ? size.h : size.w ;
+				main = stack ? std::max(main, child_main) : main + child_main ;
+				cross = std::max(cross, child_cross) ;
+				++count ;
+			}
+			if (!stack && count > 1) {
+				main += node.style.gap * static_cast<float>(count - 1) ;
+			}
+
+			Size<float> content = row ? Size<float>(main, cross) : Size<float>(cross, main) ;
+			if (!node.text.empty() && text_) {
+				const Size<int> text = text_->MeasureText(node.text, node.font) ;
+				content.w = std::max(content.w, static_cast<float>(text.w)) ;
+				content.h = std::max(content.h, static_cast<float>(text.h)) ;
+			}
+
+			const float padding = node.style.padding * 2.0f ;
+			node.measured = Size<float>(
+				node.style.width >= 0.0f ? node.style.width : content.w + padding,
+				node.style.height >= 0.0f ? node.style.height : content.h + padding
+			) ;
+			node.dirty = node.dirty & ~WidgetDirty::Measure ;
+			return node.measured ;
+		}
+
+		// ukuran dan offset anak di sumbu silang, style.width/height anak tidak ditimpa Stretch
+		static std::pair<float, float> cross_place(WidgetAlign align, float available, float measured, bool fixed) noexcept {
+			const float size = align == WidgetAlign::Stretch && !fixed ? available : measured ;
+			switch (align) {
+				case WidgetAlign::Center : return {size, (available - size) * 0.5f} ;
+				case WidgetAlign::End : return {size, available - size} ;
+				default : return {size, 0.0f} ;
+			}
+		}
+
+		static void mark_subtree(Node& parent, const Node& child) noexcept {
+			if (has(child.dirty, WidgetDirty::Moved | WidgetDirty::Subtree)) {
+				parent.dirty |= WidgetDirty::Subtree ;
+			}
+		}
+
+		void arrange(Node& node, const Rect<float>& rect) {
+			const bool resized = node.bound.GetSize() != rect.GetSize() ;
+			if (node.bound != rect) {
+				node.dirty |= WidgetDirty::Moved ;
+			}
+			node.bound = rect ;
+			if (!resized && !has(node.dirty, WidgetDirty::Layout)) {
+				return ;
+			}
+			++stats_.arranged ;
+			node.dirty = node.dirty & ~WidgetDirty::Layout ;
+
+			const WidgetStyle& style = node.style ;
+			const float padding = style.padding ;
+			const float left = padding - node.scroll.x ;
+			const float top = padding - node.scroll.y ;
+			const float content_w = std::max(rect.GetSize().w - padding * 2.0f, 0.0f) ;
+			const float content_h = std::max(rect.GetSize().h - padding * 2.0f, 0.0f) ;
+
+			if (style.layout == WidgetLayout::Stack) {
+				for (Node* child = nodes_.Get(node.first_child) ; child ; child = nodes_.Get(child->next)) {
+					const auto [w, x] = cross_place(style.align, content_w, child->measured.w, child->style.width >= 0.0f) ;
+					const auto [h, y] = cross_place(style.align, content_h, child->measured.h, child->style.height >= 0.0f) ;
+					arrange(*child, Rect<float>(left + x, top + y, w, h)) ;
+					mark_subtree(node, *child) ;
+				}
+				return ;
+			}
+
+			const bool row = style.layout == WidgetLayout::Row ;
+			const float available_main = row ? content_w : content_h ;
+			const float available_cross = row ? content_h : content_w ;
+
+			float used = 0.0f ;
+			float grow = 0.0f ;
+			size_t count = 0 ;
+			for (const Node* child = nodes_.Get(node.first_child) ; child ; child = nodes_.Get(child->next)) {
+				used += row ? child->measured.w : child->measured.h ;
+				grow += std::max(child->style.grow, 0.0f) ;
+				++count ;
+			}
+			if (count > 1) {
+				used += style.gap * static_cast<float>(count - 1) ;
+			}
+
+			// tidak ada shrink, anak yang tidak muat keluar dari content area
+			const float free = std::max(available_main - used, 0.0f) ;
+			float pen = row ? left : top ;
+			for (Node* child = nodes_.Get(node.first_child) ; child ; child = nodes_.Get(child->next)) {
+				float main = row ? child->measured.w : child->measured.h ;
+				if (grow > 0.0f) {
+					main += free * std::max(child->style.grow, 0.0f) / grow ;
+				}
+
+				const bool fixed = row ? child->style.height >= 0.0f : child->style.width >= 0.0f ;
+				const auto [cross, offset] = cross_place(style.align, available_cross, row ? child->measured.h : child->measured.w, fixed) ;
+				arrange(*child, row ? Rect<float>(pen, top + offset, main, cross) : Rect<float>(left + offset, pen, cross, main)) ;
+				mark_subtree(node, *child) ;
+				pen += main + style.gap ;
+			}
+		}
+
+		// hanya menelusuri cabang yang Moved/Subtree. node yang bergeser memindahkan seluruh subtree-nya di index,
+		// karena bound disimpan relatif ke parent
+		void sync(SlotHandle h, Node& node, Point<float> origin, bool moved) {
+			moved = moved || has(node.dirty, WidgetDirty::Moved) ;
+			if (!moved && !has(node.dirty, WidgetDirty::Subtree)) {
+				return ;
+			}
+			node.dirty = node.dirty & ~(WidgetDirty::Moved | WidgetDirty::Subtree) ;
+
+			origin = Point<float>(origin.x + node.bound.GetPoint().x, origin.y + node.bound.GetPoint().y) ;
+			if (moved) {
+				if (node.style.interactive) {
+					index_->Insert(h.index, Rect<float>(origin, node.bound.GetSize())) ;
+				} else {
+					index_->Erase(h.index) ;
+				}
+			}
+			for (SlotHandle child = node.first_child ; child.IsValid() ; ) {
+				Node& next = *nodes_.Get(child) ;
+				sync(child, next, origin, moved) ;
+				child = next.next ;
+			}
+		}
+
+		// root dulu sampai h
+		void chain_of(SlotHandle h, std::vector<SlotHandle>& chain) const {
+			chain.clear() ;
+			for (const Node* node = nodes_.Get(h) ; node ; node = nodes_.Get(node->parent)) {
+				chain.push_back(h) ;
+				h = node->parent ;
+			}
+			std::reverse(chain.begin(), chain.end()) ;
+		}
+
+		// sama dengan syarat hit_test: p harus ada di bound h dan semua ancestor-nya
+		bool reachable(SlotHandle h, Point<float> p) {
+			chain_of(h, chain_) ;
+			for (SlotHandle link : chain_) {
+				const Rect<float>& bound = nodes_.Get(link)->bound ;
+				if (!zz::Contains(bound, p)) {
+					return false ;
+				}
+				p = Point<float>(p.x - bound.GetPoint().x, p.y - bound.GetPoint().y) ;
+			}
+			return true ;
+		}
+
+		// a digambar setelah b (urutan preorder): turunan setelah ancestor, saudara belakang setelah saudara depan
+		bool paints_after(SlotHandle a, SlotHandle b) {
+			chain_of(a, chain_) ;
+			chain_of(b, other_chain_) ;
+			size_t k = 0 ;
+			while (k < chain_.size() && k < other_chain_.size() && chain_[k] == other_chain_[k]) {
+				++k ;
+			}
+			if (k == chain_.size() || k == other_chain_.size()) {
+				return chain_.size() > other_chain_.size() ;
+			}
+			for (SlotHandle sibling = other_chain_[k] ; sibling.IsValid() ; sibling = nodes_.Get(sibling)->next) {
+				if (sibling == chain_[k]) {
+					return true ;
+				}
+			}
+			return false ;
+		}
+
+		static Rect<int> to_pixel(const Rect<float>& r) noexcept {
+			const int x0 = static_cast<int>(std::lround(r.GetPoint().x)) ;
+			const int y0 = static_cast<int>(std::lround(r.GetPoint().y)) ;
+			const int x1 = static_cast<int>(std::lround(r.GetPoint().x + r.GetSize().w)) ;
+			const int y1 = static_cast<int>(std::lround(r.GetPoint().y + r.GetSize().h)) ;
+			return Rect<int>(x0, y0, std::max(x1 - x0, 0), std::max(y1 - y0, 0)) ;
+		}
+
+		void record(DisplayList& list, const Node& node, Point<float> origin) const {
+			origin = Point<float>(origin.x + node.bound.GetPoint().x, origin.y + node.bound.GetPoint().y) ;
+			const Rect<float> bound(origin, node.bound.GetSize()) ;
+			if (node.style.background.a != 0) {
+				if (node.style.radius > 0.0f) {
+					list.FillRoundedRect(bound, node.style.radius, node.style.background) ;
+				} else {
+					list.FillRect(to_pixel(bound), node.style.background) ;
+				}
+			}
+
+			if (!node.text.empty()) {
+				const float padding = node.style.padding ;
+				list.DrawText(to_pixel(Rect<float>(origin.x + padding, origin.y + padding, std::max(bound.GetSize().w - padding * 2.0f, 0.0f), std::max(bound.GetSize().h - padding * 2.0f, 0.0f))), node.text, node.text_color, node.font) ;
+			}
+
+			if (node.style.clip) {
+				list.PushClip(to_pixel(bound)) ;
+			}
+			for (const Node* child = nodes_.Get(node.first_child) ; child ; child = nodes_.Get(child->next)) {
+				record(list, *child, origin) ;
+			}
+			if (node.style.clip) {
+				list.PopClip() ;
+			}
+		}
+
+		// anak terakhir digambar paling atas, jadi dicek lebih dulu. subtree di luar bound parent-nya tidak kena hit
+		SlotHandle hit_test(SlotHandle h, const Point<float>& p) const noexcept {
+			const Node* node = nodes_.Get(h) ;
+			if (!node || !zz::Contains(node->bound, p)) {
+				return SlotHandle{} ;
+			}
+
+			const Point<float> local(p.x - node->bound.GetPoint().x, p.y - node->bound.GetPoint().y) ;
+			for (SlotHandle child = node->last_child ; child.IsValid() ; child = nodes_.Get(child)->prev) {
+				if (const SlotHandle hit = hit_test(child, local) ; hit.IsValid()) {
+					return hit ;
+				}
+			}
+			return node->style.interactive ? h : SlotHandle{} ;
+		}
+
+		void unlink(Node& node) noexcept {
+			Node* parent = nodes_.Get(node.parent) ;
+			if (Node* prev = nodes_.Get(node.prev)) {
+				prev->next = node.next ;
+			} else if (parent) {
+				parent->first_child = node.next ;
+			}
+			if (Node* next = nodes_.Get(node.next)) {
+				next->prev = node.prev ;
+			} else if (parent) {
+				parent->last_child = node.prev ;
+			}
+			node.prev = node.next = node.parent = SlotHandle{} ;
+		}
+
+		void erase(SlotHandle h) noexcept {
+			const Node* node = nodes_.Get(h) ;
+			if (!node) {
+				return ;
+			}
+			for (SlotHandle child = node->first_child ; child.IsValid() ; ) {
+				const SlotHandle next = nodes_.Get(child)->next ;
+				erase(child) ;
+				child = next ;
+			}
+			if (index_) {
+				index_->Erase(h.index) ;
+			}
+			nodes_.Erase(h) ;
+		}
+
+	public :
+		WidgetTree() {
+			root_ = nodes_.Insert(Node{}) ;
+		}
+
+		// handle window tujuan WidgetEvent, diisi Window saat dibuat
+		void SetWindow(WindowHandle window) noexcept { window_ = window ; }
+
+		// dipakai untuk mengukur label, tanpa renderer text dianggap berukuran 0
+		void SetTextRenderer(TextRenderer* text) noexcept {
+			if (text_ != text) {
+				text_ = text ;
+				MarkAll() ;
+			}
+		}
+
+		SlotHandle GetRoot() const noexcept { return root_ ; }
+		size_t GetCount() const noexcept { return nodes_.Size() ; }
+		bool Contains(SlotHandle h) const noexcept { return nodes_.Contains(h) ; }
+
+		// widget baru jadi anak terakhir parent, handle invalid kalau parent sudah tidak ada
+		SlotHandle Create(SlotHandle parent, const WidgetStyle& style = {}) {
+			if (!nodes_.Contains(parent)) {
+				return SlotHandle{} ;
+			}
+
+			const SlotHandle h = nodes_.Insert(Node{.parent = parent, .style = style}) ;
+			Node& owner = *nodes_.Get(parent) ;
+			if (Node* last = nodes_.Get(owner.last_child)) {
+				last->next = h ;
+				nodes_.Get(h)->prev = owner.last_child ;
+			} else {
+				owner.first_child = h ;
+			}
+			owner.last_child = h ;
+			mark_measure(parent) ;
+			return h ;
+		}
+
+		SlotHandle CreateLabel(SlotHandle parent, std::string_view text, Color color, uint32_t font = 0, const WidgetStyle& style = {}) {
+			const SlotHandle h = Create(parent, style) ;
+			if (Node* node = nodes_.Get(h)) {
+				node->text = text ;
+				node->text_color = color ;
+				node->font = font ;
+			}
+			return h ;
+		}
+
+		// widget beserta semua turunannya, root tidak bisa dihapus
+		void Remove(SlotHandle h) noexcept {
+			Node* node = nodes_.Get(h) ;
+			if (!node || h == root_) {
+				return ;
+			}
+
+			const SlotHandle parent = node->parent ;
+			unlink(*node) ;
+			erase(h) ;
+			mark_measure(parent) ;
+		}
+
+		// pindahkan h ke depan saudaranya before, before invalid berarti jadi anak terakhir. false kalau before bukan
+		// saudara h. hanya urutan yang berubah, jadi parent cukup disusun ulang tanpa diukur
+		bool Move(SlotHandle h, SlotHandle before = {}) noexcept {
+			Node* node = nodes_.Get(h) ;
+			if (!node || h == root_ || h == before) {
+				return false ;
+			}
+			const SlotHandle parent = node->parent ;
+			Node* next = nodes_.Get(before) ;
+			if (before.IsValid() && (!next || next->parent != parent)) {
+				return false ;
+			}
+
+			unlink(*node) ;
+			Node& owner = *nodes_.Get(parent) ;
+			node->parent = parent ;
+			if (next) {
+				node->prev = next->prev ;
+				node->next = before ;
+				if (Node* prev = nodes_.Get(next->prev)) {
+					prev->next = h ;
+				} else {
+					owner.first_child = h ;
+				}
+				next->prev = h ;
+			} else {
+				node->prev = owner.last_child ;
+				if (Node* last = nodes_.Get(owner.last_child)) {
+					last->next = h ;
+				} else {
+					owner.first_child = h ;
+				}
+				owner.last_child = h ;
+			}
+			mark_layout(parent) ;
+			return true ;
+		}
+
+		// text yang sama tidak menandai apa-apa
+		void SetText(SlotHandle h, std::string_view text) {
+			Node* node = nodes_.Get(h) ;
+			if (node && node->text != text) {
+				node->text = text ;
+				mark_measure(h) ;
+			}
+		}
+
+		// hanya warna, tidak perlu layout ulang
+		void SetTextColor(SlotHandle h, Color color) noexcept {
+			if (Node* node = nodes_.Get(h)) {
+				node->text_color = color ;
+			}
+		}
+
+		void SetStyle(SlotHandle h, const WidgetStyle& style) noexcept {
+			if (Node* node = nodes_.Get(h)) {
+				const bool interactive = node->style.interactive != style.interactive ;
+				node->style = style ;
+				mark_measure(h) ;
+				if (interactive) {
+					mark_moved(h) ;
+				}
+			}
+		}
+
+		// offset isi widget (mis. scroll list), anak digeser sebesar -scroll pada Layout berikutnya
+		void SetScroll(SlotHandle h, const Point<float>& scroll) noexcept {
+			Node* node = nodes_.Get(h) ;
+			if (node && node->scroll != scroll) {
+				node->scroll = scroll ;
+				mark_layout(h) ;
+			}
+		}
+
+		Point<float> GetScroll(SlotHandle h) const noexcept {
+			const Node* node = nodes_.Get(h) ;
+			return node ? node->scroll : Point<float>{} ;
+		}
+
+		// nullptr kalau handle basi
+		const WidgetStyle* GetStyle(SlotHandle h) const noexcept {
+			const Node* node = nodes_.Get(h) ;
+			return node ? &node->style : nullptr ;
+		}
+
+		// ukur ulang semua node, mis. setelah font berubah
+		void MarkAll() noexcept {
+			nodes_.ForEach([this](SlotHandle h, const Node&) { nodes_.Get(h)->dirty |= WidgetDirty::Measure | WidgetDirty::Layout ; }) ;
+		}
+
+		// ukuran area root, biasanya client area window
+		void SetViewport(const Size<float>& size) noexcept { viewport_ = size ; }
+
+		// hanya node yang dirty atau yang ukurannya berubah yang disentuh
+		LayoutStats Layout() {
+			stats_ = LayoutStats{} ;
+			Node& root = *nodes_.Get(root_) ;
+			measure(root) ;
+			arrange(root, Rect<float>(Point<float>{}, viewport_)) ;
+			if (index_) {
+				sync(root_, root, Point<float>{}, false) ;
+			}
+			return stats_ ;
+		}
+
+		const LayoutStats& GetLayoutStats() const noexcept { return stats_ ; }
+
+		// bound relatif ke client area, hasil Layout terakhir. O(depth)
+		Rect<float> GetBound(SlotHandle h) const noexcept {
+			const Node* node = nodes_.Get(h) ;
+			if (!node) {
+				return Rect<float>{} ;
+			}
+
+			Point<float> origin = node->bound.GetPoint() ;
+			for (const Node* parent = nodes_.Get(node->parent) ; parent ; parent = nodes_.Get(parent->parent)) {
+				origin = Point<float>(origin.x + parent->bound.GetPoint().x, origin.y + parent->bound.GetPoint().y) ;
+			}
+			return Rect<float>(origin, node->bound.GetSize()) ;
+		}
+
+		// semua widget ke display list, urutan gambar = urutan pohon (parent dulu, anak terakhir paling atas)
+		void Record(DisplayList& list) const {
+			record(list, *nodes_.Get(root_), Point<float>{}) ;
+		}
+
+		// index berisi bound absolut widget interaktif, diperbarui Layout hanya untuk widget yang bergeser.
+		// index harus hidup selama dipasang, nullptr kembali ke penelusuran pohon
+		void SetSpatialIndex(SpatialIndex* index) noexcept {
+			index_ = index ;
+			if (index_) {
+				index_->Clear() ;
+				nodes_.Get(root_)->dirty |= WidgetDirty::Moved ;
+			}
+		}
+
+		// widget interaktif paling dalam di bawah p, handle invalid kalau tidak ada. dengan SpatialIndex cukup
+		// memeriksa kandidat yang memuat p, hasilnya sama dengan penelusuran pohon
+		SlotHandle HitTest(const Point<float>& p) {
+			if (!index_) {
+				return hit_test(root_, p) ;
+			}
+
+			index_->QueryPoint(p, candidates_) ;
+			SlotHandle best {} ;
+			for (uint32_t id : candidates_) {
+				const SlotHandle h = nodes_.HandleAt(id) ;
+				if (h.IsValid() && reachable(h, p) && (!best.IsValid() || paints_after(h, best))) {
+					best = h ;
+				}
+			}
+			return best ;
+		}
+
+		// terjemahkan event mouse window jadi WidgetEvent (Enter/Leave/Press/Release/Click) lewat queue event,
+		// return true kalau ada widget yang terkena
+		bool HandleMouse(const MouseEvent& e) {
+			if (e.GetState() == MouseState::Wheel) {
+				return false ;
+			}
+
+			const SlotHandle hit = HitTest(e.GetPosition()) ;
+			if (hit != hover_) {
+				if (nodes_.Contains(hover_)) {
+					emit(WidgetState::Leave, hover_) ;
+				}
+				if (hit.IsValid()) {
+					emit(WidgetState::Enter, hit) ;
+				}
+				hover_ = hit ;
+			}
+
+			if (e.GetState() == MouseState::Down && hit.IsValid()) {
+				pressed_ = hit ;
+				emit(WidgetState::Press, hit) ;
+			} else if (e.GetState() == MouseState::Up && pressed_.IsValid()) {
+				if (nodes_.Contains(pressed_)) {
+					emit(WidgetState::Release, pressed_) ;
+					if (pressed_ == hit) {
+						emit(WidgetState::Click, hit) ;
+					}
+				}
+				pressed_ = SlotHandle{} ;
+			}
+			return hit.IsValid() ;
+		}
+	} ;
+}
\ No newline at end of file
@@ -1,196 +1,255 @@
-#pragma once
-
-#include "application.hpp"
-
-namespace utility {
-	bool CheckFlag(zz::WindowFlag src, zz::WindowFlag flag) noexcept {
-		return static_cast<bool>(src & flag) ;
-	}
-
-	void ActivateFlag(zz::WindowFlag& src, zz::WindowFlag flag) noexcept {
-		src |= flag ;
-	} ;
-
-	void DeactivateFlag(zz::WindowFlag& src, zz::WindowFlag flag) noexcept {
-		src &= ~flag ;
-	}
-}
-
-namespace zz {
-
-	class Window : public Application {
-	private :
-		HWND handle_ {} ;
-		WindowFlag state_ = WindowFlag::None ;
-
-		template <Arithmetic type1, Arithmetic type2>
-		void create_window(const char* title, const Point<type2>& pos, const Size<type1>& size, WindowStyle style) {
-			handle_ = CreateWindowEx(
-				0,
-				g_class_name_.c_str(),
-				title,
-				static_cast<uint32_t>(style),
-				pos.x,
-				pos.y,
-				size.w,
-				size.h,
-				nullptr,
-				nullptr,
-				g_hinstance_,
-				nullptr
-			) ;
-
-			if (!handle_) {
-				throw Ex::window("create_window", "Failed to create window!") ;
-			} else {
-				utility::ActivateFlag(state_, WindowFlag::Registered) ;
-			}
-		}
-
-	public :
-		Window() noexcept = default ;
-		Window(const Window&) = delete ;
-		Window& operator=(const Window&) = delete ;
-
-		Window(const char* title, uint16_t w, uint16_t h, WindowStyle style = WindowStyle::Basic) {
-			try {
-				create_window(title, Point{CW_USEDEFAULT}, Size{w, h}, style) ;
-			} catch (const Ex::window& e) {
-				std::cerr << e.what() << '\n' ;
-			} catch (...) {
-				std::cerr << "Window::Window - Unhandled error!\n" ;
-			}
-		}
-
-		template <Arithmetic type>
-		Window(const char* title, const Size<type>& size, WindowStyle style = WindowStyle::Basic) {
-			try {
-				create_window(title, Point{CW_USEDEFAULT}, size, style) ;
-			} catch (const Ex::window& e) {
-				std::cerr << e.what() << '\n' ;
-			} catch (...) {
-				std::cerr << "Window::Window - Unhandled error!\n" ;
-			}
-		}
-
-		Window(const char* title, uint16_t x, uint16_t y, uint16_t w, uint16_t h, WindowStyle style = WindowStyle::Basic) {
-			try {
-				create_window(title, Point{x, y}, Size{w, h}, style) ;
-			} catch (const Ex::window& e) {
-				std::cerr << e.what() << '\n' ;
-			} catch (...) {
-				std::cerr << "Window::Window - Unhandled error!\n" ;
-			}
-		}
-
-		template <Arithmetic type>
-		Window(const char* title, const Point<type>& pos, const Size<type>& size, WindowStyle style = WindowStyle::Basic) {
-			try {
-				create_window(title, pos, size, style) ;
-			} catch (const Ex::window& e) {
-				std::cerr << e.what() << '\n' ;
-			} catch (...) {
-				std::cerr << "Window::Window - Unhandled error!\n" ;
-			}
-		}
-
-		template <Arithmetic type>
-		Window(const char* title, const Rect<type>& rect, WindowStyle style = WindowStyle::Basic) {
-			try {
-				create_window(title, rect.GetPoint(), rect.GetSize(), style) ;
-			} catch (const Ex::window& e) {
-				std::cerr << e.what() << '\n' ;
-			} catch (...) {
-				std::cerr << "Window::Window - Unhandled error!\n" ;
-			}
-		}
-
-		template <Arithmetic type>
-		Window(Window&& o) noexcept {
-			handle_ = std::exchange(o.handle_, nullptr) ;
-			state_ = std::exchange(o.state_, WindowFlag::None) ;
-			if (handle_) {
-				UnregisterWindow(handle_) ;
-				RegisterWindow(handle_, this) ;
-			}
-		}
-
-		~Window() noexcept {}
-
-		Window& operator=(Window&& o) noexcept {
-			if (this != &o) {
-				handle_ = std::exchange(o.handle_, nullptr) ;
-				state_ = std::exchange(o.state_, WindowFlag::None) ;
-				if (handle_) {
-					UnregisterWindow(handle_) ;
-					RegisterWindow(handle_, this) ;
-				}
-			}
-
-			return *this ;
-		}
-
-		void SetShowMode(WindowShowMode mode) const {
-			if (handle_) {
-				ShowWindow(handle_, static_cast<uint8_t>(mode)) ;
-				if (mode == WindowShowMode::Show && !UpdateWindow(handle_)) {
-					throw Ex::window("Show", "Failed to update window.") ;
-				}
-			}
-		}
-
-		void Close() noexcept {
-			if (utility::CheckFlag(state_, WindowFlag::Registered)) {
-				UnregisterWindow(handle_) ;
-				utility::DeactivateFlag(state_, WindowFlag::Registered) ;
-				DestroyWindow(handle_) ;
-				// sepertinya cukup bikin registered saja tidak perlu close, karena di dalam proses pembuatan window itu sendiri udah satu alur proses dengan register window
-				// ntah lah aku pikir nanti
-				utility::ActivateFlag(state_, WindowFlag::Closed) ; 
-				utility::ActivateFlag(state_, WindowFlag::Destroyed) ; 
-			}
-		}
-
-		void SetTitle(const char* NewTitle) noexcept {
-			if (handle_) {
-				SetWindowText(handle_, NewTitle) ;
-			}
-		}
-
-		Rect<int> GetClientBound() const noexcept {
-			tagRECT r ;
-			GetClientRect(handle_, &r) ;
-			return r ;
-		}
-
-		Rect<int> GetWindowBound() const noexcept {
-			tagRECT r ;
-			GetWindowRect(handle_, &r) ;
-			return r ;
-		}
-
-		bool IsWindowValid() const noexcept { 
-			return handle_ && !utility::CheckFlag(state_, WindowFlag::Destroyed); 
-		}
-	} ;
-
-	inline LRESULT CALLBACK WindowProcedure(HWND handle, uint32_t message, uint64_t wparam, int64_t lparam) noexcept {
-		switch (message) {
-			case WM_SIZE :
-				Application::PushEvent(Event{handle, WindowEventData{WindowEvent::Resize, Size{LOWORD(lparam), HIWORD(lparam)}}}) ;
-				break ; 
-			case WM_CLOSE :
-				Application::PushEvent(Event{handle, WindowEventData{WindowEvent::Close, Size{LOWORD(lparam), HIWORD(lparam)}}}) ;
-				return 0 ;
-
-			case WM_DESTROY :
-				if (Application::g_windows_.empty()) {
-					Application::g_is_running_ = false ;
-					PostQuitMessage(0) ;
-				}
-				return 0 ;
-		}
-
-		return DefWindowProc(handle, message, wparam, lparam) ;
-	}
+#pragma once
+
+#include "application.hpp"
+#include "surface.hpp"
+#include "displaylist.hpp"
+#include "widget.hpp"
+
+namespace utility {
+	bool CheckFlag(zz::WindowFlag src, zz::WindowFlag flag) noexcept {
+		return static_cast<bool>(src & flag) ;
+	}
+
+	void ActivateFlag(zz::WindowFlag& src, zz::WindowFlag flag) noexcept {
+		src |= flag ;
+	} ;
+
+	void DeactivateFlag(zz::WindowFlag& src, zz::WindowFlag flag) noexcept {
+		src &= ~flag ;
+	}
+}
+
+namespace zz {
+
+	class Window : public Application {
+	private :
+		WindowHandle handle_ {} ;
+		SlotHandle slot_ {} ;
+		WindowFlag state_ = WindowFlag::None ;
+		DamageRegion damage_ {} ;
+		DamageStats damage_stats_ {} ;
+		Size<int> presented_size_ {} ;
+		DisplayList display_list_ {} ;
+		DisplayList previous_list_ {} ;
+		WidgetTree widgets_ {} ;
+
+		template <Arithmetic type1, Arithmetic type2>
+		void create_window(const char* title, const Point<type2>& pos, const Size<type1>& size, WindowStyle style) {
+			handle_ = GetBackend().Create(title, Rect<int>{Point<int>{pos}, Size<int>{size}}, style) ;
+
+			if (!handle_) {
+				throw Ex::window("create_window", "Failed to create window!") ;
+			} else {
+				slot_ = RegisterWindow(handle_, this) ;
+				widgets_.SetWindow(handle_) ;
+				utility::ActivateFlag(state_, WindowFlag::Registered) ;
+			}
+		}
+
+	public :
+		Window() noexcept = default ;
+		Window(const Window&) = delete ;
+		Window& operator=(const Window&) = delete ;
+
+		Window(const char* title, uint16_t w, uint16_t h, WindowStyle style = WindowStyle::Basic) {
+			try {
+				create_window(title, Point{Backend::DefaultPosition}, Size{w, h}, style) ;
+			} catch (const Ex::window& e) {
+				std::cerr << e.what() << '\n' ;
+			} catch (...) {
+				std::cerr << "Window::Window - Unhandled error!\n" ;
+			}
+		}
+
+		template <Arithmetic type>
+		Window(const char* title, const Size<type>& size, WindowStyle style = WindowStyle::Basic) {
+			try {
+				create_window(title, Point{Backend::DefaultPosition}, size, style) ;
+			} catch (const Ex::window& e) {
+				std::cerr << e.what() << '\n' ;
+			} catch (...) {
+				std::cerr << "Window::Window - Unhandled error!\n" ;
+			}
+		}
+
+		Window(const char* title, uint16_t x, uint16_t y, uint16_t w, uint16_t h, WindowStyle style = WindowStyle::Basic) {
+			try {
+				create_window(title, Point{x, y}, Size{w, h}, style) ;
+			} catch (const Ex::window& e) {
+				std::cerr << e.what() << '\n' ;
+			} catch (...) {
+				std::cerr << "Window::Window - Unhandled error!\n" ;
+			}
+		}
+
+		template <Arithmetic type>
+		Window(const char* title, const Point<type>& pos, const Size<type>& size, WindowStyle style = WindowStyle::Basic) {
+			try {
+				create_window(title, pos, size, style) ;
+			} catch (const Ex::window& e) {
+				std::cerr << e.what() << '\n' ;
+			} catch (...) {
+				std::cerr << "Window::Window - Unhandled error!\n" ;
+			}
+		}
+
+		template <Arithmetic type>
+		Window(const char* title, const Rect<type>& rect, WindowStyle style = WindowStyle::Basic) {
+			try {
+				create_window(title, rect.GetPoint(), rect.GetSize(), style) ;
+			} catch (const Ex::window& e) {
+				std::cerr << e.what() << '\n' ;
+			} catch (...) {
+				std::cerr << "Window::Window - Unhandled error!\n" ;
+			}
+		}
+
+		Window(Window&& o) noexcept {
+			handle_ = std::exchange(o.handle_, nullptr) ;
+			slot_ = std::exchange(o.slot_, SlotHandle{}) ;
+			state_ = std::exchange(o.state_, WindowFlag::None) ;
+			damage_ = std::exchange(o.damage_, DamageRegion{}) ;
+			damage_stats_ = o.damage_stats_ ;
+			presented_size_ = std::exchange(o.presented_size_, Size<int>{}) ;
+			display_list_ = std::move(o.display_list_) ;
+			previous_list_ = std::move(o.previous_list_) ;
+			widgets_ = std::move(o.widgets_) ;
+			RebindWindow(slot_, this) ;
+		}
+
+		// slot dilepas supaya event yang masih mengarah ke handle ini tidak lagi menemukan pointer yang sudah mati
+		~Window() noexcept {
+			UnregisterWindow(slot_) ;
+		}
+
+		Window& operator=(Window&& o) noexcept {
+			if (this != &o) {
+				UnregisterWindow(slot_) ;
+				handle_ = std::exchange(o.handle_, nullptr) ;
+				slot_ = std::exchange(o.slot_, SlotHandle{}) ;
+				state_ = std::exchange(o.state_, WindowFlag::None) ;
+				damage_ = std::exchange(o.damage_, DamageRegion{}) ;
+				damage_stats_ = o.damage_stats_ ;
+				presented_size_ = std::exchange(o.presented_size_, Size<int>{}) ;
+				display_list_ = std::move(o.display_list_) ;
+				previous_list_ = std::move(o.previous_list_) ;
+				widgets_ = std::move(o.widgets_) ;
+				RebindWindow(slot_, this) ;
+			}
+
+			return *this ;
+		}
+
+		void SetShowMode(WindowShowMode mode) const {
+			if (handle_) {
+				if (!GetBackend().Show(handle_, mode) && mode == WindowShowMode::Show) {
+					throw Ex::window("Show", "Failed to update window.") ;
+				}
+			}
+		}
+
+		void Close() noexcept {
+			if (utility::CheckFlag(state_, WindowFlag::Registered)) {
+				UnregisterWindow(std::exchange(slot_, SlotHandle{})) ;
+				utility::DeactivateFlag(state_, WindowFlag::Registered) ;
+				GetBackend().Destroy(handle_) ;
+				// sepertinya cukup bikin registered saja tidak perlu close, karena di dalam proses pembuatan window itu sendiri udah satu alur proses dengan register window
+				// ntah lah aku pikir nanti
+				utility::ActivateFlag(state_, WindowFlag::Closed) ; 
+				utility::ActivateFlag(state_, WindowFlag::Destroyed) ; 
+
+				if (g_windows_.Empty()) {
+					g_is_running_ = false ;
+					GetBackend().Quit() ;
+				}
+			}
+		}
+
+		void SetTitle(const char* NewTitle) noexcept {
+			if (handle_) {
+				GetBackend().SetTitle(handle_, NewTitle) ;
+			}
+		}
+
+		// tandai area client yang harus digambar ulang, biasanya dari WindowState::Paint atau widget yang berubah
+		void Invalidate(const Rect<int>& r) noexcept {
+			damage_.Add(r) ;
+		}
+
+		void InvalidateAll() noexcept {
+			damage_.Add(GetClientBound()) ;
+		}
+
+		// area yang harus digambar untuk frame ini. ukuran surface yang berbeda dari present terakhir
+		// (resize, frame pertama) berarti seluruh surface
+		const DamageRegion& BeginFrame(const SurfaceView& surface) noexcept {
+			if (surface.GetSize() != presented_size_) {
+				damage_.Add(surface.GetBound()) ;
+			}
+			damage_.Clip(surface.GetBound()) ;
+			return damage_ ;
+		}
+
+		// mulai merekam frame baru, list frame sebelumnya disimpan untuk Commit
+		DisplayList& Record() noexcept {
+			std::swap(display_list_, previous_list_) ;
+			display_list_.Clear() ;
+			return display_list_ ;
+		}
+
+		// area perintah yang berbeda dari frame sebelumnya masuk ke damage, return jumlah perintah yang berubah
+		size_t Commit() {
+			return display_list_.Diff(previous_list_, damage_) ;
+		}
+
+		const DisplayList& GetDisplayList() const noexcept { return display_list_ ; }
+		WidgetTree& GetWidgets() noexcept { return widgets_ ; }
+		const WidgetTree& GetWidgets() const noexcept { return widgets_ ; }
+		const DamageRegion& GetDamage() const noexcept { return damage_ ; }
+		const DamageStats& GetDamageStats() const noexcept { return damage_stats_ ; }
+		void ResetDamageStats() noexcept { damage_stats_.Reset() ; }
+
+		// surface ditampilkan di pojok kiri atas client area, hanya area yang rusak yang dikirim ke backend.
+		// damage dikosongkan dan fraksi piksel yang dikirim dicatat, juga saat tidak ada yang perlu dikirim
+		bool Present(const SurfaceView& surface) noexcept {
+			if (!handle_ || surface.Empty()) {
+				return false ;
+			}
+
+			BeginFrame(surface) ;
+			bool ok = true ;
+			if (!damage_.Empty()) {
+				ok = GetBackend().Present(handle_, surface.Data(), surface.GetSize(), surface.Stride(), damage_.GetRects()) ;
+				// input yang sudah di-poll baru dianggap sampai ke layar kalau ada piksel yang benar-benar dikirim
+				if (ok) {
+					Latency::MarkPresent() ;
+				}
+			}
+
+			damage_stats_.Record(static_cast<uint64_t>(damage_.GetArea()), static_cast<uint64_t>(surface.Width()) * static_cast<uint64_t>(surface.Height())) ;
+			presented_size_ = surface.GetSize() ;
+			damage_.Clear() ;
+			return ok ;
+		}
+
+		Rect<int> GetClientBound() const noexcept {
+			return GetBackend().GetClientBound(handle_) ;
+		}
+
+		Rect<int> GetWindowBound() const noexcept {
+			return GetBackend().GetWindowBound(handle_) ;
+		}
+
+		WindowHandle GetHandle() const noexcept {
+			return handle_ ;
+		}
+
+		SlotHandle GetSlot() const noexcept {
+			return slot_ ;
+		}
+
+		bool IsWindowValid() const noexcept { 
+			return handle_ && !utility::CheckFlag(state_, WindowFlag::Destroyed); 
+		}
+	} ;
 }
\ No newline at end of file
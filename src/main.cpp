@@ -1,37 +1,135 @@
-#include "window.hpp"
-using namespace zz ;
-
-
-int main() {
-	Application::RegisterWindowClass() ;
-
-	Window window("Window demo", Size{600, 400}, WindowStyle::OverlappedWindow) ;
-	try {
-		window.SetShowMode(WindowShowMode::Show) ;
-	} catch (const Ex::window& e) {
-		std::cerr << e.what() ;
-	}
-
-	Event e ;
-	while (Application::IsRunning()) {
-		try {
-			while (PollEvent(e)) {
-				if (e.GetType() == EventType::Window) {
-					auto e_ = e.GetWindowEventData() ;
-					if (e_->GetEvent() == WindowEvent::Close) {
-						window.Close() ;
-						Application::QuitProgram() ;
-						break ;
-					}
-				}
-			}
-			Point<int> pos {1} ;
-			pos /= Point{0} ;
-			Sleep(16) ;
-		} catch (const Ex::error_logic e) {
-			std::cerr << e.what() << '\n' ;
-		} catch (...) {
-			std::cerr << "unhandle error\n" ;
-		}
-	}
+#include "dispatcher.hpp"
+#include "raster.hpp"
+#include "font.hpp"
+#include "virtuallist.hpp"
+using namespace zz ;
+
+
+int main() {
+	Application::RegisterWindowClass() ;
+
+	Window window("Window demo", Size{600, 640}, WindowStyle::OverlappedWindow) ;
+	try {
+		window.SetShowMode(WindowShowMode::Show) ;
+	} catch (const Ex::window& e) {
+		std::cerr << e.what() ;
+	}
+
+	Surface surface ;
+	Rasterizer raster ;
+	ThreadPool pool ;
+	BitmapFont bitmap_font ;
+	FontCache fonts ;
+	const uint32_t label_font = fonts.AddFont(bitmap_font, 16) ;
+
+	// panel widget di bawah scene, tombol menaikkan counter lewat WidgetEvent::Click
+	WidgetTree& widgets = window.GetWidgets() ;
+	widgets.SetTextRenderer(&fonts) ;
+	SpatialGrid hit_index {} ;
+	widgets.SetSpatialIndex(&hit_index) ;
+	widgets.SetStyle(widgets.GetRoot(), WidgetStyle{.layout = WidgetLayout::Column, .align = WidgetAlign::Start, .padding = 40.0f, .gap = 12.0f}) ;
+	widgets.Create(widgets.GetRoot(), WidgetStyle{.height = 260.0f}) ;
+	const SlotHandle panel = widgets.Create(widgets.GetRoot(), WidgetStyle{.layout = WidgetLayout::Row, .align = WidgetAlign::Center, .padding = 8.0f, .gap = 12.0f, .radius = 6.0f, .background = Color(48, 48, 60)}) ;
+	const SlotHandle button = widgets.CreateLabel(panel, "Click", Color(20, 20, 28), label_font, WidgetStyle{.padding = 6.0f, .radius = 4.0f, .background = Color(120, 200, 140), .interactive = true}) ;
+	const SlotHandle counter = widgets.CreateLabel(panel, "Clicks: 0", Color(230, 230, 230), label_font) ;
+	int clicks = 0 ;
+
+	// log sejuta baris, hanya baris yang terlihat yang punya widget
+	static constexpr const char* levels[] = {"INFO", "WARN", "DEBUG", "ERROR"} ;
+	VirtualList log(widgets, widgets.GetRoot(), WidgetStyle{.width = 520.0f, .grow = 1.0f, .background = Color(24, 24, 30)}, VirtualListStyle{.font = label_font, .text_color = Color(200, 200, 210)}, {90.0f, 70.0f, -1.0f},
+		[](uint64_t row, uint32_t column, std::string& text) {
+			switch (column) {
+				case 0 : text += std::to_string(row) ; break ;
+				case 1 : text += levels[(row * 2654435761u >> 7) % 4] ; break ;
+				default : text += "request " ; text += std::to_string(row * 7919 % 100003) ; text += " done" ; break ;
+			}
+		}, 1'000'000) ;
+
+	// scene direkam ke display list window, hanya perintah yang berubah yang menambah damage
+	const auto record = [&window, &surface, &widgets, &log] {
+		const Rect<int> client = window.GetClientBound() ;
+		log.Update(client) ;
+		widgets.Layout() ;
+		// ukuran view baru diketahui setelah Layout, baris log disesuaikan sekali lagi
+		if (log.Update(client)) {
+			widgets.Layout() ;
+		}
+		DisplayList& list = window.Record() ;
+		list.FillRect(surface.GetBound(), Color(32, 32, 40)) ;
+		list.FillRoundedRect(Rect<float>(40.0f, 40.0f, 200.0f, 120.0f), 12.0f, Premultiply(Color(80, 160, 255, 160))) ;
+		list.DrawLine(Point<float>(40.0f, 200.0f), Point<float>(240.0f, 260.0f), 3.0f, Color(230, 230, 230)) ;
+		widgets.Record(list) ;
+		window.Commit() ;
+	} ;
+
+	// hanya area yang rusak yang digambar dan dikirim ke layar
+	const auto redraw = [&window, &surface, &raster, &pool, &fonts] {
+		const DamageRegion& damage = window.BeginFrame(surface) ;
+		if (damage.Empty()) {
+			return ;
+		}
+
+		raster.Clear() ;
+		fonts.BeginFrame() ;
+		window.GetDisplayList().Replay(raster, {}, &fonts) ;
+		raster.Render(surface, damage.GetRects(), &pool) ;
+		window.Present(surface) ;
+	} ;
+
+	Dispatcher dispatcher ;
+	dispatcher.On(window, [&window, &surface, &fonts, &widgets, &record, &redraw](const WindowEvent& e) {
+		if (e.GetState() == WindowState::Resize) {
+			surface.Resize(e.GetValue().w, e.GetValue().h) ;
+			widgets.SetViewport(Size<float>(e.GetValue().w, e.GetValue().h)) ;
+			record() ;
+			redraw() ;
+		} else if (e.GetState() == WindowState::Paint) {
+			window.Invalidate(e.GetRect()) ;
+			redraw() ;
+		} else if (e.GetState() == WindowState::Close) {
+			fonts.GetStats().Dump(std::cout) ;
+			window.Close() ;
+			Application::QuitProgram() ;
+		}
+	}) ;
+
+	// wheel hanya mengubah target scroll, animasinya dijalankan loop utama
+	dispatcher.On(window, [&widgets, &log](const MouseEvent& e) {
+		log.HandleMouse(e) ;
+		widgets.HandleMouse(e) ;
+	}) ;
+
+	// hanya label counter yang berubah, Layout menyentuh jalur label itu saja dan Commit hanya merusak area panel
+	dispatcher.On(window, [&widgets, button, counter, &clicks, &record, &redraw](const WidgetEvent& e) {
+		if (e.GetState() == WidgetState::Click && e.GetWidget() == button) {
+			widgets.SetText(counter, "Clicks: " + std::to_string(++clicks)) ;
+			record() ;
+			redraw() ;
+		}
+	}) ;
+
+	#ifndef _WIN32
+		// backend headless tidak punya user yang menutup window, demo langsung minta close
+		static_cast<HeadlessBackend&>(Application::GetBackend()).InjectClose(window.GetHandle()) ;
+	#endif
+
+	Event e ;
+	while (Application::IsRunning()) {
+		try {
+			// selama scroll beranimasi event ditunggu paling lama satu frame, lalu scroll maju satu langkah
+			while (Application::IsRunning()) {
+				if (WaitEvent(e, log.IsAnimating() ? 16 : Waiter::Infinite)) {
+					dispatcher.Dispatch(e) ;
+				}
+				if (log.Tick()) {
+					record() ;
+					redraw() ;
+				}
+			}
+		} catch (const Ex::error_logic& e) {
+			std::cerr << e.what() << '\n' ;
+		} catch (...) {
+			std::cerr << "unhandle error\n" ;
+		}
+	}
 }
\ No newline at end of file
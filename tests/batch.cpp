@@ -0,0 +1,179 @@
+#include <cstring>
+#include <random>
+
+#include "check.hpp"
+#include "batch.hpp"
+
+using namespace zz ;
+
+static std::mt19937 g_random(11) ;
+
+static float random_float(float lo, float hi) {
+	return std::uniform_real_distribution<float>(lo, hi)(g_random) ;
+}
+
+static int random_int(int lo, int hi) {
+	return std::uniform_int_distribution<int>(lo, hi)(g_random) ;
+}
+
+template <typename type>
+static bool same_bits(const std::vector<type>& a, const std::vector<type>& b) noexcept {
+	return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(type)) == 0) ;
+}
+
+static std::vector<SimdLevel> levels() {
+	std::vector<SimdLevel> result ;
+	for (const SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON}) {
+		if (Simd::IsSupported(level)) {
+			result.push_back(level) ;
+		}
+	}
+	return result ;
+}
+
+// hasil batch di tiap level dibandingkan dengan operator per elemen dari unit.hpp. panjang span acak supaya
+// sisa scalar setelah kernel 4/8 lane ikut teruji
+static void test_against_operators() {
+	const SimdLevel detected = Simd::GetLevel() ;
+	for (int round = 0 ; round < 200 ; ++round) {
+		const size_t count = static_cast<size_t>(random_int(0, 37)) ;
+		std::vector<Rect<float>> rects(count) ;
+		std::vector<Point<float>> points(count) ;
+		std::vector<Rect<int>> irects(count) ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			rects[i] = Rect<float>{random_float(-1e4f, 1e4f), random_float(-1e4f, 1e4f), random_float(0.0f, 500.0f), random_float(0.0f, 500.0f)} ;
+			points[i] = Point<float>{random_float(-1e4f, 1e4f), random_float(-1e4f, 1e4f)} ;
+			irects[i] = Rect<int>{random_int(-100000, 100000), random_int(-100000, 100000), random_int(0, 5000), random_int(0, 5000)} ;
+		}
+		const Point<float> offset {random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f)} ;
+		const Point<float> factor {random_float(0.1f, 4.0f), random_float(0.1f, 4.0f)} ;
+		const Point<int> ioffset {random_int(-1000, 1000), random_int(-1000, 1000)} ;
+		const Rect<float> lo {-5000.0f, -5000.0f, 10.0f, 10.0f} ;
+		const Rect<float> hi {5000.0f, 5000.0f, 300.0f, 300.0f} ;
+
+		// referensi: operator per elemen
+		std::vector<Rect<float>> translated(count), scaled(count), clamped(count) ;
+		std::vector<Point<float>> moved(count) ;
+		std::vector<Rect<int>> itranslated(count), truncated(count) ;
+		std::vector<Rect<float>> widened(count) ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			translated[i] = rects[i] + Rect<float>{offset.x, offset.y, 0.0f, 0.0f} ;
+			scaled[i] = rects[i] * Rect<float>{factor.x, factor.y, factor.x, factor.y} ;
+			moved[i] = points[i] + offset ;
+			itranslated[i] = Rect<int>{irects[i].GetPoint() + ioffset, irects[i].GetSize()} ;
+			widened[i] = Rect<float>(irects[i]) ;
+			truncated[i] = Rect<int>(scaled[i]) ;
+			const Rect<float>& r = rects[i] ;
+			clamped[i] = Rect<float>{
+				std::min(std::max(r.GetPoint().x, lo.GetPoint().x), hi.GetPoint().x),
+				std::min(std::max(r.GetPoint().y, lo.GetPoint().y), hi.GetPoint().y),
+				std::min(std::max(r.GetSize().w, lo.GetSize().w), hi.GetSize().w),
+				std::min(std::max(r.GetSize().h, lo.GetSize().h), hi.GetSize().h)
+			} ;
+		}
+
+		for (const SimdLevel level : levels()) {
+			CHECK(Simd::SetLevel(level)) ;
+
+			std::vector<Rect<float>> a = rects ;
+			Translate(std::span(a), offset) ;
+			CHECK(same_bits(a, translated)) ;
+
+			a = rects ;
+			Scale(std::span(a), factor) ;
+			CHECK(same_bits(a, scaled)) ;
+
+			a = rects ;
+			Clamp(std::span(a), lo, hi) ;
+			CHECK(same_bits(a, clamped)) ;
+
+			std::vector<Point<float>> p = points ;
+			Translate(std::span(p), offset) ;
+			CHECK(same_bits(p, moved)) ;
+
+			std::vector<Rect<int>> b = irects ;
+			Translate(std::span(b), ioffset) ;
+			CHECK(same_bits(b, itranslated)) ;
+
+			std::vector<Rect<float>> f(count) ;
+			CHECK(Convert(std::span<const Rect<int>>(irects), std::span(f)) == count) ;
+			CHECK(same_bits(f, widened)) ;
+
+			std::vector<Rect<int>> t(count) ;
+			CHECK(Convert(std::span<const Rect<float>>(scaled), std::span(t)) == count) ;
+			CHECK(same_bits(t, truncated)) ;
+		}
+	}
+	Simd::SetLevel(detected) ;
+}
+
+// kasus tepi: NaN pada clamp dan float di luar range int32 harus sama di semua level x86
+static void test_edges() {
+	const SimdLevel detected = Simd::GetLevel() ;
+	const float nan = std::numeric_limits<float>::quiet_NaN() ;
+	const std::vector<float> source {nan, -nan, 3e9f, -3e9f, 2147483520.0f, -2147483648.0f, -0.5f, 0.99f, 1e-30f, -7.5f, 7.5f, 0.0f} ;
+
+	std::vector<std::vector<float>> clamped ;
+	std::vector<std::vector<int32_t>> converted ;
+	for (const SimdLevel level : levels()) {
+		Simd::SetLevel(level) ;
+		std::vector<float> c = source ;
+		Kernel::Clamp(c.data(), c.size(), {-1.0f, -1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f, 1.0f}) ;
+		clamped.push_back(c) ;
+
+		std::vector<int32_t> i(source.size()) ;
+		Kernel::Convert(source.data(), i.data(), source.size()) ;
+		converted.push_back(i) ;
+	}
+
+	for (size_t l = 1 ; l < clamped.size() ; ++l) {
+		CHECK(same_bits(clamped[l], clamped[0])) ;
+		#ifdef ZZ_SIMD_X86
+			CHECK(same_bits(converted[l], converted[0])) ;
+		#endif
+	}
+	#ifdef ZZ_SIMD_X86
+		CHECK(converted[0][2] == std::numeric_limits<int32_t>::min()) ;
+	#endif
+	CHECK(converted[0][4] == 2147483520 && converted[0][6] == 0 && converted[0][9] == -7) ;
+	Simd::SetLevel(detected) ;
+}
+
+// MulFixed/ShiftRight dipakai jalur Fixed, dicek terhadap rumus 64-bit dengan operand negatif dan besar
+static void test_fixed() {
+	const SimdLevel detected = Simd::GetLevel() ;
+	for (int round = 0 ; round < 100 ; ++round) {
+		const size_t count = static_cast<size_t>(random_int(0, 29)) ;
+		const int shift = random_int(0, 31) ;
+		std::vector<int32_t> data(count) ;
+		for (int32_t& v : data) {
+			v = random_int(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()) ;
+		}
+		const Kernel::I32x4 pattern {random_int(-65536, 65536), random_int(-65536, 65536), 1 << 16, -(1 << 16)} ;
+
+		std::vector<int32_t> product(count), shifted(count) ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			product[i] = static_cast<int32_t>((static_cast<int64_t>(data[i]) * pattern[i & 3]) >> shift) ;
+			shifted[i] = data[i] >> shift ;
+		}
+
+		for (const SimdLevel level : levels()) {
+			Simd::SetLevel(level) ;
+			std::vector<int32_t> m = data ;
+			Kernel::MulFixed(m.data(), m.size(), pattern, shift) ;
+			CHECK(same_bits(m, product)) ;
+
+			std::vector<int32_t> s(count) ;
+			Kernel::ShiftRight(data.data(), s.data(), count, shift) ;
+			CHECK(same_bits(s, shifted)) ;
+		}
+	}
+	Simd::SetLevel(detected) ;
+}
+
+int main() {
+	test_against_operators() ;
+	test_edges() ;
+	test_fixed() ;
+	return test::Result("batch") ;
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdio>
+
+// assert ringan untuk test. tidak berhenti di kegagalan pertama supaya semua kasus yang gagal terlihat.
+// CHECK hanya dari thread utama, counter-nya tidak atomic
+namespace test {
+	inline int g_checks = 0 ;
+	inline int g_failures = 0 ;
+
+	inline void Fail(const char* file, int line, const char* expression) noexcept {
+		if (++g_failures <= 50) {
+			std::fprintf(stderr, "%s:%d: CHECK(%s) gagal\n", file, line, expression) ;
+		}
+	}
+
+	// return value main
+	inline int Result(const char* name) noexcept {
+		std::printf("%s: %d check, %d gagal\n", name, g_checks, g_failures) ;
+		return g_failures == 0 ? 0 : 1 ;
+	}
+}
+
+#define CHECK(...) do { ++test::g_checks ; if (!(__VA_ARGS__)) { test::Fail(__FILE__, __LINE__, #__VA_ARGS__) ; } } while (0)
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <random>
+
+#include "check.hpp"
+#include "window.hpp"
+
+using namespace zz ;
+
+// bitmap piksel untuk membandingkan region dengan gabungan rect input, koordinat digeser supaya rect negatif muat
+class Coverage {
+private :
+	static constexpr int origin = 64 ;
+	static constexpr int side = 512 ;
+	std::vector<uint8_t> pixels_ = std::vector<uint8_t>(side * side) ;
+
+public :
+	void Paint(const Rect<int>& r) {
+		for (int y = r.GetPoint().y ; y < Bottom(r) ; ++y) {
+			for (int x = r.GetPoint().x ; x < Right(r) ; ++x) {
+				pixels_[static_cast<size_t>(y + origin) * side + static_cast<size_t>(x + origin)] = 1 ;
+			}
+		}
+	}
+
+	bool Covers(const Rect<int>& r) const {
+		for (int y = r.GetPoint().y ; y < Bottom(r) ; ++y) {
+			for (int x = r.GetPoint().x ; x < Right(r) ; ++x) {
+				if (!pixels_[static_cast<size_t>(y + origin) * side + static_cast<size_t>(x + origin)]) {
+					return false ;
+				}
+			}
+		}
+		return true ;
+	}
+
+	int64_t Count() const {
+		return std::count(pixels_.begin(), pixels_.end(), uint8_t{1}) ;
+	}
+} ;
+
+static bool disjoint(const DamageRegion& damage) noexcept {
+	const std::span<const Rect<int>> rects = damage.GetRects() ;
+	for (size_t i = 0 ; i < rects.size() ; ++i) {
+		for (size_t j = i + 1 ; j < rects.size() ; ++j) {
+			if (Intersects(rects[i], rects[j])) {
+				return false ;
+			}
+		}
+	}
+	return true ;
+}
+
+// rect acak termasuk yang keluar ke koordinat negatif: region tidak tumpang tindih, GetArea sama dengan jumlah
+// piksel gabungannya, tidak lebih dari capacity, dan tiap input tertutup
+static void test_random() {
+	std::mt19937 random(20) ;
+	std::uniform_int_distribution<int> position(-40, 360) ;
+	std::uniform_int_distribution<uint32_t> extent(1, 60) ;
+	for (int round = 0 ; round < 300 ; ++round) {
+		DamageRegion damage ;
+		std::vector<Rect<int>> inputs(std::uniform_int_distribution<size_t>(1, 64)(random)) ;
+		Coverage input ;
+		for (Rect<int>& r : inputs) {
+			r = Rect<int>(position(random), position(random), extent(random), extent(random)) ;
+			damage.Add(r) ;
+			input.Paint(r) ;
+		}
+
+		Coverage region ;
+		for (const Rect<int>& r : damage.GetRects()) {
+			region.Paint(r) ;
+		}
+		CHECK(damage.Count() <= DamageRegion::capacity && disjoint(damage)) ;
+		CHECK(damage.GetArea() == region.Count() && damage.GetArea() >= input.Count()) ;
+		for (const Rect<int>& r : inputs) {
+			CHECK(region.Covers(r)) ;
+		}
+	}
+
+	// kosong tidak pernah masuk, rect yang sudah tertutup tidak menambah apa pun
+	DamageRegion damage ;
+	damage.Add(Rect<int>(5, 5, 0, 10)) ;
+	CHECK(damage.Empty()) ;
+	damage.Add(Rect<int>(0, 0, 40, 40)) ;
+	damage.Add(Rect<int>(10, 10, 5, 5)) ;
+	CHECK(damage.Count() == 1 && damage.GetArea() == 1600) ;
+}
+
+// 16 sel berjauhan memenuhi region. rect bersebelahan tanpa celah digabung tanpa tambahan area, rect ke-17 yang
+// berjauhan digabung dengan sel yang menambah area paling sedikit
+static void test_full() {
+	const auto cell = [](int i) { return Rect<int>((i % 4) * 40, (i / 4) * 40, 10, 10) ; } ;
+	DamageRegion damage ;
+	for (int i = 0 ; i < 16 ; ++i) {
+		damage.Add(cell(i)) ;
+	}
+	CHECK(damage.Count() == DamageRegion::capacity && damage.GetArea() == 1600) ;
+
+	// menempel di kanan sel 5: bounding box-nya pas, tidak ada sel lain yang ikut
+	damage.Add(Rect<int>(50, 40, 6, 10)) ;
+	CHECK(damage.Count() == 16 && damage.GetArea() == 1660) ;
+
+	// dekat sel 10 (80, 80) tapi tidak menempel: sel 10 yang digabung, sel lain utuh
+	const Rect<int> near(93, 84, 4, 4) ;
+	damage.Add(near) ;
+	const Rect<int> merged = Union(cell(10), near) ;
+	CHECK(damage.Count() == 16) ;
+	CHECK(std::find(damage.GetRects().begin(), damage.GetRects().end(), merged) != damage.GetRects().end()) ;
+	CHECK(damage.GetArea() == 1660 - 100 + 17 * 10) ;
+	CHECK(disjoint(damage)) ;
+
+	// bounding box gabungan menelan sel lain: sel itu ikut dilebur dan jumlah rect berkurang
+	damage.Add(Rect<int>(0, 0, 50, 10)) ;
+	CHECK(damage.Count() == 15 && disjoint(damage)) ;
+	CHECK(damage.GetBound() == Rect<int>(0, 0, 130, 130)) ;
+}
+
+static void test_clip() {
+	DamageRegion damage ;
+	damage.Add(Rect<int>(-10, -10, 20, 20)) ;		// sebagian di luar kiri atas
+	damage.Add(Rect<int>(50, 50, 30, 5)) ;		// sebagian di luar kanan
+	damage.Add(Rect<int>(100, 100, 10, 10)) ;		// seluruhnya di luar
+	damage.Add(Rect<int>(20, 20, 5, 5)) ;		// seluruhnya di dalam
+	CHECK(damage.Count() == 4) ;
+
+	damage.Clip(Rect<int>(0, 0, 64, 64)) ;
+	CHECK(damage.Count() == 3) ;
+	CHECK(damage.GetArea() == 100 + 14 * 5 + 25) ;
+	CHECK(zz::Contains(Rect<int>(0, 0, 64, 64), damage.GetBound())) ;
+	CHECK(!damage.Intersects(Rect<int>(64, 0, 100, 100))) ;
+
+	damage.Clip(Rect<int>(200, 200, 10, 10)) ;
+	CHECK(damage.Empty() && damage.GetArea() == 0) ;
+}
+
+// Window::Present hanya mengirim area yang rusak: frame pertama penuh, lalu invalidate sebagian, lalu tanpa damage
+static void test_present() {
+	Application::RegisterWindowClass() ;
+	Window window("damage", Size{64, 64}) ;
+	HeadlessBackend& backend = static_cast<HeadlessBackend&>(Application::GetBackend()) ;
+	const WindowHandle handle = window.GetHandle() ;
+	constexpr uint64_t total = 64 * 64 ;
+
+	Surface surface(64, 64) ;
+	surface.Fill(Color(0, 0, 0, 255)) ;
+	CHECK(window.Present(surface)) ;
+	CHECK(backend.GetPresentedArea(handle) == total && backend.GetPresentCount(handle) == 1) ;
+	CHECK(window.GetDamageStats().GetLastFraction() == 1.0 && window.GetDamage().Empty()) ;
+
+	// hanya 10x10 yang disalin, sisa frame di backend tetap isi present sebelumnya
+	surface.Fill(Color(255, 0, 0, 255)) ;
+	window.Invalidate(Rect<int>(4, 6, 10, 10)) ;
+	CHECK(window.Present(surface)) ;
+	CHECK(backend.GetPresentedArea(handle) == 100 && backend.GetPresentCount(handle) == 2) ;
+	CHECK(window.GetDamageStats().GetLastFraction() == 100.0 / total) ;
+	const std::vector<Color> frame = backend.GetFrame(handle) ;
+	CHECK(frame[6 * 64 + 4] == Color(255, 0, 0, 255) && frame[15 * 64 + 13] == Color(255, 0, 0, 255)) ;
+	CHECK(frame[5 * 64 + 4] == Color(0, 0, 0, 255) && frame[6 * 64 + 14] == Color(0, 0, 0, 255)) ;
+
+	// tanpa damage backend tidak dipanggil tapi frame tetap tercatat dengan fraksi 0
+	CHECK(window.Present(surface)) ;
+	CHECK(backend.GetPresentCount(handle) == 2 && window.GetDamageStats().GetLastFraction() == 0.0) ;
+
+	// invalidate yang keluar dari surface dipotong
+	window.Invalidate(Rect<int>(60, 56, 10, 10)) ;
+	CHECK(window.Present(surface)) ;
+	CHECK(backend.GetPresentedArea(handle) == 4 * 8) ;
+
+	const DamageStats& stats = window.GetDamageStats() ;
+	CHECK(stats.GetFrameCount() == 4) ;
+	CHECK(stats.GetAverageFraction() == static_cast<double>(total + 100 + 0 + 32) / static_cast<double>(4 * total)) ;
+	CHECK(stats.GetHistogram().Max() == 1000) ;
+
+	// ukuran surface berubah: seluruh surface dikirim walau tidak ada invalidate
+	Surface larger(80, 72) ;
+	CHECK(window.Present(larger)) ;
+	CHECK(backend.GetPresentedArea(handle) == 80 * 72 && stats.GetLastFraction() == 1.0) ;
+
+	window.ResetDamageStats() ;
+	CHECK(stats.GetFrameCount() == 0 && stats.GetAverageFraction() == 0.0) ;
+}
+
+int main() {
+	test_random() ;
+	test_full() ;
+	test_clip() ;
+	test_present() ;
+	return test::Result("damage") ;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "check.hpp"
+#include "dispatcher.hpp"
+
+using namespace zz ;
+
+static Event mouse(const Window& window) noexcept {
+	return Event(window.GetHandle(), MouseEvent(MouseState::Move, MouseButton::None, Point<float>{})) ;
+}
+
+// handler per window dipilih lewat cache handle -> tabel, termasuk saat event berganti-ganti window
+static void test_routing() {
+	Window a("a", Size{32, 32}) ;
+	Window b("b", Size{32, 32}) ;
+	int hits_a = 0, hits_b = 0, hits_global = 0 ;
+	Dispatcher dispatcher ;
+	dispatcher.On([&hits_global](const MouseEvent&) { ++hits_global ; }) ;
+	dispatcher.On(a, [&hits_a](const MouseEvent&) { ++hits_a ; }) ;
+	dispatcher.On(b, [&hits_b](const MouseEvent&) { ++hits_b ; }) ;
+
+	for (int i = 0 ; i < 10 ; ++i) {
+		CHECK(dispatcher.Dispatch(mouse(i % 3 == 0 ? b : a))) ;
+	}
+	CHECK(hits_a == 6 && hits_b == 4 && hits_global == 0) ;
+
+	// tipe event tanpa handler per window jatuh ke global, tanpa handler sama sekali -> false
+	CHECK(!dispatcher.Dispatch(Event(a.GetHandle(), KeyEvent(KeyState::Down, KeyCode{})))) ;
+	CHECK(dispatcher.Dispatch(Event(nullptr, MouseEvent(MouseState::Move, MouseButton::None, Point<float>{})))) ;
+	CHECK(hits_global == 1) ;
+
+	// copy punya tabel sendiri, cache-nya tidak menunjuk ke dispatcher asal
+	Dispatcher copy = dispatcher ;
+	copy.Off(a) ;
+	CHECK(copy.Dispatch(mouse(a)) && hits_global == 2) ;
+	CHECK(dispatcher.Dispatch(mouse(a)) && hits_a == 7) ;
+
+	dispatcher.Off(a) ;
+	CHECK(dispatcher.Dispatch(mouse(a)) && hits_global == 3) ;
+	CHECK(dispatcher.Dispatch(mouse(b)) && hits_b == 5) ;
+}
+
+// window ditutup tanpa Off: cache ikut basi, event untuk handle lama tidak lagi masuk handler window
+static void test_closed_window() {
+	int hits_window = 0, hits_global = 0 ;
+	Dispatcher dispatcher ;
+	dispatcher.On([&hits_global](const MouseEvent&) { ++hits_global ; }) ;
+
+	Window a("a", Size{32, 32}) ;
+	dispatcher.On(a, [&hits_window](const MouseEvent&) { ++hits_window ; }) ;
+	const Event stale = mouse(a) ;
+	CHECK(dispatcher.Dispatch(stale) && hits_window == 1) ;
+
+	a.Close() ;
+	CHECK(dispatcher.Dispatch(stale) && hits_window == 1 && hits_global == 1) ;
+
+	// slot dipakai ulang window baru, handler lama tidak boleh ikut terpanggil
+	Window b("b", Size{32, 32}) ;
+	CHECK(dispatcher.Dispatch(mouse(b)) && hits_window == 1 && hits_global == 2) ;
+}
+
+int main() {
+	Application::RegisterWindowClass() ;
+	test_routing() ;
+	test_closed_window() ;
+	return test::Result("dispatcher") ;
+}
\ No newline at end of file
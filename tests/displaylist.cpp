@@ -0,0 +1,245 @@
+#include "check.hpp"
+#include "displaylist.hpp"
+
+using namespace zz ;
+
+// text digambar sebagai kotak penuh, cukup untuk membandingkan hasil Replay
+class BoxText : public TextRenderer {
+public :
+	void DrawText(Rasterizer& raster, const Rect<int>& bound, std::string_view, Color color, uint32_t) override { raster.FillRect(bound, color) ; }
+	Size<int> MeasureText(std::string_view text, uint32_t) override { return Size<int>(static_cast<int>(text.size()) * 8, 16) ; }
+} ;
+
+// rect berjauhan supaya DamageRegion tidak menggabungkannya, damage bisa dibandingkan persis dengan rect yang berubah
+static Rect<int> box(int i) noexcept {
+	return Rect<int>(i * 40, (i % 3) * 40, 20, 20) ;
+}
+
+static void record(DisplayList& list, std::initializer_list<int> order) {
+	for (const int i : order) {
+		list.FillRect(box(i), Color(static_cast<uint8_t>(i * 20), 0, 0, 255)) ;
+	}
+}
+
+static int64_t area_of(std::initializer_list<Rect<int>> rects) noexcept {
+	int64_t area = 0 ;
+	for (const Rect<int>& r : rects) {
+		area += static_cast<int64_t>(r.GetSize().w) * r.GetSize().h ;
+	}
+	return area ;
+}
+
+static bool covers(const DamageRegion& damage, const Rect<int>& r) noexcept {
+	for (const Rect<int>& damaged : damage.GetRects()) {
+		if (zz::Contains(damaged, r)) {
+			return true ;
+		}
+	}
+	return false ;
+}
+
+// damage harus tepat gabungan bound yang berubah: tiap bound tertutup dan luasnya tidak lebih
+static void check_damage(const DisplayList& now, const DisplayList& before, size_t changes, std::initializer_list<Rect<int>> expected) {
+	DamageRegion damage ;
+	CHECK(now.Diff(before, damage) == changes) ;
+	CHECK(damage.GetArea() == area_of(expected)) ;
+	for (const Rect<int>& r : expected) {
+		CHECK(covers(damage, r)) ;
+	}
+}
+
+static void test_diff() {
+	DisplayList before ;
+	record(before, {0, 1, 2, 3, 4, 5}) ;
+
+	DisplayList same ;
+	record(same, {0, 1, 2, 3, 4, 5}) ;
+	DamageRegion damage ;
+	CHECK(same.Diff(before, damage) == 0 && damage.Empty()) ;
+
+	// sisip, hapus dan tukar di tengah: prefix dan suffix yang sama dilewati
+	DisplayList inserted ;
+	record(inserted, {0, 1, 2, 9, 3, 4, 5}) ;
+	check_damage(inserted, before, 1, {box(9)}) ;
+
+	DisplayList removed ;
+	record(removed, {0, 1, 3, 4, 5}) ;
+	check_damage(removed, before, 1, {box(2)}) ;
+
+	DisplayList reordered ;
+	record(reordered, {0, 1, 3, 2, 4, 5}) ;
+	check_damage(reordered, before, 2, {box(2), box(3)}) ;
+
+	// warna berubah di posisi yang sama
+	DisplayList recolored ;
+	record(recolored, {0, 1, 2}) ;
+	recolored.FillRect(box(3), Color(1, 2, 3, 255)) ;
+	record(recolored, {4, 5}) ;
+	check_damage(recolored, before, 1, {box(3)}) ;
+
+	// list kosong: semua perintah lama masuk damage
+	check_damage(DisplayList{}, before, 6, {box(0), box(1), box(2), box(3), box(4), box(5)}) ;
+}
+
+// hanya clip yang berubah: item di dalam clip ikut rusak di area clip lama dan baru, item di luar clip tidak
+static void test_clip() {
+	const Rect<int> inside_a(0, 0, 30, 30) ;
+	const Rect<int> inside_b(200, 0, 30, 30) ;
+	const Rect<int> outside(400, 200, 20, 20) ;
+	const auto build = [&](DisplayList& list, const Rect<int>& clip) {
+		list.PushClip(clip) ;
+		list.FillRect(inside_a, Color(255, 0, 0, 255)) ;
+		list.FillRect(inside_b, Color(0, 255, 0, 255)) ;
+		list.PopClip() ;
+		list.FillRect(outside, Color(0, 0, 255, 255)) ;
+	} ;
+
+	const Rect<int> old_clip(0, 0, 220, 20) ;
+	const Rect<int> new_clip(10, 0, 220, 20) ;
+	DisplayList before ;
+	DisplayList now ;
+	build(before, old_clip) ;
+	build(now, new_clip) ;
+
+	DamageRegion damage ;
+	CHECK(now.Diff(before, damage) == 2) ;
+	for (const Rect<int>& clip : {old_clip, new_clip}) {
+		CHECK(covers(damage, Intersect(inside_a, clip))) ;
+		CHECK(covers(damage, Intersect(inside_b, clip))) ;
+	}
+	CHECK(!damage.Intersects(outside)) ;
+
+	DisplayList unchanged ;
+	build(unchanged, old_clip) ;
+	damage.Clear() ;
+	CHECK(unchanged.Diff(before, damage) == 0 && damage.Empty()) ;
+}
+
+// semua jenis perintah termasuk clip bersarang dan text UTF-8
+static void record_all(DisplayList& list) {
+	list.FillRect(Rect<int>(0, 0, 96, 64), Color(20, 30, 40, 255)) ;
+	list.PushClip(Rect<int>(4, 4, 80, 50)) ;
+	list.FillRoundedRect(Rect<float>(6.5f, 8.25f, 40.0f, 30.0f), 6.0f, Premultiply(Color(200, 120, 40, 180))) ;
+	list.DrawLine(Point<float>(2.0f, 60.0f), Point<float>(90.0f, 3.0f), 2.5f, Color(250, 250, 90, 255)) ;
+	list.PushClip(Rect<int>(30, 10, 40, 40)) ;
+	list.Blit(0, Rect<int>(2, 3, 12, 10), Point<int>(35, 20), 7) ;
+	list.PopClip() ;
+	list.PopClip() ;
+	list.DrawText(Rect<int>(50, 40, 30, 12), "teks \xC3\xA9", Color(10, 200, 90, 255), 3) ;
+}
+
+static bool same(const SurfaceView& a, const SurfaceView& b) noexcept {
+	for (int y = 0 ; y < a.Height() ; ++y) {
+		if (std::memcmp(a.Row(y), b.Row(y), static_cast<size_t>(a.Width()) * sizeof(Color)) != 0) {
+			return false ;
+		}
+	}
+	return true ;
+}
+
+static void render(const DisplayList& list, std::span<const SurfaceView> images, Surface& target) {
+	BoxText text ;
+	Rasterizer raster ;
+	list.Replay(raster, images, &text) ;
+	target.Fill(Color(0, 0, 0, 255)) ;
+	raster.Render(target) ;
+}
+
+static void test_roundtrip() {
+	DisplayList original ;
+	record_all(original) ;
+	const std::vector<uint8_t> bytes = original.Serialize() ;
+
+	DisplayList copy ;
+	CHECK(copy.Deserialize(bytes)) ;
+	CHECK(copy.GetCount() == original.GetCount() && copy.GetByteSize() == original.GetByteSize()) ;
+	CHECK(copy.Serialize() == bytes) ;
+
+	DamageRegion damage ;
+	CHECK(copy.Diff(original, damage) == 0 && damage.Empty()) ;
+
+	Surface image(16, 16) ;
+	for (int y = 0 ; y < image.Height() ; ++y) {
+		for (int x = 0 ; x < image.Width() ; ++x) {
+			image.At(x, y) = Color(static_cast<uint8_t>(x * 16), static_cast<uint8_t>(y * 16), 128, 255) ;
+		}
+	}
+	const SurfaceView images[] = {image} ;
+	Surface expected(96, 64) ;
+	Surface actual(96, 64) ;
+	render(original, images, expected) ;
+	render(copy, images, actual) ;
+	CHECK(same(expected, actual)) ;
+}
+
+// data rusak ditolak dan isi list sebelumnya tetap utuh
+static void test_reject() {
+	DisplayList valid ;
+	record_all(valid) ;
+	const std::vector<uint8_t> good = valid.Serialize() ;
+
+	DisplayList target ;
+	record(target, {0, 1, 2}) ;
+	const std::vector<uint8_t> kept = target.Serialize() ;
+	const size_t count = target.GetCount() ;
+	const auto rejected = [&](std::vector<uint8_t> bytes) {
+		const bool ok = !target.Deserialize(bytes) ;
+		return ok && target.Serialize() == kept && target.GetCount() == count ;
+	} ;
+	const auto patch32 = [](std::vector<uint8_t> bytes, size_t offset, uint32_t value) {
+		std::memcpy(bytes.data() + offset, &value, sizeof(value)) ;
+		return bytes ;
+	} ;
+	const auto patch64 = [](std::vector<uint8_t> bytes, size_t offset, uint64_t value) {
+		std::memcpy(bytes.data() + offset, &value, sizeof(value)) ;
+		return bytes ;
+	} ;
+
+	constexpr size_t header = sizeof(DisplayListHeader) ;
+	constexpr size_t first_size = header + 4 ;		// Record: op, reserved[3], size
+	const uint64_t body = good.size() - header ;
+
+	// terpotong: lebih pendek dari header, dan body terpotong dengan header.size ikut disesuaikan
+	CHECK(rejected(std::vector<uint8_t>(good.begin(), good.begin() + header - 3))) ;
+	CHECK(rejected(std::vector<uint8_t>(good.begin(), good.end() - 8))) ;
+	std::vector<uint8_t> truncated(good.begin(), good.end() - 8) ;
+	CHECK(rejected(patch64(truncated, 8, body - 8))) ;
+
+	// magic dan versi
+	std::vector<uint8_t> magic = good ;
+	magic[0] = 'X' ;
+	CHECK(rejected(magic)) ;
+	CHECK(rejected(patch32(good, 4, 2))) ;
+
+	// ukuran record pertama tidak rata 8, nol, dan melewati buffer
+	const uint32_t first = 32 ;		// FillRect: Record 8 + FillRectData 20, dibulatkan ke 8
+	CHECK(rejected(patch32(good, first_size, first + 4))) ;
+	CHECK(rejected(patch32(good, first_size, 0))) ;
+	CHECK(rejected(patch32(good, first_size, static_cast<uint32_t>(body) + 8))) ;
+
+	// op di luar DisplayOp
+	std::vector<uint8_t> op = good ;
+	op[header] = static_cast<uint8_t>(DisplayOp::Count) ;
+	CHECK(rejected(op)) ;
+
+	// length text melewati record-nya. TextData: bound 16, color 4, font 4, length 4. record 8 + 28 + 3 dibulatkan
+	// ke 40, jadi ruang text 4 byte
+	DisplayList text ;
+	text.DrawText(Rect<int>(0, 0, 10, 10), "abc", Color(1, 2, 3, 255)) ;
+	const std::vector<uint8_t> text_bytes = text.Serialize() ;
+	const size_t length = header + 8 + 24 ;
+	CHECK(DisplayList{}.Deserialize(patch32(text_bytes, length, 4))) ;		// masih di dalam padding record
+	CHECK(rejected(patch32(text_bytes, length, 5))) ;
+	CHECK(rejected(patch32(text_bytes, length, 0xFFFFFFFF))) ;
+
+	// data yang sah tetap diterima setelah semua penolakan
+	CHECK(target.Deserialize(good) && target.Serialize() == good) ;
+}
+
+int main() {
+	test_diff() ;
+	test_clip() ;
+	test_roundtrip() ;
+	test_reject() ;
+	return test::Result("displaylist") ;
+}
\ No newline at end of file
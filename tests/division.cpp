@@ -0,0 +1,118 @@
+#include <cmath>
+#include <random>
+
+#include "check.hpp"
+#include "unit.hpp"
+
+using namespace zz ;
+
+// noexcept mengikuti policy: hanya Div (default, melempar) yang membawa jalur exception
+static_assert(!noexcept(Divide(Point<int>{}, 1))) ;
+static_assert(!noexcept(Point<float>{} / 2.0f)) ;
+static_assert(noexcept(Divide<DivSaturate>(Rect<int>{}, Rect<int>{}))) ;
+static_assert(noexcept(Divide<DivZero>(Size<float>{}, 0.0f))) ;
+static_assert(noexcept(Divide<DivUnchecked>(Point<float>{}, Point<float>{}))) ;
+
+// constexpr tetap jalan untuk policy non-throwing
+static_assert(Divide<DivSaturate>(Point<int>{5, -5}, 0) == Point<int>{std::numeric_limits<int>::max(), std::numeric_limits<int>::min()}) ;
+static_assert(Divide<DivZero>(Point<int>{5, -5}, 0) == Point<int>{0, 0}) ;
+static_assert(Divide<DivUnchecked>(Point<int>{9, -9}, 3) == Point<int>{3, -3}) ;
+
+static std::mt19937 g_random(14) ;
+
+template <typename type>
+static type random_value() {
+	if constexpr (std::is_floating_point_v<type>) {
+		return std::uniform_real_distribution<type>(-1000, 1000)(g_random) ;
+	} else {
+		return std::uniform_int_distribution<type>(std::numeric_limits<type>::min(), std::numeric_limits<type>::max())(g_random) ;
+	}
+}
+
+// pembagi tidak nol: semua policy sama dengan pembagian biasa (selain MIN / -1 yang UB di pembagian biasa)
+template <typename type>
+static void test_nonzero() {
+	for (int round = 0 ; round < 20000 ; ++round) {
+		const type a = random_value<type>() ;
+		type b = random_value<type>() ;
+		if (b == 0 || (std::is_signed_v<type> && std::is_integral_v<type> && a == std::numeric_limits<type>::min() && b == type(-1))) {
+			b = 7 ;
+		}
+		const type expected = a / b ;
+		CHECK(DivChecked{}(a, b) == expected) ;
+		CHECK(DivSaturate{}(a, b) == expected) ;
+		CHECK(DivZero{}(a, b) == expected) ;
+		CHECK(DivUnchecked{}(a, b) == expected) ;
+	}
+}
+
+template <typename type>
+static void test_zero() {
+	using limit = std::numeric_limits<type> ;
+	const type values[] = {type(1), type(0), limit::max(), limit::lowest(), type(limit::max() / 3)} ;
+	for (const type a : values) {
+		bool thrown = false ;
+		try {
+			DivChecked{}(a, type(0)) ;
+		} catch (const Ex::error_logic&) {
+			thrown = true ;
+		}
+		CHECK(thrown) ;
+
+		const type saturated = DivSaturate{}(a, type(0)) ;
+		CHECK(saturated == (a > 0 ? limit::max() : a < 0 ? limit::lowest() : type(0))) ;
+		CHECK(DivZero{}(a, type(0)) == type(0)) ;
+	}
+
+	if constexpr (std::is_signed_v<type> && std::is_integral_v<type>) {
+		CHECK(DivSaturate{}(limit::min(), type(-1)) == limit::max()) ;
+		CHECK(DivZero{}(limit::min(), type(-1)) == limit::min()) ;
+	}
+	if constexpr (std::is_floating_point_v<type>) {
+		// -0 juga nol, tanda pembilang tetap menentukan arah saturasi
+		CHECK(DivSaturate{}(type(-2), type(-0.0)) == limit::lowest()) ;
+		CHECK(DivZero{}(type(3), type(-0.0)) == type(0)) ;
+		CHECK(std::isnan(DivSaturate{}(limit::quiet_NaN(), type(2)))) ;
+	}
+}
+
+// Point/Size/Rect: per komponen, satu komponen nol tidak mempengaruhi komponen lain
+static void test_units() {
+	const Rect<float> r {10.0f, -20.0f, 30.0f, 40.0f} ;
+	CHECK(Divide<DivZero>(r, Rect<float>{2.0f, 0.0f, 3.0f, 0.0f}) == Rect<float>{5.0f, 0.0f, 10.0f, 0.0f}) ;
+	CHECK(Divide<DivSaturate>(r, 0.0f) == Rect<float>{std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()}) ;
+	CHECK(Divide<DivUnchecked>(r, 10.0f) == r / 10.0f) ;
+	CHECK(Divide(r, Rect<float>{1.0f, 2.0f, 3.0f, 4.0f}) == r / Rect<float>{1.0f, 2.0f, 3.0f, 4.0f}) ;
+
+	const Size<int> s {100, 50} ;
+	CHECK(Divide<DivZero>(s, Size<int>{0, 5}) == Size<int>{0, 10}) ;
+	CHECK(Divide<DivSaturate>(s, 0).w == std::numeric_limits<MakeSizeType<int>>::max()) ;
+
+	const Point<int> p {-7, 7} ;
+	CHECK(Divide<DivSaturate>(p, Point<int>{0, 0}) == Point<int>{std::numeric_limits<int>::min(), std::numeric_limits<int>::max()}) ;
+	CHECK(Divide<DivZero>(p, 2) == p / 2) ;
+
+	bool thrown = false ;
+	try {
+		const Point<int> q = p / 0 ;
+		(void)q ;
+	} catch (const Ex::error_logic&) {
+		thrown = true ;
+	}
+	CHECK(thrown) ;
+}
+
+int main() {
+	test_nonzero<int32_t>() ;
+	test_nonzero<int64_t>() ;
+	test_nonzero<uint32_t>() ;
+	test_nonzero<float>() ;
+	test_nonzero<double>() ;
+	test_zero<int32_t>() ;
+	test_zero<int64_t>() ;
+	test_zero<uint32_t>() ;
+	test_zero<float>() ;
+	test_zero<double>() ;
+	test_units() ;
+	return test::Result("division") ;
+}
\ No newline at end of file
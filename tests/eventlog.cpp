@@ -0,0 +1,85 @@
+#include <filesystem>
+
+#include "check.hpp"
+#include "eventsystem.hpp"
+
+using namespace zz ;
+
+static bool same(const Event& a, const Event& b) noexcept {
+	// timestamp digeser ke awal replay (dicek terpisah), sisanya harus sama byte per byte
+	Event x = a ;
+	Event y = b ;
+	x.SetTime(0) ;
+	y.SetTime(0) ;
+	return std::memcmp(&x, &y, sizeof(Event)) == 0 ;
+}
+
+// rekam -> replay menghasilkan urutan yang sama, dan setelah log habis input backend kembali dibaca
+static void test_record_replay(const std::string& path) {
+	HeadlessBackend& backend = static_cast<HeadlessBackend&>(EventSys::GetBackend()) ;
+	const WindowHandle handle = reinterpret_cast<WindowHandle>(uintptr_t(1)) ;
+	constexpr int count = 300 ;		// lebih dari beberapa batch replay
+
+	CHECK(EventSys::StartRecording(path.c_str())) ;
+	for (int i = 0 ; i < count ; ++i) {
+		backend.Inject(Event(handle, MouseEvent(MouseState::Move, MouseButton::None, Point<float>(float(i), float(-i))))) ;
+	}
+	backend.Inject(Event(handle, UserEvent(7, 42))) ;
+
+	std::vector<Event> recorded ;
+	Event event ;
+	while (PollEvent(event)) {
+		recorded.push_back(event) ;
+	}
+	EventSys::StopRecording() ;
+	CHECK(recorded.size() == count + 1) ;
+
+	CHECK(EventSys::StartReplay(path.c_str())) ;
+	CHECK(EventSys::IsReplaying()) ;
+	const uint64_t start = EventSys::GetReplayStats().begin ;
+	// input asli selama replay ditahan di backend sampai replay selesai
+	backend.InjectClose(handle) ;
+
+	size_t index = 0 ;
+	while (PollEvent(event) && index < recorded.size()) {
+		CHECK(same(event, recorded[index])) ;
+		// jarak dari event pertama sama dengan rekaman
+		CHECK(event.GetTime() - start == recorded[index].GetTime() - recorded[0].GetTime()) ;
+		++index ;
+	}
+	CHECK(index == recorded.size()) ;
+	CHECK(!EventSys::IsReplaying()) ;
+	CHECK(EventSys::GetReplayStats().events == recorded.size() && EventSys::GetReplayStats().dropped == 0) ;
+
+	// Close dari backend sudah keluar sebagai event terakhir di loop di atas
+	CHECK(event.IsWindowEvent() && event.GetWindowEvent().GetState() == WindowState::Close) ;
+	CHECK(!PollEvent(event)) ;
+
+	// WaitEvent tidak boleh macet setelah replay selesai
+	backend.InjectMouse(handle, MouseState::Down, MouseButton::Left, Point<float>(1.0f, 2.0f)) ;
+	CHECK(WaitEvent(event, 1000) && event.IsMouseEvent()) ;
+	const uint64_t begin = Now() ;
+	CHECK(!WaitEvent(event, 20)) ;
+	CHECK(Now() - begin < 2'000'000'000ull) ;
+}
+
+// log kosong: replay langsung selesai dan input backend tetap jalan
+static void test_empty_log(const std::string& path) {
+	HeadlessBackend& backend = static_cast<HeadlessBackend&>(EventSys::GetBackend()) ;
+	CHECK(EventSys::StartRecording(path.c_str())) ;
+	EventSys::StopRecording() ;
+
+	CHECK(EventSys::StartReplay(path.c_str())) ;
+	backend.InjectClose(reinterpret_cast<WindowHandle>(uintptr_t(1))) ;
+	Event event ;
+	CHECK(PollEvent(event) && event.IsWindowEvent()) ;
+	CHECK(!EventSys::IsReplaying()) ;
+}
+
+int main() {
+	const std::string path = (std::filesystem::temp_directory_path() / "zz_test_eventlog.bin").string() ;
+	test_record_replay(path) ;
+	test_empty_log(path) ;
+	std::filesystem::remove(path) ;
+	return test::Result("eventlog") ;
+}
\ No newline at end of file
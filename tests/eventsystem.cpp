@@ -0,0 +1,142 @@
+#include "check.hpp"
+#include "window.hpp"
+
+using namespace zz ;
+
+static std::vector<Event> drain() {
+	std::vector<Event> events ;
+	Event event ;
+	while (PollEvent(event)) {
+		events.push_back(event) ;
+	}
+	return events ;
+}
+
+static bool is_mouse(const Event& e, WindowHandle handle, MouseState state, Point<float> value) noexcept {
+	if (!e.IsMouseEvent() || e.GetHandle() != handle || e.GetMouseEvent().GetState() != state) {
+		return false ;
+	}
+	const MouseEvent& mouse = e.GetMouseEvent() ;
+	return (state == MouseState::Wheel ? mouse.GetDelta() : mouse.GetPosition()) == value ;
+}
+
+static bool is_window(const Event& e, WindowHandle handle, WindowState state, Size<uint16_t> size = {}) noexcept {
+	return e.IsWindowEvent() && e.GetHandle() == handle && e.GetWindowEvent().GetState() == state && (state != WindowState::Resize || e.GetWindowEvent().GetValue() == size) ;
+}
+
+// hanya event berurutan dengan tipe, state dan window yang sama yang digabung; event lain di antaranya memutus
+static void test_coalesce() {
+	Application::RegisterWindowClass() ;
+	Window a("a", Size{64, 64}) ;
+	Window b("b", Size{64, 64}) ;
+	HeadlessBackend& backend = static_cast<HeadlessBackend&>(Application::GetBackend()) ;
+	const WindowHandle ha = a.GetHandle() ;
+	const WindowHandle hb = b.GetHandle() ;
+	drain() ;
+
+	EventSys::SetCoalesce(Coalesce::All) ;
+	EventSys::ResetStats() ;
+
+	// Move, Down, Move: Move sebelum dan sesudah Down tetap terpisah. Move window lain memutus rangkaian
+	backend.InjectMouse(ha, MouseState::Move, MouseButton::None, Point<float>(1.0f, 1.0f)) ;
+	backend.InjectMouse(ha, MouseState::Move, MouseButton::None, Point<float>(2.0f, 2.0f)) ;
+	backend.InjectMouse(ha, MouseState::Down, MouseButton::Left, Point<float>(2.0f, 2.0f)) ;
+	backend.InjectMouse(ha, MouseState::Move, MouseButton::None, Point<float>(3.0f, 3.0f)) ;
+	backend.InjectMouse(ha, MouseState::Move, MouseButton::None, Point<float>(4.0f, 4.0f)) ;
+	backend.InjectMouse(hb, MouseState::Move, MouseButton::None, Point<float>(5.0f, 5.0f)) ;
+	backend.InjectMouse(ha, MouseState::Move, MouseButton::None, Point<float>(6.0f, 6.0f)) ;
+	std::vector<Event> events = drain() ;
+	CHECK(events.size() == 5) ;
+	if (events.size() == 5) {
+		CHECK(is_mouse(events[0], ha, MouseState::Move, Point<float>(2.0f, 2.0f))) ;
+		CHECK(is_mouse(events[1], ha, MouseState::Down, Point<float>(2.0f, 2.0f))) ;
+		CHECK(is_mouse(events[2], ha, MouseState::Move, Point<float>(4.0f, 4.0f))) ;
+		CHECK(is_mouse(events[3], hb, MouseState::Move, Point<float>(5.0f, 5.0f))) ;
+		CHECK(is_mouse(events[4], ha, MouseState::Move, Point<float>(6.0f, 6.0f))) ;
+		CHECK(events[0].GetTime() <= events[1].GetTime()) ;		// waktu event pertama rangkaian yang dipakai
+	}
+	CHECK(EventSys::GetStats().merged_move == 2 && EventSys::GetStats().Merged() == 2) ;
+
+	// delta wheel dijumlahkan, wheel window lain tidak ikut
+	backend.InjectMouse(ha, MouseState::Wheel, MouseButton::None, Point<float>(0.0f, 1.0f)) ;
+	backend.InjectMouse(ha, MouseState::Wheel, MouseButton::None, Point<float>(0.0f, 1.0f)) ;
+	backend.InjectMouse(ha, MouseState::Wheel, MouseButton::None, Point<float>(0.5f, -3.0f)) ;
+	backend.InjectMouse(hb, MouseState::Wheel, MouseButton::None, Point<float>(0.0f, 2.0f)) ;
+	events = drain() ;
+	CHECK(events.size() == 2) ;
+	if (events.size() == 2) {
+		CHECK(is_mouse(events[0], ha, MouseState::Wheel, Point<float>(0.5f, -1.0f))) ;
+		CHECK(is_mouse(events[1], hb, MouseState::Wheel, Point<float>(0.0f, 2.0f))) ;
+	}
+	CHECK(EventSys::GetStats().merged_wheel == 2) ;
+
+	// Resize berurutan tinggal ukuran terakhir, Close di antaranya memutus, window lain tidak digabung
+	backend.InjectResize(ha, Size<int>(100, 80)) ;
+	backend.InjectResize(ha, Size<int>(120, 90)) ;
+	backend.InjectResize(ha, Size<int>(130, 95)) ;
+	backend.InjectResize(hb, Size<int>(40, 40)) ;
+	backend.InjectResize(hb, Size<int>(50, 50)) ;
+	backend.InjectClose(hb) ;
+	backend.InjectResize(hb, Size<int>(60, 60)) ;
+	events = drain() ;
+	CHECK(events.size() == 4) ;
+	if (events.size() == 4) {
+		CHECK(is_window(events[0], ha, WindowState::Resize, Size<uint16_t>{130, 95})) ;
+		CHECK(is_window(events[1], hb, WindowState::Resize, Size<uint16_t>{50, 50})) ;
+		CHECK(is_window(events[2], hb, WindowState::Close)) ;
+		CHECK(is_window(events[3], hb, WindowState::Resize, Size<uint16_t>{60, 60})) ;
+	}
+
+	const EventStats& stats = EventSys::GetStats() ;
+	CHECK(stats.merged_resize == 3 && stats.Merged() == 7) ;
+	CHECK(stats.pushed == 18 && stats.dropped == 0) ;
+
+	// hanya jenis yang diminta: Move tidak digabung kalau mode-nya Resize saja
+	EventSys::SetCoalesce(Coalesce::Resize) ;
+	backend.InjectMouse(ha, MouseState::Move, MouseButton::None, Point<float>(1.0f, 1.0f)) ;
+	backend.InjectMouse(ha, MouseState::Move, MouseButton::None, Point<float>(2.0f, 2.0f)) ;
+	CHECK(drain().size() == 2 && stats.merged_move == 2) ;
+	EventSys::SetCoalesce(Coalesce::None) ;
+}
+
+// event yang ditimpa DropOldest dan yang ditolak DropNewest sama-sama masuk dropped
+static void test_dropped() {
+	Application::RegisterWindowClass() ;
+	Window window("dropped", Size{64, 64}) ;
+	const WindowHandle handle = window.GetHandle() ;
+	drain() ;
+	const auto push = [handle](size_t count) {
+		for (size_t i = 0 ; i < count ; ++i) {
+			EventSys::PushEvent(Event{handle, MouseEvent{MouseState::Move, MouseButton::None, Point<float>(static_cast<float>(i), 0.0f)}}) ;
+		}
+	} ;
+
+	EventSys::ResetStats() ;
+	EventSys::SetQueuePolicy(QueuePolicy::DropOldest, 256) ;
+	push(300) ;
+	CHECK(EventSys::GetStats().pushed == 300 && EventSys::GetStats().dropped == 44) ;
+	std::vector<Event> events = drain() ;
+	CHECK(events.size() == 256) ;
+	CHECK(!events.empty() && is_mouse(events.front(), handle, MouseState::Move, Point<float>(44.0f, 0.0f))) ;
+
+	EventSys::ResetStats() ;
+	EventSys::SetQueuePolicy(QueuePolicy::DropNewest, 256) ;
+	push(300) ;
+	CHECK(EventSys::GetStats().dropped == 44) ;
+	events = drain() ;
+	CHECK(events.size() == 256) ;
+	CHECK(!events.empty() && is_mouse(events.back(), handle, MouseState::Move, Point<float>(255.0f, 0.0f))) ;
+
+	// Grow tidak membuang apa pun selama masih di bawah batas
+	EventSys::ResetStats() ;
+	EventSys::SetQueuePolicy(QueuePolicy::Grow, 256 * 64) ;
+	push(300) ;
+	CHECK(drain().size() == 300 && EventSys::GetStats().dropped == 0) ;
+	EventSys::ClearEvent() ;
+}
+
+int main() {
+	test_coalesce() ;
+	test_dropped() ;
+	return test::Result("eventsystem") ;
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "check.hpp"
+#include "font.hpp"
+
+using namespace zz ;
+
+// BitmapFont size 8 = glyph 5x7 (advance 6), size 16 = glyph 10x14. atlas 20 piksel muat 4 glyph kecil atau 2 besar
+// per shelf, jadi beberapa string pendek sudah memaksa reclaim
+struct Fixture {
+	BitmapFont bitmap {} ;
+	FontCache cache ;
+	FontCache reference {} ;	// atlas default, tidak pernah penuh di test ini
+	uint32_t small = 0 ;
+	uint32_t big = 0 ;
+
+	Fixture(int width, int height) : cache(width, height, 64) {
+		small = cache.AddFont(bitmap, 8) ;
+		big = cache.AddFont(bitmap, 16) ;
+		reference.AddFont(bitmap, 8) ;
+		reference.AddFont(bitmap, 16) ;
+	}
+
+	// semua baris digambar dalam satu frame lalu baru di-Render: reclaim di tengah frame tidak boleh merusak texel
+	// glyph yang sudah direkam. hasilnya dibandingkan dengan cache acuan
+	bool draw(std::initializer_list<std::pair<uint32_t, std::string_view>> lines) {
+		Rasterizer raster ;
+		Rasterizer expected_raster ;
+		int y = 0 ;
+		for (const auto& [font, text] : lines) {
+			const Rect<int> bound(0, y, 128, 20) ;
+			cache.DrawText(raster, bound, text, Color(255, 255, 255, 255), font) ;
+			reference.DrawText(expected_raster, bound, text, Color(255, 255, 255, 255), font) ;
+			y += 20 ;
+		}
+
+		Surface actual(128, y) ;
+		Surface expected(128, y) ;
+		actual.Fill(Color(0, 0, 0, 255)) ;
+		expected.Fill(Color(0, 0, 0, 255)) ;
+		raster.Render(actual) ;
+		expected_raster.Render(expected) ;
+
+		bool inked = false ;
+		for (int row = 0 ; row < actual.Height() ; ++row) {
+			if (std::memcmp(actual.Row(row), expected.Row(row), static_cast<size_t>(actual.Width()) * sizeof(Color)) != 0) {
+				return false ;
+			}
+			for (const Color c : actual.RowSpan(row)) {
+				inked = inked || c.r != 0 ;
+			}
+		}
+		return inked ;
+	}
+} ;
+
+static bool stats(const FontCache& cache, uint64_t run_hits, uint64_t run_misses, uint64_t glyph_hits, uint64_t glyph_misses, uint64_t evictions) {
+	const FontCacheStats& s = cache.GetStats() ;
+	return s.run_hits == run_hits && s.run_misses == run_misses && s.glyph_hits == glyph_hits && s.glyph_misses == glyph_misses && s.evictions == evictions ;
+}
+
+// atlas 20x14 = dua shelf kecil. urutan frame dan hitungan hit/miss di-skrip, jadi statistik harus tepat
+static void test_eviction() {
+	Fixture f(20, 14) ;
+	FontCache& cache = f.cache ;
+
+	cache.BeginFrame() ;
+	CHECK(cache.Measure(f.small, "ABCD").w == 24) ;
+	cache.Measure(f.small, "ABCD") ;		// run hit, epoch sama jadi glyph tidak dicari lagi
+	CHECK(stats(cache, 1, 1, 0, 4, 0)) ;
+
+	cache.BeginFrame() ;
+	cache.Measure(f.small, "EFGH") ;
+	CHECK(stats(cache, 1, 2, 0, 8, 0) && cache.GetGlyphCount() == 8) ;
+
+	// EFGH dipakai frame ini, IJKL harus mengambil shelf ABCD. texel EFGH tetap utuh sampai Render
+	cache.BeginFrame() ;
+	CHECK(f.draw({{f.small, "EFGH"}, {f.small, "IJKL"}})) ;
+	CHECK(stats(cache, 2, 3, 0, 12, 1) && cache.GetGlyphCount() == 8) ;
+
+	// epoch berubah: run EFGH di-layout ulang sekali, semua glyph-nya masih ada (hit), berikutnya tanpa lookup glyph
+	cache.Measure(f.small, "EFGH") ;
+	CHECK(stats(cache, 3, 3, 4, 12, 1)) ;
+	cache.Measure(f.small, "EFGH") ;
+	cache.Measure(f.small, "IJKL") ;		// di-layout setelah reclaim, epoch-nya sudah yang baru
+	CHECK(stats(cache, 5, 3, 4, 12, 1)) ;
+
+	// ABCD sudah dikosongkan: run hit tapi glyph-nya miss dan mengambil shelf yang paling atas (IJKL)
+	cache.BeginFrame() ;
+	CHECK(cache.Measure(f.small, "ABCD").w == 24) ;
+	CHECK(stats(cache, 6, 3, 4, 16, 2)) ;
+	cache.Measure(f.small, "EFGH") ;
+	CHECK(stats(cache, 7, 3, 8, 16, 2)) ;
+
+	// kedua shelf dipakai frame ini: glyph baru gagal, tidak ada yang dikosongkan
+	CHECK(cache.Measure(f.small, "MNOP").w == 0) ;
+	CHECK(stats(cache, 7, 4, 8, 20, 2) && cache.GetGlyphCount() == 8) ;
+	const FontCacheStats& s = cache.GetStats() ;
+	CHECK(s.GetGlyphHitRate() == 8.0 / 28.0 && s.GetRunHitRate() == 7.0 / 11.0) ;
+	CHECK(f.draw({{f.small, "ABCD"}, {f.small, "EFGH"}})) ;
+	CHECK(stats(cache, 9, 4, 8, 20, 2)) ;
+	cache.ResetStats() ;
+	CHECK(stats(cache, 0, 0, 0, 0, 0) && s.GetGlyphHitRate() == 0.0) ;
+}
+
+// atlas 20x28: tiga shelf kecil (y 0, 7, 14) dan 7 baris sisa di bawah. glyph besar (14) memakai shelf paling bawah
+// ditambah sisa atlas, lalu menggabung dua shelf kecil, lalu shelf besar dipecah lagi untuk glyph kecil
+static void test_merge_split() {
+	Fixture f(20, 28) ;
+	FontCache& cache = f.cache ;
+
+	for (const std::string_view text : {"ABCD", "EFGH", "IJKL"}) {
+		cache.BeginFrame() ;
+		cache.Measure(f.small, text) ;
+	}
+	cache.BeginFrame() ;
+	cache.Measure(f.small, "ABCD") ;
+	cache.Measure(f.small, "EFGH") ;
+	CHECK(cache.GetGlyphCount() == 12 && cache.GetStats().evictions == 0) ;
+
+	// IJKL (shelf bawah) paling lama, 7 baris + 7 sisa atlas cukup untuk W. ABCD dipakai frame ini
+	cache.BeginFrame() ;
+	CHECK(f.draw({{f.small, "ABCD"}, {f.big, "W"}})) ;
+	CHECK(cache.GetGlyphCount() == 9 && cache.GetStats().evictions == 1) ;
+
+	// X masih muat di shelf W. Y menggabung shelf ABCD dan EFGH (bersebelahan, tidak dipakai frame ini), Z ikut di sana
+	cache.BeginFrame() ;
+	CHECK(f.draw({{f.big, "WXYZ"}})) ;
+	CHECK(cache.GetGlyphCount() == 4 && cache.GetStats().evictions == 3) ;
+
+	// glyph kecil memecah shelf besar: Y dan Z dikosongkan, sisa 7 baris menjadi shelf baru. setelah itu W dan X
+	// dipecah dengan cara yang sama, glyph yang sudah dipakai frame ini tetap utuh
+	cache.BeginFrame() ;
+	cache.ResetStats() ;
+	CHECK(f.draw({{f.small, "MNOPQRSTUV"}})) ;
+	CHECK(cache.GetGlyphCount() == 10 && stats(cache, 0, 1, 0, 10, 2)) ;
+
+	// semua glyph run tadi masih ada setelah epoch berubah
+	cache.Measure(f.small, "MNOPQRSTUV") ;
+	CHECK(stats(cache, 1, 1, 0, 10, 2)) ;
+	cache.BeginFrame() ;
+	CHECK(f.draw({{f.small, "MNOPQRSTUV"}, {f.small, "MNOP"}})) ;
+	CHECK(cache.GetStats().glyph_misses == 10 && cache.GetStats().evictions == 2) ;
+}
+
+int main() {
+	test_eviction() ;
+	test_merge_split() ;
+	return test::Result("font") ;
+}
\ No newline at end of file
@@ -0,0 +1,254 @@
+#include <cmath>
+#include <random>
+
+#include "check.hpp"
+#include "geometry.hpp"
+
+using namespace zz ;
+
+static std::mt19937 g_random(13) ;
+
+static int random_int(int lo, int hi) {
+	return std::uniform_int_distribution<int>(lo, hi)(g_random) ;
+}
+
+// referensi naif: cabang biasa, tepi dihitung dengan EdgeType seperti geometry.hpp
+namespace naive {
+	template <Arithmetic type>
+	struct Edges {
+		EdgeType<type> x0, y0, x1, y1 ;
+	} ;
+
+	template <Arithmetic type>
+	Edges<type> edges(const Rect<type>& r) {
+		return {r.GetPoint().x, r.GetPoint().y, Right(r), Bottom(r)} ;
+	}
+
+	template <Arithmetic type>
+	bool empty(const Rect<type>& r) {
+		if (!(r.GetSize().w > 0)) {
+			return true ;
+		}
+		return !(r.GetSize().h > 0) ;
+	}
+
+	template <Arithmetic type>
+	bool contains(const Rect<type>& r, const Point<type>& p) {
+		const Edges<type> e = edges(r) ;
+		if (empty(r)) {
+			return false ;
+		}
+		return p.x >= e.x0 && p.x < e.x1 && p.y >= e.y0 && p.y < e.y1 ;
+	}
+
+	template <Arithmetic type>
+	bool intersects(const Rect<type>& a, const Rect<type>& b) {
+		if (empty(a) || empty(b)) {
+			return false ;
+		}
+		const Edges<type> ea = edges(a), eb = edges(b) ;
+		return ea.x0 < eb.x1 && eb.x0 < ea.x1 && ea.y0 < eb.y1 && eb.y0 < ea.y1 ;
+	}
+
+	template <Arithmetic type>
+	bool contains(const Rect<type>& outer, const Rect<type>& inner) {
+		if (empty(outer) || empty(inner)) {
+			return false ;
+		}
+		const Edges<type> o = edges(outer), i = edges(inner) ;
+		return i.x0 >= o.x0 && i.y0 >= o.y0 && i.x1 <= o.x1 && i.y1 <= o.y1 ;
+	}
+}
+
+// geometri kecil di grid integer: setiap titik grid dicek, jadi hasil Intersect/Union/Contains dibandingkan dengan
+// himpunan titik yang benar-benar tercakup. step 0.25 untuk float dengan tepi kelipatan 0.5
+template <Arithmetic type>
+static void check_by_sampling(const Rect<type>& a, const Rect<type>& b, type lo, type hi, type step) {
+	const Rect<type> both = Intersect(a, b) ;
+	const Rect<type> either = Union(a, b) ;
+	bool any_a = false, any_both = false, b_inside_a = true, any_b = false ;
+	for (type y = lo ; y < hi ; y += step) {
+		for (type x = lo ; x < hi ; x += step) {
+			const Point<type> p {x, y} ;
+			const bool in_a = Contains(a, p) ;
+			const bool in_b = Contains(b, p) ;
+			CHECK(in_a == naive::contains(a, p)) ;
+			CHECK(Contains(both, p) == (in_a && in_b)) ;
+			if (in_a || in_b) {
+				CHECK(Contains(either, p)) ;
+			}
+			any_a |= in_a ;
+			any_b |= in_b ;
+			any_both |= in_a && in_b ;
+			b_inside_a &= !in_b || in_a ;
+		}
+	}
+	CHECK(IsEmpty(a) == !any_a) ;
+	CHECK(IsEmpty(both) == !any_both) ;
+	CHECK(Intersects(a, b) == any_both) ;
+	CHECK(Intersects(a, b) == naive::intersects(a, b)) ;
+	CHECK(Contains(a, b) == (any_a && any_b && b_inside_a)) ;
+	CHECK(Contains(a, b) == naive::contains(a, b)) ;
+	CHECK(ClipTo(a, b) == both) ;
+
+	// union = bounding box dua rect yang tidak kosong
+	if (!IsEmpty(a) && !IsEmpty(b)) {
+		CHECK(either.GetPoint().x == std::min(a.GetPoint().x, b.GetPoint().x)) ;
+		CHECK(either.GetPoint().y == std::min(a.GetPoint().y, b.GetPoint().y)) ;
+		CHECK(Right(either) == std::max(Right(a), Right(b))) ;
+		CHECK(Bottom(either) == std::max(Bottom(a), Bottom(b))) ;
+	} else {
+		CHECK(either == (IsEmpty(a) ? b : a)) ;
+	}
+}
+
+static void test_int_small() {
+	for (int round = 0 ; round < 3000 ; ++round) {
+		const Rect<int> a {random_int(-6, 6), random_int(-6, 6), random_int(0, 5), random_int(0, 5)} ;
+		Rect<int> b {random_int(-6, 6), random_int(-6, 6), random_int(0, 5), random_int(0, 5)} ;
+		// sebagian kasus dibuat bersentuhan tepi: b mulai tepat di tepi kanan/bawah a
+		if (round % 4 == 0) {
+			b = Rect<int>{static_cast<int>(Right(a)), a.GetPoint().y, b.GetSize().w, b.GetSize().h} ;
+		} else if (round % 4 == 1) {
+			b = Rect<int>{a.GetPoint().x, static_cast<int>(Bottom(a)), b.GetSize().w, b.GetSize().h} ;
+		}
+		check_by_sampling(a, b, -8, 14, 1) ;
+	}
+}
+
+static void test_float_small() {
+	const auto half = [] (int lo, int hi) { return static_cast<float>(random_int(lo, hi)) * 0.5f ; } ;
+	const float nan = std::numeric_limits<float>::quiet_NaN() ;
+	for (int round = 0 ; round < 1500 ; ++round) {
+		Rect<float> a {half(-8, 8), half(-8, 8), half(-2, 6), half(-2, 6)} ;		// ukuran negatif = kosong
+		Rect<float> b {half(-8, 8), half(-8, 8), half(0, 6), half(0, 6)} ;
+		if (round % 5 == 0) {
+			b = Rect<float>{Right(a), a.GetPoint().y, b.GetSize().w, b.GetSize().h} ;
+		} else if (round % 5 == 1) {
+			a = Rect<float>{a.GetPoint().x, a.GetPoint().y, nan, a.GetSize().h} ;
+		}
+		check_by_sampling(a, b, -6.0f, 8.0f, 0.25f) ;
+	}
+}
+
+// koordinat di ujung range: tepi kanan melewati INT_MAX, ukuran sampai UINT_MAX
+static void test_int_extremes() {
+	constexpr int imin = std::numeric_limits<int>::min() ;
+	constexpr int imax = std::numeric_limits<int>::max() ;
+	constexpr unsigned umax = std::numeric_limits<unsigned>::max() ;
+	const int positions[] = {imin, imin + 1, -1, 0, 1, imax - 1, imax} ;
+	const unsigned sizes[] = {0, 1, 2, 0x7FFFFFFFu, 0x80000000u, umax - 1, umax} ;
+
+	for (int round = 0 ; round < 20000 ; ++round) {
+		const auto pick_position = [&] { return random_int(0, 7) == 7 ? random_int(imin, imax) : positions[random_int(0, 6)] ; } ;
+		const auto pick_size = [&] { return random_int(0, 7) == 7 ? static_cast<unsigned>(random_int(0, imax)) : sizes[random_int(0, 6)] ; } ;
+		const Rect<int> a {pick_position(), pick_position(), pick_size(), pick_size()} ;
+		const Rect<int> b {pick_position(), pick_position(), pick_size(), pick_size()} ;
+		const Point<int> p {pick_position(), pick_position()} ;
+
+		CHECK(IsEmpty(a) == naive::empty(a)) ;
+		CHECK(Contains(a, p) == naive::contains(a, p)) ;
+		CHECK(Intersects(a, b) == naive::intersects(a, b)) ;
+		CHECK(Contains(a, b) == naive::contains(a, b)) ;
+
+		// irisan selalu muat di Rect<int>: titik awal salah satu x/y asli, ukuran <= ukuran asli
+		const Rect<int> both = Intersect(a, b) ;
+		if (naive::intersects(a, b)) {
+			CHECK(both.GetPoint().x == std::max(a.GetPoint().x, b.GetPoint().x)) ;
+			CHECK(both.GetPoint().y == std::max(a.GetPoint().y, b.GetPoint().y)) ;
+			CHECK(Right(both) == std::min(Right(a), Right(b))) ;
+			CHECK(Bottom(both) == std::min(Bottom(a), Bottom(b))) ;
+		} else {
+			CHECK(IsEmpty(both)) ;
+		}
+		CHECK(Contains(both, p) == (naive::contains(a, p) && naive::contains(b, p))) ;
+
+		// union yang lebih lebar dari UINT_MAX disaturasi, tidak pernah lebih kecil dari salah satu input
+		const Rect<int> either = Union(a, b) ;
+		if (!naive::empty(a) && !naive::empty(b)) {
+			const int64_t x1 = std::max(Right(a), Right(b)) ;
+			const int64_t y1 = std::max(Bottom(a), Bottom(b)) ;
+			const int64_t x0 = std::min(a.GetPoint().x, b.GetPoint().x) ;
+			const int64_t y0 = std::min(a.GetPoint().y, b.GetPoint().y) ;
+			CHECK(either.GetPoint().x == x0 && either.GetPoint().y == y0) ;
+			CHECK(either.GetSize().w == std::min<int64_t>(x1 - x0, umax)) ;
+			CHECK(either.GetSize().h == std::min<int64_t>(y1 - y0, umax)) ;
+			// satu-satunya titik yang tidak bisa diwakili: jarak tepat UINT_MAX dari x0/y0 (INT_MIN .. INT_MAX)
+			const bool representable = int64_t(p.x) - x0 < int64_t(umax) && int64_t(p.y) - y0 < int64_t(umax) ;
+			if ((naive::contains(a, p) || naive::contains(b, p)) && representable) {
+				CHECK(Contains(either, p)) ;
+			}
+		}
+	}
+}
+
+// float besar (tepi jadi inf) dan NaN dibandingkan dengan referensi naif yang memakai aritmatika float yang sama
+static void test_float_extremes() {
+	const float values[] = {
+		-std::numeric_limits<float>::max(), -1e30f, -1.0f, -0.0f, 0.0f, 1e-30f, 0.5f, 1.0f, 1e30f,
+		std::numeric_limits<float>::max(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()
+	} ;
+	const auto pick = [&] { return values[random_int(0, 11)] ; } ;
+	for (int round = 0 ; round < 20000 ; ++round) {
+		const Rect<float> a {pick(), pick(), pick(), pick()} ;
+		const Rect<float> b {pick(), pick(), pick(), pick()} ;
+		const Point<float> p {pick(), pick()} ;
+		CHECK(IsEmpty(a) == naive::empty(a)) ;
+		CHECK(Contains(a, p) == naive::contains(a, p)) ;
+		CHECK(Intersects(a, b) == naive::intersects(a, b)) ;
+		CHECK(Contains(a, b) == naive::contains(a, b)) ;
+		if (!naive::intersects(a, b)) {
+			CHECK(IsEmpty(Intersect(a, b))) ;
+		}
+	}
+}
+
+// varian batch satu titik vs N rect dibandingkan dengan loop Contains biasa
+template <Arithmetic type>
+static void check_batch(const std::vector<Rect<type>>& rects, const Point<type>& p, const Rect<type>& clip) {
+	size_t top = rects.size() ;
+	std::vector<uint32_t> all ;
+	for (size_t i = 0 ; i < rects.size() ; ++i) {
+		if (naive::contains(rects[i], p)) {
+			top = i ;
+			all.push_back(static_cast<uint32_t>(i)) ;
+		}
+	}
+
+	CHECK(HitTest(std::span<const Rect<type>>(rects), p) == top) ;
+	CHECK(HitTest(RectArray<type>(std::span<const Rect<type>>(rects)), p) == top) ;
+	std::vector<uint32_t> hits ;
+	CHECK(HitTestAll(std::span<const Rect<type>>(rects), p, hits) == all.size()) ;
+	CHECK(hits == all) ;
+
+	std::vector<Rect<type>> clipped = rects ;
+	ClipTo(std::span(clipped), clip) ;
+	for (size_t i = 0 ; i < rects.size() ; ++i) {
+		CHECK(clipped[i] == Intersect(rects[i], clip)) ;
+	}
+}
+
+static void test_batch() {
+	for (int round = 0 ; round < 500 ; ++round) {
+		const size_t count = static_cast<size_t>(random_int(0, 40)) ;
+		std::vector<Rect<int>> irects(count) ;
+		std::vector<Rect<float>> frects(count) ;
+		for (size_t i = 0 ; i < count ; ++i) {
+			irects[i] = Rect<int>{random_int(-20, 20), random_int(-20, 20), random_int(0, 30), random_int(0, 30)} ;
+			frects[i] = Rect<float>(irects[i]) ;
+		}
+		const Point<int> p {random_int(-25, 25), random_int(-25, 25)} ;
+		const Rect<int> clip {random_int(-10, 10), random_int(-10, 10), random_int(0, 20), random_int(0, 20)} ;
+		check_batch(irects, p, clip) ;
+		check_batch(frects, Point<float>(p), Rect<float>(clip)) ;
+	}
+}
+
+int main() {
+	test_int_small() ;
+	test_float_small() ;
+	test_int_extremes() ;
+	test_float_extremes() ;
+	test_batch() ;
+	return test::Result("geometry") ;
+}
\ No newline at end of file
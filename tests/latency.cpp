@@ -0,0 +1,74 @@
+#include <thread>
+
+#include "check.hpp"
+#include "dispatcher.hpp"
+
+using namespace zz ;
+
+// ketiga histogram terisi dari jalur normal aplikasi: PollEvent -> Dispatch -> Window::Present
+static void test_pipeline() {
+	Application::RegisterWindowClass() ;
+	Window window("latency", Size{64, 64}) ;
+	window.SetShowMode(WindowShowMode::Show) ;
+	HeadlessBackend& backend = static_cast<HeadlessBackend&>(Application::GetBackend()) ;
+
+	Latency::Reset() ;
+	Latency::Enable() ;
+
+	int mouse = 0 ;
+	Dispatcher dispatcher ;
+	dispatcher.On(window, [&mouse](const MouseEvent&) {
+		++mouse ;
+		std::this_thread::sleep_for(std::chrono::microseconds(200)) ;
+	}) ;
+
+	backend.InjectMouse(window.GetHandle(), MouseState::Move, MouseButton::None, Point<float>(3.0f, 4.0f)) ;
+	backend.InjectMouse(window.GetHandle(), MouseState::Down, MouseButton::Left, Point<float>(3.0f, 4.0f)) ;
+	Event event ;
+	uint64_t polled = 0 ;
+	while (PollEvent(event)) {
+		dispatcher.Dispatch(event) ;
+		++polled ;
+	}
+	CHECK(mouse == 2) ;
+	CHECK(Latency::GetDwell().Count() == polled) ;
+	CHECK(Latency::GetDispatch().Count() == polled) ;
+	CHECK(Latency::GetDispatch().Max() >= 200'000) ;
+	CHECK(Latency::GetPresent().Count() == 0) ;
+
+	Surface surface(64, 64) ;
+	window.InvalidateAll() ;
+	CHECK(window.Present(surface)) ;
+	CHECK(Latency::GetPresent().Count() == 1) ;
+	CHECK(Latency::GetPresent().Min() >= 200'000) ;
+
+	// tanpa input baru, atau tanpa piksel yang dikirim, tidak ada sampel present baru
+	window.InvalidateAll() ;
+	window.Present(surface) ;
+	backend.InjectMouse(window.GetHandle(), MouseState::Move, MouseButton::None, Point<float>(5.0f, 5.0f)) ;
+	while (PollEvent(event)) {
+		dispatcher.Dispatch(event) ;
+	}
+	window.Present(surface) ;
+	CHECK(Latency::GetPresent().Count() == 1) ;
+	window.InvalidateAll() ;
+	window.Present(surface) ;
+	CHECK(Latency::GetPresent().Count() == 2) ;
+
+	// StaticDispatcher ikut tercatat
+	const uint64_t before = Latency::GetDispatch().Count() ;
+	StaticDispatcher fast([](const KeyEvent&) {}) ;
+	fast.Dispatch(Event(window.GetHandle(), KeyEvent(KeyState::Down, KeyCode{}))) ;
+	CHECK(Latency::GetDispatch().Count() == before + 1) ;
+
+	// mati: tidak ada yang direkam
+	Latency::Enable(false) ;
+	dispatcher.Dispatch(Event(window.GetHandle(), MouseEvent(MouseState::Move, MouseButton::None, Point<float>{}))) ;
+	CHECK(Latency::GetDispatch().Count() == before + 1) ;
+	window.Close() ;
+}
+
+int main() {
+	test_pipeline() ;
+	return test::Result("latency") ;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <thread>
+
+#include "check.hpp"
+#include "eventsystem.hpp"
+
+using namespace zz ;
+
+static constexpr uint32_t producer_count = 8 ;
+static constexpr uint32_t per_producer = 50000 ;
+
+// tiap producer mengirim 0..per_producer-1. konsumen mengecek nomor berikutnya per producer, jadi event yang hilang,
+// dobel atau tertukar urutannya langsung ketahuan
+struct Tracker {
+	uint32_t next[producer_count] = {} ;
+	uint64_t received = 0 ;
+	uint64_t bad_producer = 0 ;
+	uint64_t out_of_order = 0 ;
+
+	void Take(uint32_t producer, uint32_t sequence) noexcept {
+		++received ;
+		if (producer >= producer_count) {
+			++bad_producer ;
+		} else if (sequence != next[producer]++) {
+			++out_of_order ;
+		}
+	}
+
+	void Verify() const {
+		CHECK(received == uint64_t(producer_count) * per_producer) ;
+		CHECK(bad_producer == 0) ;
+		CHECK(out_of_order == 0) ;
+		for (uint32_t p = 0 ; p < producer_count ; ++p) {
+			CHECK(next[p] == per_producer) ;
+		}
+	}
+} ;
+
+// queue kecil supaya producer sering ketemu kondisi penuh dan konsumen sering ketemu kosong
+static void test_queue() {
+	static MpscQueue<uint64_t, 64> queue ;
+	std::atomic<bool> go {false} ;
+	std::vector<std::thread> producers ;
+	for (uint32_t p = 0 ; p < producer_count ; ++p) {
+		producers.emplace_back([p, &go] {
+			while (!go.load(std::memory_order_acquire)) {}
+			for (uint32_t i = 0 ; i < per_producer ; ++i) {
+				while (!queue.TryPush((uint64_t(p) << 32) | i)) {
+					std::this_thread::yield() ;
+				}
+			}
+		}) ;
+	}
+
+	Tracker tracker ;
+	go.store(true, std::memory_order_release) ;
+	const uint64_t total = uint64_t(producer_count) * per_producer ;
+	while (tracker.received < total) {
+		const size_t count = queue.Drain([&tracker](uint64_t value) { tracker.Take(static_cast<uint32_t>(value >> 32), static_cast<uint32_t>(value)) ; }, 32) ;
+		if (count == 0) {
+			std::this_thread::yield() ;
+		}
+	}
+	for (std::thread& thread : producers) {
+		thread.join() ;
+	}
+
+	uint64_t extra = 0 ;
+	CHECK(!queue.TryPop(extra)) ;
+	tracker.Verify() ;
+}
+
+// jalur aplikasi: PostEvent dari worker, WaitEvent di thread UI (inbox -> queue utama, wakeup backend)
+static void test_post_event() {
+	EventSys::ResetStats() ;
+	std::atomic<bool> go {false} ;
+	std::vector<std::thread> producers ;
+	for (uint32_t p = 0 ; p < producer_count ; ++p) {
+		producers.emplace_back([p, &go] {
+			while (!go.load(std::memory_order_acquire)) {}
+			for (uint32_t i = 0 ; i < per_producer ; ++i) {
+				while (!EventSys::PostEvent(Event(nullptr, UserEvent(p, i)))) {
+					std::this_thread::yield() ;
+				}
+			}
+		}) ;
+	}
+
+	Tracker tracker ;
+	uint64_t other = 0 ;
+	go.store(true, std::memory_order_release) ;
+	const uint64_t total = uint64_t(producer_count) * per_producer ;
+	const uint64_t deadline = Now() + 60'000'000'000ull ;
+	Event event ;
+	while (tracker.received < total && Now() < deadline) {
+		if (!WaitEvent(event, 100)) {
+			continue ;
+		}
+		if (event.IsUserEvent()) {
+			tracker.Take(event.GetUserEvent().GetCode(), static_cast<uint32_t>(event.GetUserEvent().GetData())) ;
+		} else {
+			++other ;
+		}
+	}
+	for (std::thread& thread : producers) {
+		thread.join() ;
+	}
+
+	CHECK(other == 0) ;
+	CHECK(!PollEvent(event)) ;
+	CHECK(EventSys::GetStats().posted == total) ;
+	CHECK(EventSys::GetStats().dropped == 0) ;
+	tracker.Verify() ;
+}
+
+int main() {
+	test_queue() ;
+	test_post_event() ;
+	return test::Result("mpsc") ;
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include <cmath>
+#include <random>
+
+#include "check.hpp"
+#include "pixel.hpp"
+
+using namespace zz ;
+
+static std::mt19937 g_random(16) ;
+
+static std::vector<SimdLevel> levels() {
+	std::vector<SimdLevel> result ;
+	for (const SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON}) {
+		if (Simd::IsSupported(level)) {
+			result.push_back(level) ;
+		}
+	}
+	return result ;
+}
+
+// premultiplied valid (c <= a) atau sembarang byte, supaya saturasi di jalur SIMD ikut teruji
+static std::vector<Color> random_pixels(size_t count, bool premultiplied) {
+	std::uniform_int_distribution<int> byte(0, 255) ;
+	std::vector<Color> pixels(count) ;
+	for (Color& c : pixels) {
+		// sebagian alpha dibuat 0 dan 255, kasus tepi yang paling sering muncul di UI
+		const int pick = byte(g_random) ;
+		const uint8_t a = static_cast<uint8_t>(pick < 32 ? 0 : pick < 64 ? 255 : byte(g_random)) ;
+		const auto channel = [&] { return static_cast<uint8_t>(premultiplied ? std::uniform_int_distribution<int>(0, a)(g_random) : byte(g_random)) ; } ;
+		c = Color(channel(), channel(), channel(), a) ;
+	}
+	return pixels ;
+}
+
+// Mul255 dan Unpremultiply per piksel dicek menyeluruh terhadap rumus pembulatan biasa
+static void test_reference() {
+	for (uint32_t a = 0 ; a < 256 ; ++a) {
+		for (uint32_t b = 0 ; b < 256 ; ++b) {
+			CHECK(utility::Mul255(a, b) == static_cast<uint32_t>(std::floor(a * b / 255.0 + 0.5))) ;
+		}
+	}
+	for (uint32_t a = 1 ; a < 256 ; ++a) {
+		for (uint32_t c = 0 ; c <= a ; ++c) {
+			const Color u = Unpremultiply(Color(static_cast<uint8_t>(c), 0, 0, static_cast<uint8_t>(a))) ;
+			CHECK(u.r == static_cast<uint32_t>(c * 255 / a + (2 * (c * 255 % a) >= a ? 1 : 0))) ;
+		}
+	}
+}
+
+// setiap operasi span di setiap level dibandingkan dengan fungsi per piksel. panjang acak supaya sisa scalar
+// setelah blok 4/8 piksel ikut teruji
+static void test_kernels() {
+	const SimdLevel detected = Simd::GetLevel() ;
+	const BlendMode modes[] = {BlendMode::SourceOver, BlendMode::Multiply, BlendMode::Screen, BlendMode::SourceOverGamma} ;
+	for (int round = 0 ; round < 400 ; ++round) {
+		const size_t count = static_cast<size_t>(std::uniform_int_distribution<int>(0, 70)(g_random)) ;
+		const bool premultiplied = round % 3 != 0 ;
+		const std::vector<Color> dst = random_pixels(count, premultiplied) ;
+		const std::vector<Color> src = random_pixels(count, premultiplied) ;
+		const Color solid = random_pixels(1, premultiplied)[0] ;
+		const uint8_t t = static_cast<uint8_t>(std::uniform_int_distribution<int>(0, 255)(g_random)) ;
+
+		for (const SimdLevel level : levels()) {
+			CHECK(Simd::SetLevel(level)) ;
+
+			std::vector<Color> out = src ;
+			Premultiply(std::span(out)) ;
+			for (size_t i = 0 ; i < count ; ++i) {
+				CHECK(out[i] == Premultiply(src[i])) ;
+			}
+
+			out = src ;
+			Unpremultiply(std::span(out)) ;
+			for (size_t i = 0 ; i < count ; ++i) {
+				// di luar premultiplied (c > a) hasilnya hanya dijamin saturasi, tidak dibandingkan
+				if (premultiplied) {
+					CHECK(out[i] == Unpremultiply(src[i])) ;
+				}
+			}
+
+			for (const BlendMode mode : modes) {
+				out = dst ;
+				CHECK(Blend(std::span(out), std::span<const Color>(src), mode) == count) ;
+				for (size_t i = 0 ; i < count ; ++i) {
+					CHECK(out[i] == Blend(dst[i], src[i], mode)) ;
+				}
+
+				out = dst ;
+				Blend(std::span(out), solid, mode) ;
+				for (size_t i = 0 ; i < count ; ++i) {
+					CHECK(out[i] == Blend(dst[i], solid, mode)) ;
+				}
+			}
+
+			out = dst ;
+			CHECK(Lerp(std::span(out), std::span<const Color>(src), t) == count) ;
+			for (size_t i = 0 ; i < count ; ++i) {
+				CHECK(out[i] == Lerp(dst[i], src[i], t)) ;
+			}
+
+			out = dst ;
+			PixelKernel::Fill(utility::Flatten<uint32_t>(std::span(out)), count, solid) ;
+			for (size_t i = 0 ; i < count ; ++i) {
+				CHECK(out[i] == solid) ;
+			}
+		}
+	}
+	Simd::SetLevel(detected) ;
+}
+
+// span yang tidak dimulai di alamat kelipatan 16/32 byte
+static void test_unaligned() {
+	const SimdLevel detected = Simd::GetLevel() ;
+	const std::vector<Color> dst = random_pixels(67, true) ;
+	const std::vector<Color> src = random_pixels(67, true) ;
+	for (const SimdLevel level : levels()) {
+		Simd::SetLevel(level) ;
+		for (size_t offset = 1 ; offset < 8 ; ++offset) {
+			std::vector<Color> out = dst ;
+			Blend(std::span(out).subspan(offset), std::span<const Color>(src).subspan(offset - 1)) ;
+			for (size_t i = 0 ; i < out.size() ; ++i) {
+				CHECK(out[i] == (i < offset ? dst[i] : Blend(dst[i], src[i - 1]))) ;
+			}
+		}
+	}
+	Simd::SetLevel(detected) ;
+}
+
+int main() {
+	test_reference() ;
+	test_kernels() ;
+	test_unaligned() ;
+	return test::Result("pixel") ;
+}
\ No newline at end of file
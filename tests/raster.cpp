@@ -0,0 +1,131 @@
+#include <random>
+
+#include "check.hpp"
+#include "raster.hpp"
+
+using namespace zz ;
+
+static std::mt19937 g_random(19) ;
+
+static float uniform(float lo, float hi) {
+	return std::uniform_real_distribution<float>(lo, hi)(g_random) ;
+}
+
+static Color random_color() {
+	const int a = std::uniform_int_distribution<int>(0, 3)(g_random) == 0 ? 255 : std::uniform_int_distribution<int>(1, 255)(g_random) ;
+	const auto channel = [a] { return static_cast<uint8_t>(std::uniform_int_distribution<int>(0, a)(g_random)) ; } ;
+	return Color(channel(), channel(), channel(), static_cast<uint8_t>(a)) ;
+}
+
+// semua jenis perintah, sebagian melewati tepi target dan batas tile, dengan clip dan semua mode blend
+static void record(Rasterizer& raster, const SurfaceView& image, const std::vector<uint8_t>& mask, int width, int height) {
+	const BlendMode modes[] = {BlendMode::SourceOver, BlendMode::Multiply, BlendMode::Screen, BlendMode::SourceOverGamma} ;
+	const float w = static_cast<float>(width) ;
+	const float h = static_cast<float>(height) ;
+	for (int i = 0 ; i < 120 ; ++i) {
+		raster.SetBlendMode(modes[std::uniform_int_distribution<int>(0, 3)(g_random)]) ;
+		const float x = uniform(-40.0f, w) ;
+		const float y = uniform(-40.0f, h) ;
+		switch (std::uniform_int_distribution<int>(0, 7)(g_random)) {
+			case 0 :
+				raster.FillRect(Rect<int>(static_cast<int>(x), static_cast<int>(y), static_cast<uint32_t>(uniform(1.0f, 200.0f)), static_cast<uint32_t>(uniform(1.0f, 200.0f))), random_color()) ;
+				break ;
+			case 1 :
+				raster.FillRoundedRect(Rect<float>(x, y, uniform(1.0f, 220.0f), uniform(1.0f, 160.0f)), uniform(0.0f, 30.0f), random_color()) ;
+				break ;
+			case 2 :
+				raster.DrawLine(Point<float>(x, y), Point<float>(uniform(-40.0f, w + 40.0f), uniform(-40.0f, h + 40.0f)), uniform(0.5f, 8.0f), random_color()) ;
+				break ;
+			case 3 : {
+				const std::array<Point<float>, 5> pentagon {
+					Point<float>(x, y), Point<float>(x + 90.0f, y + 10.0f), Point<float>(x + 110.0f, y + 80.0f),
+					Point<float>(x + 40.0f, y + 130.0f), Point<float>(x - 20.0f, y + 70.0f)
+				} ;
+				raster.FillPolygon(pentagon, random_color()) ;
+				break ;
+			}
+			case 4 :
+				raster.Blit(image, Point<int>(static_cast<int>(x), static_cast<int>(y))) ;
+				break ;
+			case 5 :
+				raster.FillMask(mask.data(), 32, Rect<int>(static_cast<int>(x), static_cast<int>(y), 32, 32), random_color()) ;
+				break ;
+			case 6 :
+				raster.PushClip(Rect<int>(static_cast<int>(x), static_cast<int>(y), static_cast<uint32_t>(uniform(10.0f, w)), static_cast<uint32_t>(uniform(10.0f, h)))) ;
+				break ;
+			default :
+				raster.PopClip() ;
+				break ;
+		}
+	}
+}
+
+static bool same(const SurfaceView& a, const SurfaceView& b) noexcept {
+	for (int y = 0 ; y < a.Height() ; ++y) {
+		if (std::memcmp(a.Row(y), b.Row(y), static_cast<size_t>(a.Width()) * sizeof(Color)) != 0) {
+			return false ;
+		}
+	}
+	return true ;
+}
+
+// render serial sebagai acuan, lalu 1/2/4/N thread harus sama byte per byte. ukuran target tidak kelipatan tile,
+// jadi tile tepi yang terpotong ikut teruji. damage clip juga dibandingkan dengan render serial yang sama
+static void test_threads() {
+	std::vector<size_t> counts = {1, 2, 4} ;
+	const size_t cores = std::thread::hardware_concurrency() ;
+	if (cores > 4) {
+		counts.push_back(cores) ;
+	}
+	std::vector<std::unique_ptr<ThreadPool>> pools ;
+	for (const size_t count : counts) {
+		pools.push_back(std::make_unique<ThreadPool>(count - 1)) ;
+		CHECK(pools.back()->GetThreadCount() == count) ;
+	}
+
+	Surface image(45, 37) ;
+	for (int y = 0 ; y < image.Height() ; ++y) {
+		for (Color& c : image.RowSpan(y)) {
+			c = random_color() ;
+		}
+	}
+	std::vector<uint8_t> mask(32 * 32) ;
+	for (uint8_t& m : mask) {
+		m = static_cast<uint8_t>(std::uniform_int_distribution<int>(0, 255)(g_random)) ;
+	}
+
+	const std::array<Rect<int>, 3> damage {Rect<int>(0, 0, 70, 30), Rect<int>(100, 40, 150, 200), Rect<int>(300, 260, 400, 100)} ;
+	for (int frame = 0 ; frame < 12 ; ++frame) {
+		const int width = std::uniform_int_distribution<int>(1, 500)(g_random) ;
+		const int height = std::uniform_int_distribution<int>(1, 330)(g_random) ;
+		Rasterizer raster ;
+		record(raster, image, mask, width, height) ;
+
+		Surface background(width, height) ;
+		background.Fill(Color(30, 40, 50, 255)) ;
+		background.FillBlend(Rect<int>(0, 0, static_cast<uint32_t>(width / 2 + 1), static_cast<uint32_t>(height)), Color(0, 0, 0, 120)) ;
+
+		Surface serial(width, height) ;
+		serial.Copy(background, Point<int>{}) ;
+		raster.Render(serial) ;
+		Surface serial_damage(width, height) ;
+		serial_damage.Copy(background, Point<int>{}) ;
+		raster.Render(serial_damage, damage) ;
+
+		for (const std::unique_ptr<ThreadPool>& pool : pools) {
+			Surface parallel(width, height) ;
+			parallel.Copy(background, Point<int>{}) ;
+			raster.Render(parallel, pool.get()) ;
+			CHECK(same(serial, parallel)) ;
+
+			parallel.Copy(background, Point<int>{}) ;
+			raster.Render(parallel, damage, pool.get()) ;
+			CHECK(same(serial_damage, parallel)) ;
+		}
+	}
+}
+
+int main() {
+	test_threads() ;
+	return test::Result("raster") ;
+}
\ No newline at end of file
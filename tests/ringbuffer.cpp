@@ -0,0 +1,79 @@
+#include "check.hpp"
+#include "ringbuffer.hpp"
+
+using namespace zz ;
+
+// urutan FIFO setelah head/tail melewati batas buffer berkali-kali
+static void test_wrap() {
+	RingBuffer<uint32_t, 8> ring ;
+	uint32_t next_push = 0 ;
+	uint32_t next_pop = 0 ;
+	for (int round = 0 ; round < 100 ; ++round) {
+		for (int i = 0 ; i < 5 ; ++i) {
+			CHECK(ring.Push(next_push++)) ;
+		}
+		uint32_t value = 0 ;
+		for (int i = 0 ; i < 5 ; ++i) {
+			CHECK(ring.Pop(value) && value == next_pop++) ;
+		}
+	}
+	CHECK(ring.Empty() && ring.IsInline() && ring.Capacity() == 8) ;
+}
+
+// Grow memindahkan isi ke heap tanpa mengubah urutan, termasuk saat isi sedang melingkar
+static void test_grow() {
+	RingBuffer<uint32_t, 8> ring(QueuePolicy::Grow, 64) ;
+	uint32_t value = 0 ;
+	for (uint32_t i = 0 ; i < 6 ; ++i) {
+		ring.Push(i) ;
+	}
+	for (uint32_t i = 0 ; i < 4 ; ++i) {
+		ring.Pop(value) ;
+	}
+	for (uint32_t i = 6 ; i < 60 ; ++i) {
+		CHECK(ring.Push(i)) ;
+	}
+	CHECK(!ring.IsInline() && ring.Capacity() == 64 && ring.Size() == 56) ;
+	CHECK(*ring.Back() == 59) ;
+	for (uint32_t i = 60 ; i < 68 ; ++i) {
+		ring.Push(i) ;
+	}
+	CHECK(ring.Size() == 64 && !ring.Push(1000)) ;
+
+	for (uint32_t expect = 4 ; expect < 68 ; ++expect) {
+		CHECK(ring.Pop(value) && value == expect) ;
+	}
+	CHECK(!ring.Pop(value) && ring.Back() == nullptr) ;
+
+	ring.Push(7) ;
+	ring.ShrinkToFit() ;
+	CHECK(ring.IsInline() && ring.Capacity() == 8 && ring.Pop(value) && value == 7) ;
+}
+
+static void test_drop() {
+	uint32_t value = 0 ;
+
+	RingBuffer<uint32_t, 4> oldest(QueuePolicy::DropOldest) ;
+	for (uint32_t i = 0 ; i < 10 ; ++i) {
+		CHECK(oldest.Push(i)) ;
+	}
+	CHECK(oldest.Size() == 4 && oldest.IsInline()) ;
+	for (uint32_t expect = 6 ; expect < 10 ; ++expect) {
+		CHECK(oldest.Pop(value) && value == expect) ;
+	}
+
+	RingBuffer<uint32_t, 4> newest(QueuePolicy::DropNewest) ;
+	for (uint32_t i = 0 ; i < 10 ; ++i) {
+		CHECK(newest.Push(i) == (i < 4)) ;
+	}
+	for (uint32_t expect = 0 ; expect < 4 ; ++expect) {
+		CHECK(newest.Pop(value) && value == expect) ;
+	}
+}
+
+int main() {
+	test_wrap() ;
+	test_grow() ;
+	test_drop() ;
+	return test::Result("ringbuffer") ;
+}
\ No newline at end of file
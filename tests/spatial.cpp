@@ -0,0 +1,213 @@
+#include <random>
+
+#include "check.hpp"
+#include "spatial.hpp"
+
+using namespace zz ;
+
+static std::mt19937 g_random(24) ;
+
+static float uniform(float lo, float hi) {
+	return std::uniform_real_distribution<float>(lo, hi)(g_random) ;
+}
+
+// acuan: semua rect disimpan apa adanya dan setiap query memindai semuanya
+class Linear {
+private :
+	struct Item {
+		Rect<float> rect {} ;
+		uint32_t z = 0 ;
+		bool used = false ;
+	} ;
+	std::vector<Item> items_ {} ;
+
+public :
+	void Insert(uint32_t id, const Rect<float>& r, uint32_t z) {
+		if (id >= items_.size()) {
+			items_.resize(static_cast<size_t>(id) + 1) ;
+		}
+		items_[id] = Item{r, z, true} ;
+	}
+
+	void Erase(uint32_t id) noexcept {
+		if (id < items_.size()) {
+			items_[id] = Item{} ;
+		}
+	}
+
+	bool Used(uint32_t id) const noexcept { return id < items_.size() && items_[id].used ; }
+	const Rect<float>& Get(uint32_t id) const noexcept { return items_[id].rect ; }
+
+	size_t Size() const noexcept {
+		return static_cast<size_t>(std::count_if(items_.begin(), items_.end(), [](const Item& item) { return item.used ; })) ;
+	}
+
+	std::vector<uint32_t> QueryPoint(const Point<float>& p) const {
+		std::vector<uint32_t> out ;
+		for (uint32_t id = 0 ; id < items_.size() ; ++id) {
+			if (items_[id].used && zz::Contains(items_[id].rect, p)) {
+				out.push_back(id) ;
+			}
+		}
+		return out ;
+	}
+
+	std::vector<uint32_t> QueryRect(const Rect<float>& r) const {
+		std::vector<uint32_t> out ;
+		for (uint32_t id = 0 ; id < items_.size() ; ++id) {
+			if (items_[id].used && !IsEmpty(r) && !IsEmpty(items_[id].rect) && Intersects(items_[id].rect, r)) {
+				out.push_back(id) ;
+			}
+		}
+		return out ;
+	}
+
+	std::optional<uint32_t> TopAt(const Point<float>& p) const {
+		std::optional<uint32_t> best {} ;
+		for (uint32_t id = 0 ; id < items_.size() ; ++id) {
+			if (items_[id].used && zz::Contains(items_[id].rect, p) && (!best || items_[id].z >= items_[*best].z)) {
+				best = id ;
+			}
+		}
+		return best ;
+	}
+} ;
+
+// kebanyakan seukuran widget, sebagian rect kosong dan sebagian sangat besar (daftar oversize di grid)
+static Rect<float> random_rect() {
+	const int pick = std::uniform_int_distribution<int>(0, 99)(g_random) ;
+	if (pick < 3) {
+		return Rect<float>(uniform(0.0f, 3000.0f), uniform(0.0f, 3000.0f), 0.0f, uniform(0.0f, 50.0f)) ;
+	}
+	if (pick < 6) {
+		return Rect<float>(uniform(-500.0f, 1000.0f), uniform(-500.0f, 1000.0f), uniform(800.0f, 3000.0f), uniform(800.0f, 3000.0f)) ;
+	}
+	return Rect<float>(uniform(0.0f, 3000.0f), uniform(0.0f, 3000.0f), uniform(1.0f, 200.0f), uniform(1.0f, 120.0f)) ;
+}
+
+static uint32_t random_z() {
+	return static_cast<uint32_t>(std::uniform_int_distribution<int>(0, 7)(g_random)) ;
+}
+
+static std::vector<uint32_t> sorted(std::vector<uint32_t> ids) {
+	std::sort(ids.begin(), ids.end()) ;
+	return ids ;
+}
+
+// titik acak dan titik tepat di tepi rect yang ada (kiri/atas termasuk, kanan/bawah tidak)
+static Point<float> random_point(const Linear& model, uint32_t capacity) {
+	const uint32_t id = static_cast<uint32_t>(std::uniform_int_distribution<uint32_t>(0, capacity - 1)(g_random)) ;
+	if (model.Used(id) && std::uniform_int_distribution<int>(0, 2)(g_random) == 0) {
+		const Rect<float>& r = model.Get(id) ;
+		return std::uniform_int_distribution<int>(0, 1)(g_random) == 0 ? r.GetPoint() : Point<float>(Right(r), Bottom(r)) ;
+	}
+	return Point<float>(uniform(-600.0f, 3300.0f), uniform(-600.0f, 3300.0f)) ;
+}
+
+static void verify(SpatialIndex& index, const Linear& model, uint32_t capacity) {
+	CHECK(index.Size() == model.Size()) ;
+	std::vector<uint32_t> out ;
+	bool point = true ;
+	bool top = true ;
+	bool rect = true ;
+	for (int i = 0 ; i < 300 ; ++i) {
+		const Point<float> p = random_point(model, capacity) ;
+		index.QueryPoint(p, out) ;
+		point = point && sorted(out) == model.QueryPoint(p) ;
+		top = top && index.TopAt(p) == model.TopAt(p) ;
+
+		const Rect<float> r = random_rect() ;
+		index.QueryRect(r, out) ;
+		rect = rect && sorted(out) == model.QueryRect(r) ;
+	}
+	CHECK(point) ;
+	CHECK(top) ;
+	CHECK(rect) ;
+}
+
+// urutan operasi dipilih supaya tiap jalur PackedRTree terlewati: pending, refit di bawah batas, hapus,
+// dan Rebuild otomatis setelah batas terlewati. grid menjalani urutan yang sama
+static void test_index(SpatialIndex& index, PackedRTree* tree) {
+	constexpr uint32_t capacity = 2000 ;
+	Linear model ;
+	const auto insert = [&](uint32_t id, const Rect<float>& r) {
+		const uint32_t z = random_z() ;
+		index.Insert(id, r, z) ;
+		model.Insert(id, r, z) ;
+	} ;
+	const auto erase = [&](uint32_t id) {
+		index.Erase(id) ;
+		model.Erase(id) ;
+	} ;
+	// geser sedikit (biasanya cell yang sama) atau pindah jauh
+	const auto move = [&](uint32_t id) {
+		if (!model.Used(id)) {
+			return ;
+		}
+		const Rect<float> r = model.Get(id) ;
+		insert(id, std::uniform_int_distribution<int>(0, 1)(g_random) == 0 ? Rect<float>(Point<float>(r.GetPoint().x + uniform(-3.0f, 3.0f), r.GetPoint().y + uniform(-3.0f, 3.0f)), r.GetSize()) : random_rect()) ;
+	} ;
+
+	verify(index, model, capacity) ;
+	for (uint32_t id = 0 ; id < capacity ; ++id) {
+		insert(id, random_rect()) ;
+	}
+	verify(index, model, capacity) ;
+
+	// refit: jauh di bawah batas rebuild (size / 4)
+	if (tree) {
+		tree->Rebuild() ;
+	}
+	for (int i = 0 ; i < 100 ; ++i) {
+		move(static_cast<uint32_t>(std::uniform_int_distribution<uint32_t>(0, capacity - 1)(g_random))) ;
+	}
+	verify(index, model, capacity) ;
+	for (uint32_t id = 0 ; id < 100 ; ++id) {
+		erase(id * 7) ;
+	}
+	verify(index, model, capacity) ;
+
+	// id yang dihapus dipakai lagi, masuk pending
+	for (uint32_t id = 0 ; id < 50 ; ++id) {
+		insert(id * 7, random_rect()) ;
+	}
+	verify(index, model, capacity) ;
+
+	// melewati batas: rebuild otomatis di query berikutnya
+	for (uint32_t id = 0 ; id < 700 ; ++id) {
+		move(id) ;
+	}
+	verify(index, model, capacity) ;
+
+	for (int round = 0 ; round < 40 ; ++round) {
+		for (int i = 0 ; i < 50 ; ++i) {
+			const uint32_t id = static_cast<uint32_t>(std::uniform_int_distribution<uint32_t>(0, capacity - 1)(g_random)) ;
+			switch (std::uniform_int_distribution<int>(0, 3)(g_random)) {
+				case 0 : erase(id) ; break ;
+				case 1 : insert(id, random_rect()) ; break ;
+				default : move(id) ; break ;
+			}
+		}
+		verify(index, model, capacity) ;
+	}
+
+	index.Clear() ;
+	CHECK(index.Size() == 0) ;
+	Linear empty ;
+	for (uint32_t id = 0 ; id < 10 ; ++id) {
+		const Rect<float> r = random_rect() ;
+		index.Insert(id, r, id) ;
+		empty.Insert(id, r, id) ;
+	}
+	verify(index, empty, 10) ;
+}
+
+int main() {
+	SpatialGrid grid(64.0f) ;
+	test_index(grid, nullptr) ;
+	SpatialGrid coarse(512.0f) ;
+	test_index(coarse, nullptr) ;
+	PackedRTree tree ;
+	test_index(tree, &tree) ;
+	return test::Result("spatial") ;
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include <cmath>
+#include <random>
+
+#include "check.hpp"
+#include "raster.hpp"
+
+using namespace zz ;
+
+static std::mt19937 g_random(17) ;
+
+static uint8_t random_byte(int lo = 0, int hi = 255) {
+	return static_cast<uint8_t>(std::uniform_int_distribution<int>(lo, hi)(g_random)) ;
+}
+
+static Color random_premultiplied(bool opaque) {
+	const uint8_t a = opaque ? uint8_t{255} : random_byte() ;
+	return Color(random_byte(0, a), random_byte(0, a), random_byte(0, a), a) ;
+}
+
+// tabel dibandingkan dengan kurva double: decode maksimal selisih pembulatan, encode maksimal 1 langkah 8-bit
+static void test_tables() {
+	for (uint32_t v = 0 ; v < 256 ; ++v) {
+		const double linear = utility::SrgbToLinear(v / 255.0) * 65535.0 ;
+		CHECK(std::abs(Srgb::ToLinear(static_cast<uint8_t>(v)) - linear) <= 0.5) ;
+	}
+	for (uint32_t v = 0 ; v < 65536 ; v += 7) {
+		const double srgb = utility::LinearToSrgb(v / 65535.0) * 255.0 ;
+		CHECK(std::abs(Srgb::ToSrgb(static_cast<uint16_t>(v)) - srgb) <= 1.0) ;
+	}
+
+	// tabel kebalikan dan tabel linear premultiplied untuk semua pasangan (c, a), termasuk c > a yang dibatasi
+	bool same = true ;
+	for (uint32_t a = 1 ; a < 256 ; ++a) {
+		for (uint32_t c = 0 ; c < 256 ; ++c) {
+			const uint8_t u = Unpremultiply(Color(static_cast<uint8_t>(c), 0, 0, static_cast<uint8_t>(a))).r ;
+			same = same && utility::UnpremultiplyChannel(c, static_cast<uint8_t>(a)) == u ;
+			same = same && Srgb::ToLinear(static_cast<uint8_t>(c), static_cast<uint8_t>(a)) == (Srgb::ToLinear(u) * a + 127) / 255 ;
+		}
+	}
+	for (uint32_t x = 0 ; x < (1u << 26) ; x += 997) {
+		for (uint32_t d = 1 ; d < 256 ; d += 7) {
+			same = same && utility::Divide(x, static_cast<uint8_t>(d)) == x / d ;
+		}
+	}
+	CHECK(same) ;
+}
+
+// BlendGamma premultiplied dibandingkan dengan rumus double: unpremultiply, kurva asli, rata-rata linear
+// berbobot sa dan da * (1 - sa), encode, premultiply dengan alpha hasil. selisih maksimal satu langkah
+static void test_blend() {
+	for (int i = 0 ; i < 200000 ; ++i) {
+		const Color dst = random_premultiplied(i % 2 == 0) ;
+		const Color src = random_premultiplied(false) ;
+		const Color out = BlendGamma(dst, src) ;
+		CHECK(out.a == Blend(dst, src).a) ;
+		if (src.a == 0) {
+			CHECK(out == dst) ;
+			continue ;
+		}
+
+		const Color s = Unpremultiply(src) ;
+		const Color d = Unpremultiply(dst) ;
+		const double sa = src.a ;
+		const double dw = utility::Mul255(dst.a, 255u - src.a) ;
+		const auto expected = [&](uint8_t x, uint8_t y) {
+			const double linear = (utility::SrgbToLinear(y / 255.0) * sa + utility::SrgbToLinear(x / 255.0) * dw) / (sa + dw) ;
+			const uint32_t c = static_cast<uint32_t>(utility::LinearToSrgb(linear) * 255.0 + 0.5) ;
+			return static_cast<int>(utility::Mul255(c, out.a)) ;
+		} ;
+		CHECK(std::abs(out.r - expected(d.r, s.r)) <= 1) ;
+		CHECK(std::abs(out.g - expected(d.g, s.g)) <= 1) ;
+		CHECK(std::abs(out.b - expected(d.b, s.b)) <= 1) ;
+	}
+
+	// putih 50% di atas hitam: linear 0.5 = sRGB 188, source-over biasa berhenti di 128
+	const Color gray = BlendGamma(Color(0, 0, 0, 255), Color(128, 128, 128, 128)) ;
+	CHECK(gray.r >= 187 && gray.r <= 189 && gray.r == gray.g && gray.g == gray.b && gray.a == 255) ;
+	CHECK(Blend(Color(0, 0, 0, 255), Color(128, 128, 128, 128)).r == 128) ;
+	CHECK(Blend(Color(0, 0, 0, 255), Color(128, 128, 128, 128), BlendMode::SourceOverGamma) == gray) ;
+
+	// gradien straight alpha
+	CHECK(LerpGamma(Color(0, 0, 0, 255), Color(255, 255, 255, 255), 128).r == gray.r) ;
+	CHECK(LerpGamma(Color(10, 20, 30, 40), Color(200, 100, 0, 255), 255) == Color(200, 100, 0, 255)) ;
+}
+
+static bool same(const SurfaceView& a, const SurfaceView& b) noexcept {
+	for (int y = 0 ; y < a.Height() ; ++y) {
+		if (std::memcmp(a.Row(y), b.Row(y), static_cast<size_t>(a.Width()) * sizeof(Color)) != 0) {
+			return false ;
+		}
+	}
+	return true ;
+}
+
+static void fill_random(const SurfaceView& surface, bool opaque) {
+	for (int y = 0 ; y < surface.Height() ; ++y) {
+		for (Color& c : surface.RowSpan(y)) {
+			c = random_premultiplied(opaque) ;
+		}
+	}
+}
+
+// mode bisa dipakai dari Surface dan Rasterizer, hasil Rasterizer sama dengan FillBlend/Blit pada Surface
+static void test_surface() {
+	for (const bool opaque : {true, false}) {
+		Surface expected(150, 90) ;
+		Surface actual(150, 90) ;
+		Surface image(40, 30) ;
+		fill_random(expected, opaque) ;
+		fill_random(image, false) ;
+		actual.Copy(expected, Point<int>{}) ;
+
+		const Color tint(60, 20, 90, 140) ;
+		expected.FillBlend(Rect<int>(10, 5, 120, 70), tint, BlendMode::SourceOverGamma) ;
+		expected.Blit(image, Point<int>(70, 50), BlendMode::SourceOverGamma) ;
+		expected.Fill(Rect<int>(0, 0, 8, 8), Color(1, 2, 3, 255)) ;
+
+		Rasterizer raster ;
+		raster.SetBlendMode(BlendMode::SourceOverGamma) ;
+		raster.FillRect(Rect<int>(10, 5, 120, 70), tint) ;
+		raster.Blit(image, Point<int>(70, 50)) ;
+		raster.FillRect(Rect<int>(0, 0, 8, 8), Color(1, 2, 3, 255)) ;
+		raster.Render(actual) ;
+		CHECK(same(expected, actual)) ;
+
+		// tepi anti-aliasing ikut mode: piksel di tepi tidak sama dengan hasil source-over biasa
+		Surface plain(150, 90) ;
+		Surface gamma(150, 90) ;
+		plain.Fill(Color(0, 0, 0, 255)) ;
+		gamma.Fill(Color(0, 0, 0, 255)) ;
+		raster.Clear() ;
+		CHECK(raster.GetBlendMode() == BlendMode::SourceOver) ;
+		raster.FillRoundedRect(Rect<float>(10.5f, 10.5f, 60.0f, 40.0f), 12.0f, Color(255, 255, 255, 255)) ;
+		raster.Render(plain) ;
+		raster.Clear() ;
+		raster.SetBlendMode(BlendMode::SourceOverGamma) ;
+		raster.FillRoundedRect(Rect<float>(10.5f, 10.5f, 60.0f, 40.0f), 12.0f, Color(255, 255, 255, 255)) ;
+		raster.Render(gamma) ;
+		CHECK(plain.At(40, 30) == gamma.At(40, 30)) ;
+		CHECK(gamma.At(10, 30).r > plain.At(10, 30).r) ;
+	}
+}
+
+int main() {
+	test_tables() ;
+	test_blend() ;
+	test_surface() ;
+	return test::Result("srgb") ;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "check.hpp"
+#include "virtuallist.hpp"
+
+using namespace zz ;
+
+// mencatat text kolom pertama sesuai urutan gambar, cukup untuk membaca baris mana yang terikat ke widget mana
+class CaptureText : public TextRenderer {
+public :
+	std::vector<std::pair<int, std::string>> rows {} ;
+
+	void DrawText(Rasterizer&, const Rect<int>& bound, std::string_view text, Color, uint32_t) override {
+		if (bound.GetPoint().x < 60) {
+			rows.emplace_back(bound.GetPoint().y, std::string(text)) ;
+		}
+	}
+	Size<int> MeasureText(std::string_view text, uint32_t) override { return Size<int>(static_cast<int>(text.size()) * 8, 16) ; }
+} ;
+
+// view setinggi 200 dengan baris 20: pool 11 widget (10 penuh + 1 terpotong)
+static constexpr size_t pool = 11 ;
+static constexpr float row_height = 20.0f ;
+
+struct Fixture {
+	CaptureText text {} ;
+	WidgetTree tree {} ;
+	size_t binds = 0 ;
+	VirtualList list ;
+	const Rect<int> client {0, 0, 400, 300} ;
+
+	explicit Fixture(uint64_t count) :
+		list(tree, tree.GetRoot(), WidgetStyle{.height = 200.0f}, VirtualListStyle{.row_height = row_height}, {60.0f, -1.0f}, [this](uint64_t row, uint32_t column, std::string& out) {
+			++binds ;
+			out = column == 0 ? std::to_string(row) : "isi" ;
+		}, count) {
+		tree.SetTextRenderer(&text) ;
+		tree.SetViewport(Size<float>(400.0f, 300.0f)) ;
+		settle() ;
+	}
+
+	// satu frame: Update, Layout, dan diulang sekali kalau bound view berubah
+	void settle() {
+		list.Update(client) ;
+		tree.Layout() ;
+		if (list.Update(client)) {
+			tree.Layout() ;
+		}
+	}
+
+	// widget baris ke-k (urutan anak view) harus menampilkan first + k dan posisinya turun satu baris per k
+	bool shows(uint64_t first) {
+		DisplayList display ;
+		tree.Record(display) ;
+		Rasterizer raster ;
+		text.rows.clear() ;
+		display.Replay(raster, {}, &text) ;
+		if (text.rows.size() != pool) {
+			return false ;
+		}
+		for (size_t k = 0 ; k < pool ; ++k) {
+			if (text.rows[k].second != std::to_string(first + k)) {
+				return false ;
+			}
+			// y dibulatkan ke pixel, offset pecahan saat animasi bisa membuat jaraknya 19 atau 21
+			if (k > 0 && std::abs(text.rows[k].first - text.rows[k - 1].first - static_cast<int>(row_height)) > 1) {
+				return false ;
+			}
+		}
+		return true ;
+	}
+} ;
+
+static void test_scroll(uint64_t count) {
+	Fixture f(count) ;
+	VirtualList& list = f.list ;
+	CHECK(list.GetPoolSize() == pool && f.shows(0)) ;
+	const size_t nodes = f.tree.GetCount() ;
+	const double max = static_cast<double>(count) * row_height - 200.0 ;
+
+	// {offset, baris pertama, bind yang diharapkan}. bind dihitung per sel (2 kolom): geser kurang dari pool hanya
+	// mengisi baris yang baru masuk, kurang dari satu baris tidak mengisi apa pun, lebih dari pool mengisi semua
+	struct Step {
+		double offset ;
+		uint64_t first ;
+		size_t binds ;
+	} ;
+	const Step steps[] = {
+		{8.0, 0, 0},					// maju kurang dari satu baris
+		{3.0 * row_height + 8.0, 3, 3 * 2},	// maju 3 baris
+		{3.0 * row_height + 1.0, 3, 0},		// mundur kurang dari satu baris
+		{40.0 * row_height + 5.0, 40, pool * 2},	// maju lebih dari pool
+		{33.0 * row_height, 33, 7 * 2},		// mundur 7 baris
+		{21.0 * row_height + 19.0, 21, pool * 2},	// mundur lebih dari pool
+		{max, count - pool, pool * 2},		// ujung data: baris pertama ditarik mundur, pool tetap
+		{max - 2.0 * row_height, count - pool - 1, 1 * 2},
+		{max - 0.5 * row_height, count - pool, 1 * 2},
+		{0.0, 0, pool * 2},
+	} ;
+	for (const Step& step : steps) {
+		f.binds = 0 ;
+		list.ScrollTo(step.offset, false) ;
+		f.settle() ;
+		CHECK(list.GetOffset() == step.offset) ;
+		CHECK(list.GetFirstRow() == step.first && f.binds == step.binds) ;
+		CHECK(list.GetPoolSize() == pool && f.tree.GetCount() == nodes) ;
+		CHECK(f.shows(step.first)) ;
+	}
+
+	// animasi: tiap Tick maju sedikit, baris dan jumlah widget tetap konsisten di setiap frame
+	list.ScrollToRow(count / 2) ;
+	uint64_t now = Now() ;
+	for (int frame = 0 ; frame < 200 && list.IsAnimating() ; ++frame) {
+		now += 16'000'000 ;
+		list.Tick(now) ;
+		f.settle() ;
+		CHECK(list.GetPoolSize() == pool && f.tree.GetCount() == nodes) ;
+		CHECK(f.shows(std::min(static_cast<uint64_t>(list.GetOffset() / row_height), count - pool))) ;
+	}
+	CHECK(!list.IsAnimating() && list.GetFirstRow() == count / 2) ;
+}
+
+int main() {
+	test_scroll(1000) ;
+	test_scroll(1'000'000'000) ;
+	return test::Result("virtuallist") ;
+}
\ No newline at end of file
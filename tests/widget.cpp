@@ -0,0 +1,104 @@
+#include <random>
+
+#include "check.hpp"
+#include "widget.hpp"
+
+using namespace zz ;
+
+// lebar text sebanding panjangnya, cukup untuk layout tanpa font sungguhan
+class FixedText : public TextRenderer {
+public :
+	void DrawText(Rasterizer&, const Rect<int>&, std::string_view, Color, uint32_t) override {}
+	Size<int> MeasureText(std::string_view text, uint32_t) override { return Size<int>(static_cast<int>(text.size()) * 8, 16) ; }
+} ;
+
+static constexpr size_t fanout = 10 ;
+static constexpr size_t depth = 4 ;		// root + 4 level = 11.111 node, 10.000 label di level terdalam
+
+// Row dan Column bergantian, sebagian node grow dan align berbeda supaya semua cabang arrange ikut terpakai
+static void build(WidgetTree& tree, SlotHandle parent, size_t level, std::vector<SlotHandle>& nodes, std::vector<SlotHandle>& leaves) {
+	for (size_t i = 0 ; i < fanout ; ++i) {
+		if (level + 1 == depth) {
+			const SlotHandle leaf = tree.CreateLabel(parent, "label " + std::to_string(leaves.size()), Color(255, 255, 255, 255)) ;
+			nodes.push_back(leaf) ;
+			leaves.push_back(leaf) ;
+			continue ;
+		}
+		const WidgetStyle style {
+			.layout = level % 2 == 0 ? WidgetLayout::Row : WidgetLayout::Column,
+			.align = i % 3 == 0 ? WidgetAlign::Start : WidgetAlign::Stretch,
+			.padding = 2.0f,
+			.gap = 1.0f,
+			.grow = i % 4 == 0 ? 1.0f : 0.0f
+		} ;
+		const SlotHandle child = tree.Create(parent, style) ;
+		nodes.push_back(child) ;
+		build(tree, child, level + 1, nodes, leaves) ;
+	}
+}
+
+struct Fixture {
+	FixedText text {} ;
+	WidgetTree tree {} ;
+	std::vector<SlotHandle> nodes {} ;
+	std::vector<SlotHandle> leaves {} ;
+
+	Fixture() {
+		tree.SetTextRenderer(&text) ;
+		tree.SetViewport(Size<float>(1920.0f, 1080.0f)) ;
+		build(tree, tree.GetRoot(), 0, nodes, leaves) ;
+	}
+} ;
+
+// satu SetText hanya boleh mengukur jalur leaf -> root dan menyusun ulang paling banyak jalur itu beserta
+// saudara langsungnya (O(depth x fanout)), dan hasilnya sama dengan layout penuh pohon baru dengan text yang sama
+static void test_incremental() {
+	Fixture fixture ;
+	WidgetTree& tree = fixture.tree ;
+	const size_t total = fixture.nodes.size() + 1 ;
+	CHECK(total == 11111) ;
+
+	LayoutStats stats = tree.Layout() ;
+	CHECK(stats.measured == total && stats.arranged == total) ;
+	stats = tree.Layout() ;
+	CHECK(stats.measured == 0 && stats.arranged == 0) ;
+
+	std::mt19937 random(23) ;
+	std::vector<std::string> texts(fixture.leaves.size()) ;
+	for (size_t i = 0 ; i < texts.size() ; ++i) {
+		texts[i] = "label " + std::to_string(i) ;
+	}
+	size_t worst_arranged = 0 ;
+	for (int round = 0 ; round < 200 ; ++round) {
+		const size_t leaf = std::uniform_int_distribution<size_t>(0, fixture.leaves.size() - 1)(random) ;
+		// panjang acak: ukuran label bisa tetap, membesar atau mengecil
+		texts[leaf] = std::string(std::uniform_int_distribution<size_t>(1, 40)(random), 'x') ;
+		tree.SetText(fixture.leaves[leaf], texts[leaf]) ;
+		stats = tree.Layout() ;
+		CHECK(stats.measured <= depth + 1) ;
+		CHECK(stats.arranged <= depth * fanout + 1) ;
+		worst_arranged = std::max(worst_arranged, stats.arranged) ;
+	}
+	CHECK(worst_arranged > depth) ;	// kasus yang menggeser saudara memang terjadi
+
+	// text sama tidak menandai apa-apa
+	tree.SetText(fixture.leaves[0], texts[0]) ;
+	stats = tree.Layout() ;
+	CHECK(stats.measured == 0 && stats.arranged == 0) ;
+
+	Fixture fresh ;
+	for (size_t i = 0 ; i < texts.size() ; ++i) {
+		fresh.tree.SetText(fresh.leaves[i], texts[i]) ;
+	}
+	fresh.tree.Layout() ;
+	bool same = true ;
+	for (size_t i = 0 ; i < fixture.nodes.size() ; ++i) {
+		same = same && tree.GetBound(fixture.nodes[i]) == fresh.tree.GetBound(fresh.nodes[i]) ;
+	}
+	CHECK(same) ;
+}
+
+int main() {
+	test_incremental() ;
+	return test::Result("widget") ;
+}
\ No newline at end of file